@@ -0,0 +1,35 @@
+#!/bin/sh
+# Compares the `printf` and `test` builtins with the external commands
+# they replace, called by absolute path so that they have to be forked.
+#
+# usage: bench/builtin_bench.sh [count] [path/to/minishell]
+
+COUNT=${1:-500}
+SHELL_BIN=${2:-./minishell}
+TMP=${TMPDIR:-/tmp}/minishell_builtin_bench.$$
+
+elapsed_us()
+{
+	start=$(date +%s%N)
+	"$SHELL_BIN" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000 ))
+}
+
+mkdir -p "$TMP"
+runs=$(seq 1 "$COUNT" | tr '\n' ' ')
+body='if [ -f /etc/passwd ]; then printf "%s:%05d\n" row $i; fi'
+echo "for i in $runs; do $body; done" > "$TMP/builtin"
+echo "for i in $runs; do if /usr/bin/test -f /etc/passwd; then" \
+	"/usr/bin/printf \"%s:%05d\n\" row \$i; fi; done" > "$TMP/external"
+: > "$TMP/empty"
+
+base=$(elapsed_us "$TMP/empty")
+builtin=$(elapsed_us "$TMP/builtin")
+external=$(elapsed_us "$TMP/external")
+rm -rf "$TMP"
+
+echo "iterations:          $COUNT"
+echo "startup:             ${base} us"
+echo "builtins:            $(( (builtin - base) / COUNT )) us/iteration"
+echo "external commands:   $(( (external - base) / COUNT )) us/iteration"
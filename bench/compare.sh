@@ -0,0 +1,43 @@
+#!/bin/sh
+# Compares two result files written by `make bench` and flags every
+# benchmark that got slower by more than a threshold.
+#
+# Lines are `<name> <value> <unit>`; lower values are better. Benchmarks
+# found in only one of the files are listed but never flagged.
+#
+# usage: bench/compare.sh <base> <new> [threshold_percent]
+# Exits with 1 if any benchmark regressed.
+
+if [ $# -lt 2 ]; then
+	echo "usage: $0 <base> <new> [threshold_percent]" >&2
+	exit 2
+fi
+THRESHOLD=${3:-10}
+
+awk -v threshold="$THRESHOLD" '
+NR == FNR { base[$1] = $2; next }
+{
+	seen[$1] = 1
+	if (!($1 in base)) {
+		printf "%-40s %12s %12s %8s  new\n", $1, "-", $2, "-"
+		next
+	}
+	delta = 0
+	if (base[$1] > 0)
+		delta = ($2 - base[$1]) * 100 / base[$1]
+	flag = ""
+	if (delta > threshold) {
+		flag = "  REGRESSION"
+		bad++
+	}
+	printf "%-40s %12s %12s %+7.1f%%%s\n", $1, base[$1], $2, delta, flag
+}
+END {
+	for (name in base)
+		if (!(name in seen))
+			printf "%-40s %12s %12s %8s  gone\n", name, base[name], "-", "-"
+	if (bad > 0) {
+		printf "%d regression(s) beyond %s%%\n", bad, threshold
+		exit 1
+	}
+}' "$1" "$2"
@@ -0,0 +1,62 @@
+#!/bin/sh
+# End-to-end scenarios for `make bench`: each one is a generated script fed
+# to the shell on standard input, timed from the outside, with the startup
+# time of an empty script subtracted.
+#
+# Prints one `e2e.<scenario> <value> <unit>` line per scenario, the format
+# bench/compare.sh reads.
+#
+# usage: bench/e2e_bench.sh [path/to/minishell] [scale]
+# `scale` divides every scenario's size, for a quick run.
+
+SHELL_BIN=${1:-./minishell}
+SCALE=${2:-1}
+TMP=${TMPDIR:-/tmp}/minishell_e2e_bench.$$
+
+elapsed_us()
+{
+	start=$(date +%s%N)
+	"$SHELL_BIN" < "$1" > /dev/null 2>&1
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000 ))
+}
+
+# report <name> <script> <count>: microseconds per each of the `count`
+# operations the script performs.
+report()
+{
+	t=$(elapsed_us "$2")
+	echo "e2e.$1 $(( (t - base) / $3 )) us/op"
+}
+
+mkdir -p "$TMP"
+: > "$TMP/empty"
+base=$(elapsed_us "$TMP/empty")
+
+n=$((10000 / SCALE))
+yes /bin/true | head -n "$n" > "$TMP/true"
+report true_10k "$TMP/true" "$n"
+
+n=$((200 / SCALE))
+stages=$(yes cat | head -n 64 | tr '\n' '|')
+yes "echo pipeline | ${stages} cat > /dev/null" | head -n "$n" \
+	> "$TMP/pipeline"
+report pipeline_64 "$TMP/pipeline" "$n"
+
+n=$((1000 / SCALE))
+body=$(yes ': heredoc body line with $HOME and $USER' | head -n 20)
+i=0
+while [ "$i" -lt "$n" ]; do
+	echo "cat << EOF > /dev/null"
+	echo "$body"
+	echo "EOF"
+	i=$((i + 1))
+done > "$TMP/heredoc"
+report heredoc_1k "$TMP/heredoc" "$n"
+
+n=$((20 / SCALE))
+args=$(seq 1 5000 | tr '\n' ' ')
+yes "/bin/echo $args > /dev/null" | head -n "$n" > "$TMP/argv"
+report argv_5k "$TMP/argv" "$n"
+
+rm -rf "$TMP"
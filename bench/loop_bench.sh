@@ -0,0 +1,41 @@
+#!/bin/sh
+# Compares a loop run from its parsed body against the same work fed to the
+# shell as one generated line per iteration.
+#
+# The loop is two nested `for` loops of SIDE words each, so the script text
+# stays short and the measured time is spent running iterations.
+#
+# usage: bench/loop_bench.sh [side] [path/to/minishell]
+
+SIDE=${1:-100}
+SHELL_BIN=${2:-./minishell}
+TMP=${TMPDIR:-/tmp}/minishell_loop_bench.$$
+N=$((SIDE * SIDE))
+
+elapsed_us()
+{
+	start=$(date +%s%N)
+	"$SHELL_BIN" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000 ))
+}
+
+words=$(seq 1 "$SIDE" | tr '\n' ' ')
+echo "for a in $words; do for b in $words; do : a b a b; done; done" \
+	> "$TMP.loop"
+for a in $words; do
+	for b in $words; do
+		echo ": a b a b"
+	done
+done > "$TMP.lines"
+: > "$TMP.empty"
+
+base=$(elapsed_us "$TMP.empty")
+lines=$(elapsed_us "$TMP.lines")
+loop=$(elapsed_us "$TMP.loop")
+rm -f "$TMP.loop" "$TMP.lines" "$TMP.empty"
+
+echo "iterations:          $N"
+echo "startup:             ${base} us"
+echo "line per iteration:  $(( (lines - base) * 1000 / N )) ns/iter"
+echo "for loop (AST):      $(( (loop - base) * 1000 / N )) ns/iter"
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   micro_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:12:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/16 10:12:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "micro_bench.h"
+#include <time.h>
+
+volatile sig_atomic_t	g_signal_received = 0;
+
+/**
+ * @brief Returns a monotonic clock reading in nanoseconds.
+ */
+long long	bench_clock_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+/**
+ * @brief Runs `run` in batches of doubling size until a batch takes at
+ * least `min_ms`, and prints the time per call of that batch.
+ *
+ * Output lines are `<name> <value> <unit>`, the format bench/compare.sh
+ * reads.
+ */
+static void	measure(const char *name, t_bench *b, t_bench_fn run, int min_ms)
+{
+	long long	iters;
+	long long	i;
+	long long	start;
+	long long	elapsed;
+
+	iters = 1;
+	elapsed = 0;
+	while (elapsed < min_ms * 1000000LL)
+	{
+		iters *= 2;
+		start = bench_clock_ns();
+		i = 0;
+		while (i++ < iters)
+			run(b);
+		elapsed = bench_clock_ns() - start;
+	}
+	printf("micro.%s.%d %lld ns/op\n", name, b->size, elapsed / iters);
+	fflush(stdout);
+}
+
+/**
+ * @brief Measures one case at sizes 10, 100 and 1000 (1, 10 and 100
+ * PATH entries for find_full_cmd_path, which calls access() per entry).
+ */
+static void	run_bench_case(const char *name, t_bench_fn setup,
+		t_bench_fn run, int min_ms)
+{
+	t_bench	b;
+	int		size;
+
+	size = 10;
+	if (setup == setup_path)
+		size = 1;
+	while (size <= 1000 && (setup != setup_path || size <= 100))
+	{
+		ft_bzero(&b, sizeof(t_bench));
+		b.size = size;
+		setup(&b);
+		measure(name, &b, run, min_ms);
+		free(b.input);
+		free(b.key);
+		free_split(b.path_dirs);
+		free_env(b.pd.env_list);
+		size *= 10;
+	}
+}
+
+/**
+ * @brief Entry point of the micro-benchmarks.
+ *
+ * usage: micro_bench [min_ms]
+ * Each measurement runs for at least `min_ms` milliseconds (BENCH_MIN_MS
+ * by default).
+ */
+int	main(int argc, char **argv)
+{
+	int	min_ms;
+
+	min_ms = BENCH_MIN_MS;
+	if (argc > 1 && ft_atoi(argv[1]) > 0)
+		min_ms = ft_atoi(argv[1]);
+	run_bench_case("parse_line", setup_parse, bench_parse_line, min_ms);
+	run_bench_case("expand_variables", setup_expand,
+		bench_expand_variables, min_ms);
+	run_bench_case("find_env_var", setup_env, bench_find_env_var, min_ms);
+	run_bench_case("find_full_cmd_path", setup_path,
+		bench_find_full_cmd_path, min_ms);
+	run_bench_case("env_list_to_array", setup_env,
+		bench_env_list_to_array, min_ms);
+	return (0);
+}
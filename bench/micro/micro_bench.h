@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   micro_bench.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:12:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/16 10:12:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MICRO_BENCH_H
+# define MICRO_BENCH_H
+
+# include "minishell.h"
+
+# define BENCH_MIN_MS 200
+
+/**
+ * @brief Struct holding the input of one micro-benchmark at one size.
+ *
+ * The setup function of a case fills the fields it needs; run_bench_case()
+ * frees them all once the size is measured.
+ */
+typedef struct s_bench
+{
+	t_process_data	pd;
+	char			*input;
+	char			**path_dirs;
+	char			*key;
+	int				size;
+}	t_bench;
+
+typedef void	(*t_bench_fn)(t_bench *b);
+
+// micro_bench.c
+long long	bench_clock_ns(void);
+
+// micro_setup.c
+void		setup_parse(t_bench *b);
+void		setup_expand(t_bench *b);
+void		setup_env(t_bench *b);
+void		setup_path(t_bench *b);
+
+// micro_cases.c
+void		bench_parse_line(t_bench *b);
+void		bench_expand_variables(t_bench *b);
+void		bench_find_env_var(t_bench *b);
+void		bench_find_full_cmd_path(t_bench *b);
+void		bench_env_list_to_array(t_bench *b);
+
+#endif
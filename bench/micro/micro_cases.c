@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   micro_cases.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:12:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/16 10:12:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "micro_bench.h"
+
+/**
+ * @brief Tokenizes the command line of setup_parse().
+ */
+void	bench_parse_line(t_bench *b)
+{
+	free_tokens(parse_line(b->input, &b->pd));
+}
+
+/**
+ * @brief Expands the word of setup_expand().
+ */
+void	bench_expand_variables(t_bench *b)
+{
+	free(expand_variables(b->input, &b->pd, NO_QUOTE));
+}
+
+/**
+ * @brief Looks up the last variable of the environment.
+ */
+void	bench_find_env_var(t_bench *b)
+{
+	if (find_env_var(b->key, b->pd.env_list) == NULL)
+		ft_error_and_exit("find_env_var", b->key, EXIT_FAILURE);
+}
+
+/**
+ * @brief Resolves `true` through the PATH of setup_path().
+ */
+void	bench_find_full_cmd_path(t_bench *b)
+{
+	free(find_full_cmd_path(b->key, b->path_dirs));
+}
+
+/**
+ * @brief Builds the envp array of the environment.
+ */
+void	bench_env_list_to_array(t_bench *b)
+{
+	free_split(env_list_to_array(b->pd.env_list));
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   micro_setup.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:12:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/16 10:12:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "micro_bench.h"
+
+/**
+ * @brief Repeats `unit` b->size times into b->input.
+ */
+static void	repeat_input(t_bench *b, const char *unit)
+{
+	size_t	len;
+	int		i;
+
+	len = ft_strlen(unit);
+	b->input = malloc(len * b->size + 1);
+	if (b->input == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	i = 0;
+	while (i < b->size)
+	{
+		ft_memcpy(b->input + len * i, unit, len);
+		i++;
+	}
+	b->input[len * b->size] = '\0';
+}
+
+/**
+ * @brief A command line of b->size groups of plain, double-quoted and
+ * single-quoted words.
+ */
+void	setup_parse(t_bench *b)
+{
+	repeat_input(b, "word \"dq $HOME\" 'sq w' ");
+}
+
+/**
+ * @brief A word with b->size variable references, in an environment
+ * holding b->size variables.
+ */
+void	setup_expand(t_bench *b)
+{
+	setup_env(b);
+	repeat_input(b, "$BENCH_0-");
+}
+
+/**
+ * @brief An environment of b->size variables BENCH_<i>, and the key of the
+ * last one, which find_env_var() has to walk the whole list to find.
+ */
+void	setup_env(t_bench *b)
+{
+	char	**entries;
+	char	*num;
+	char	*key;
+	int		i;
+
+	entries = ft_calloc(b->size + 1, sizeof(char *));
+	if (entries == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	i = 0;
+	while (i < b->size)
+	{
+		num = ft_itoa(i);
+		key = ft_strjoin("BENCH_", num);
+		entries[i] = ft_strjoin(key, "=some value");
+		free(key);
+		free(num);
+		i++;
+	}
+	b->pd.env_list = init_env(entries);
+	free_split(entries);
+	num = ft_itoa(b->size - 1);
+	b->key = ft_strjoin("BENCH_", num);
+	free(num);
+}
+
+/**
+ * @brief A PATH of b->size directories, only the last of which (/bin)
+ * holds `true`.
+ */
+void	setup_path(t_bench *b)
+{
+	char	*num;
+	int		i;
+
+	b->path_dirs = ft_calloc(b->size + 1, sizeof(char *));
+	if (b->path_dirs == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	i = 0;
+	while (i < b->size - 1)
+	{
+		num = ft_itoa(i);
+		b->path_dirs[i] = ft_strjoin("/nonexistent/bench/", num);
+		free(num);
+		i++;
+	}
+	b->path_dirs[i] = ft_strdup("/bin");
+	b->key = ft_strdup("true");
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Compares a `while read` loop over a regular file, which `read` consumes a
+# block at a time and hands back what it did not use with lseek(), with the
+# same loop over a pipe, where it has to read one byte per system call.
+#
+# usage: bench/read_bench.sh [lines] [path/to/minishell]
+
+LINES=${1:-20000}
+SHELL_BIN=${2:-./minishell}
+TMP=${TMPDIR:-/tmp}/minishell_read_bench.$$
+
+elapsed_us()
+{
+	start=$(date +%s%N)
+	"$SHELL_BIN" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000 ))
+}
+
+mkdir -p "$TMP"
+seq 1 "$LINES" | sed 's/$/ some words after the number/' > "$TMP/data"
+echo "while read n rest; do :; done < $TMP/data" > "$TMP/file"
+echo "cat $TMP/data | while read n rest; do :; done" > "$TMP/pipe"
+: > "$TMP/empty"
+
+base=$(elapsed_us "$TMP/empty")
+file=$(elapsed_us "$TMP/file")
+pipe=$(elapsed_us "$TMP/pipe")
+rm -rf "$TMP"
+
+echo "lines:               $LINES"
+echo "startup:             ${base} us"
+echo "file (buffered):     $(( (file - base) * 1000 / LINES )) ns/line"
+echo "pipe (byte reads):   $(( (pipe - base) * 1000 / LINES )) ns/line"
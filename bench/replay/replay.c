@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "replay.h"
+
+volatile sig_atomic_t	g_signal_received = 0;
+
+/**
+ * @brief Reads a whole log file into memory.
+ *
+ * @param path The file.
+ * @param log Receives the data and its length.
+ * @return 1 on success, 0 after reporting the error.
+ */
+int	read_log(const char *path, t_log *log)
+{
+	struct stat	st;
+	ssize_t		n;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1 || fstat(fd, &st) == -1)
+	{
+		ft_error_with_arg("replay", (char *)path, strerror(errno));
+		if (fd != -1)
+			close(fd);
+		return (0);
+	}
+	log->data = malloc(st.st_size + 1);
+	if (log->data == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	log->len = 0;
+	n = 1;
+	while (n > 0 && log->len < (size_t)st.st_size)
+	{
+		n = read(fd, log->data + log->len, st.st_size - log->len);
+		if (n > 0)
+			log->len += n;
+	}
+	close(fd);
+	return (1);
+}
+
+/**
+ * @brief Parses `[-n sessions] [-s speed] [-x shell] log`.
+ *
+ * @return The index of the log argument, or 0 on a usage error.
+ */
+static int	parse_options(int argc, char **argv, t_replay *r)
+{
+	int	i;
+
+	r->sessions = 1;
+	r->speed = 1;
+	r->shell = "./minishell";
+	i = 1;
+	while (i + 1 < argc && argv[i][0] == '-' && argv[i][1] != '\0'
+		&& argv[i][2] == '\0' && ft_strchr("nsx", argv[i][1]) != NULL)
+	{
+		if (argv[i][1] == 'n')
+			r->sessions = ft_atoi(argv[i + 1]);
+		else if (argv[i][1] == 's')
+			r->speed = strtod(argv[i + 1], NULL);
+		else
+			r->shell = argv[i + 1];
+		i += 2;
+	}
+	if (i + 1 != argc || r->sessions < 1 || r->speed < 0)
+	{
+		ft_putstr_fd("usage: replay_bench [-n sessions] [-s speed] "
+			"[-x shell] log\n", STDERR_FILENO);
+		return (0);
+	}
+	return (i);
+}
+
+/**
+ * @brief Starts one session in a process of its own.
+ *
+ * @param r The replay.
+ * @return The read end of the pipe the session sends its latencies on.
+ */
+static int	spawn_session(t_replay *r)
+{
+	int		fd[2];
+	pid_t	pid;
+
+	if (pipe(fd) == -1)
+		ft_error_and_exit("pipe", strerror(errno), EXIT_FAILURE);
+	pid = fork();
+	if (pid == -1)
+		ft_error_and_exit("fork", strerror(errno), EXIT_FAILURE);
+	if (pid == 0)
+	{
+		close(fd[0]);
+		run_session(r, fd[1]);
+		exit(0);
+	}
+	close(fd[1]);
+	return (fd[0]);
+}
+
+/**
+ * @brief Starts every session at once and waits for their results.
+ *
+ * Sessions send their latencies only once they are done, so collecting
+ * them never slows a session down.
+ *
+ * @param r The replay.
+ * @param lat Receives the latencies of all sessions.
+ */
+static void	run_sessions(t_replay *r, t_cmd_stats *lat)
+{
+	int	*fds;
+	int	i;
+
+	fds = malloc(sizeof(int) * r->sessions);
+	if (fds == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	i = 0;
+	while (i < r->sessions)
+	{
+		fds[i] = spawn_session(r);
+		i++;
+	}
+	while (i-- > 0)
+	{
+		collect_session(fds[i], lat);
+		close(fds[i]);
+	}
+	while (wait(NULL) > 0)
+		;
+	free(fds);
+}
+
+/**
+ * @brief Entry point of the session replayer.
+ *
+ * usage: replay_bench [-n sessions] [-s speed] [-x shell] log
+ * Replays a log written with MINISHELL_RECORD against `sessions` shells
+ * in parallel (1 by default), `speed` times faster than recorded (1 by
+ * default; 0 for no pauses), and reports throughput and latency.
+ */
+int	main(int argc, char **argv)
+{
+	t_replay	r;
+	t_cmd_stats	lat;
+	long long	start;
+	int			arg;
+
+	ft_bzero(&r, sizeof(t_replay));
+	ft_bzero(&lat, sizeof(t_cmd_stats));
+	arg = parse_options(argc, argv, &r);
+	if (arg == 0)
+		return (2);
+	if (!load_replay_log(argv[arg], &r))
+		return (1);
+	start = replay_clock_us();
+	run_sessions(&r, &lat);
+	print_replay_report(&r, &lat, replay_clock_us() - start);
+	return (lat.calls == 0);
+}
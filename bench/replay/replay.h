@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef REPLAY_H
+# define REPLAY_H
+
+# include "minishell.h"
+
+# define REPLAY_MARK '\036'
+# define REPLAY_CHUNK 4096
+# define REPLAY_TIMEOUT_MS 10000
+
+/** @brief One command line of a recorded session.
+ */
+typedef struct s_replay_cmd
+{
+	long long	offset_us;
+	char		*line;
+}	t_replay_cmd;
+
+/** @brief A session log being decoded.
+ */
+typedef struct s_log
+{
+	char	*data;
+	size_t	len;
+	size_t	pos;
+}	t_log;
+
+/** @brief One replayed session: its shell, the pipes to and from it, and
+ * the latency of each line so far.
+ */
+typedef struct s_session
+{
+	pid_t		pid;
+	int			to_shell;
+	int			from_shell;
+	long long	start_us;
+	long long	*lat;
+}	t_session;
+
+/**
+ * @brief Struct holding a recorded session and how to replay it.
+ *
+ * `pd` only holds the starting environment of the log while it is
+ * decoded; `envp` is that environment, as passed to every shell.
+ * `speed` divides the recorded gaps between lines (0 sends each line as
+ * soon as the one before has finished).
+ */
+typedef struct s_replay
+{
+	t_process_data	pd;
+	char			**envp;
+	t_replay_cmd	*cmds;
+	int				count;
+	int				cap;
+	int				sessions;
+	double			speed;
+	char			*shell;
+}	t_replay;
+
+// replay.c
+int			read_log(const char *path, t_log *log);
+
+// replay_log.c
+int			load_replay_log(const char *path, t_replay *r);
+
+// replay_session.c
+void		run_session(t_replay *r, int result_fd);
+
+// replay_report.c
+long long	replay_clock_us(void);
+void		sleep_until(long long when_us);
+void		send_results(int fd, long long *lat, int count);
+void		collect_session(int fd, t_cmd_stats *lat);
+void		print_replay_report(t_replay *r, t_cmd_stats *lat,
+				long long wall_us);
+
+#endif
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_log.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "replay.h"
+
+/**
+ * @brief Decodes an LEB128 varint of the log (see record.h).
+ *
+ * @param log The log; its position moves past the varint.
+ * @param out Receives the value.
+ * @return 1 on success, 0 if the log ends inside the varint.
+ */
+static int	get_varint(t_log *log, unsigned long long *out)
+{
+	int				shift;
+	unsigned char	byte;
+
+	*out = 0;
+	shift = 0;
+	while (log->pos < log->len && shift < 64)
+	{
+		byte = (unsigned char)log->data[log->pos++];
+		*out |= (unsigned long long)(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+			return (1);
+		shift += 7;
+	}
+	return (0);
+}
+
+/**
+ * @brief Decodes a string of the log into a new allocation.
+ *
+ * @param log The log; its position moves past the string.
+ * @return The string, or NULL if the log is truncated.
+ */
+static char	*get_string(t_log *log)
+{
+	unsigned long long	n;
+	char				*str;
+
+	if (!get_varint(log, &n) || n > log->len - log->pos)
+		return (NULL);
+	str = ft_strndup(log->data + log->pos, n);
+	if (str == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	log->pos += n;
+	return (str);
+}
+
+/**
+ * @brief Decodes a RECORD_CMD entry and adds its line to the session.
+ *
+ * The duration and exit status of the recorded run are not needed to
+ * replay it.
+ *
+ * @return 1 on success, 0 if the log is truncated.
+ */
+static int	add_cmd(t_log *log, t_replay *r)
+{
+	unsigned long long	v[3];
+	t_replay_cmd		*grown;
+
+	if (!get_varint(log, &v[0]) || !get_varint(log, &v[1])
+		|| !get_varint(log, &v[2]))
+		return (0);
+	if (r->count == r->cap)
+	{
+		r->cap = r->cap * 2 + 16;
+		grown = malloc(sizeof(t_replay_cmd) * r->cap);
+		if (grown == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		if (r->count > 0)
+			ft_memcpy(grown, r->cmds, sizeof(t_replay_cmd) * r->count);
+		free(r->cmds);
+		r->cmds = grown;
+	}
+	r->cmds[r->count].offset_us = (long long)v[0];
+	r->cmds[r->count].line = get_string(log);
+	if (r->cmds[r->count].line == NULL)
+		return (0);
+	r->count++;
+	return (1);
+}
+
+/**
+ * @brief Decodes one entry of the log.
+ *
+ * RECORD_SET entries before the first command line build the starting
+ * environment. Later ones, and RECORD_UNSET entries, are what the
+ * recorded commands did to it; the replayed commands do the same, so
+ * they are skipped.
+ *
+ * @return 1 on success, 0 on a truncated or unknown entry.
+ */
+static int	get_entry(t_log *log, t_replay *r)
+{
+	char	tag;
+	char	*key;
+	char	*value;
+
+	tag = log->data[log->pos++];
+	if (tag == RECORD_CMD)
+		return (add_cmd(log, r));
+	if (tag != RECORD_SET && tag != RECORD_UNSET)
+		return (0);
+	key = get_string(log);
+	value = NULL;
+	if (key != NULL && tag == RECORD_SET)
+		value = get_string(log);
+	if (value != NULL && r->count == 0)
+		set_shell_var(key, value, &r->pd);
+	free(key);
+	free(value);
+	return (key != NULL && (tag == RECORD_UNSET || value != NULL));
+}
+
+/**
+ * @brief Loads a session log written by MINISHELL_RECORD.
+ *
+ * @param path The log file.
+ * @param r Receives the command lines and the starting environment.
+ * @return 1 on success, 0 after reporting an unreadable or corrupt log.
+ */
+int	load_replay_log(const char *path, t_replay *r)
+{
+	t_log	log;
+
+	if (!read_log(path, &log))
+		return (0);
+	log.pos = RECORD_MAGIC_LEN;
+	if (log.len < RECORD_MAGIC_LEN
+		|| ft_memcmp(log.data, RECORD_MAGIC, RECORD_MAGIC_LEN) != 0)
+	{
+		ft_error_with_arg("replay", (char *)path, "not a session log");
+		log.pos = log.len;
+	}
+	while (log.pos < log.len)
+	{
+		if (!get_entry(&log, r))
+		{
+			ft_error_with_arg("replay", (char *)path, "corrupt session log");
+			break ;
+		}
+	}
+	free(log.data);
+	r->envp = env_list_to_array(r->pd.env_list);
+	if (r->envp == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (r->count > 0);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "replay.h"
+#include <time.h>
+
+/**
+ * @brief Returns a monotonic clock reading in microseconds.
+ */
+long long	replay_clock_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief Sleeps until the clock of replay_clock_us() reaches `when_us`.
+ */
+void	sleep_until(long long when_us)
+{
+	long long	left;
+
+	left = when_us - replay_clock_us();
+	while (left > 0)
+	{
+		if (left > 1000000)
+			usleep(1000000);
+		else
+			usleep((useconds_t)left);
+		left = when_us - replay_clock_us();
+	}
+}
+
+/**
+ * @brief Sends the latencies of a finished session to the parent: their
+ * count, then the values.
+ */
+void	send_results(int fd, long long *lat, int count)
+{
+	size_t	done;
+	ssize_t	n;
+
+	if (write(fd, &count, sizeof(int)) != sizeof(int))
+		return ;
+	done = 0;
+	while (done < sizeof(long long) * count)
+	{
+		n = write(fd, (char *)lat + done, sizeof(long long) * count - done);
+		if (n <= 0)
+			return ;
+		done += (size_t)n;
+	}
+}
+
+/**
+ * @brief Reads the latencies sent by one session into the histogram.
+ *
+ * @param fd The read end of the session's result pipe.
+ * @param lat The histogram of all sessions; calls, total and max too.
+ */
+void	collect_session(int fd, t_cmd_stats *lat)
+{
+	long long	value;
+	int			count;
+
+	if (read(fd, &count, sizeof(int)) != sizeof(int))
+		return ;
+	while (count-- > 0
+		&& read(fd, &value, sizeof(long long)) == sizeof(long long))
+	{
+		stats_hist_add(lat, (unsigned long long)value);
+		lat->calls++;
+		lat->total_us += value;
+		if ((unsigned long long)value > lat->max_us)
+			lat->max_us = value;
+	}
+}
+
+/**
+ * @brief Prints the results of the replay.
+ *
+ * The summary, with the throughput, goes to stderr. stdout gets
+ * `<name> <value> <unit>` lines in the format of `make bench`, all of
+ * them lower-is-better, so bench/compare.sh can diff two runs.
+ *
+ * @param r The replay.
+ * @param lat The latencies of every line replayed.
+ * @param wall_us The time from starting the first session to the end of
+ *                the last.
+ */
+void	print_replay_report(t_replay *r, t_cmd_stats *lat, long long wall_us)
+{
+	double	secs;
+
+	secs = wall_us / 1e6;
+	fprintf(stderr, "replay: %d session(s) of %d line(s): %lu lines in "
+		"%.3f s, %.1f lines/s\n", r->sessions, r->count, lat->calls, secs,
+		lat->calls / (secs + 1e-9));
+	if (lat->calls == 0)
+		return ;
+	printf("replay.wall_per_line %.1f us/line\n",
+		(double)wall_us / lat->calls);
+	printf("replay.latency.mean %.1f us\n",
+		(double)lat->total_us / lat->calls);
+	printf("replay.latency.p50 %llu us\n", stats_percentile(lat, 500));
+	printf("replay.latency.p90 %llu us\n", stats_percentile(lat, 900));
+	printf("replay.latency.p99 %llu us\n", stats_percentile(lat, 990));
+	printf("replay.latency.max %llu us\n", lat->max_us);
+}
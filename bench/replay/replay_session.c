@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_session.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "replay.h"
+#include <poll.h>
+
+/**
+ * @brief Replaces the forked child with the shell under test, reading
+ * the session from one pipe and writing its output to the other.
+ *
+ * Error messages of the shell go to /dev/null.
+ */
+static void	exec_shell(t_replay *r, int in[2], int out[2])
+{
+	char	*argv[2];
+	int		null_fd;
+
+	dup2(in[0], STDIN_FILENO);
+	dup2(out[1], STDOUT_FILENO);
+	null_fd = open("/dev/null", O_WRONLY);
+	if (null_fd >= 0)
+		dup2(null_fd, STDERR_FILENO);
+	if (null_fd > STDERR_FILENO)
+		close(null_fd);
+	close(in[0]);
+	close(in[1]);
+	close(out[0]);
+	close(out[1]);
+	argv[0] = r->shell;
+	argv[1] = NULL;
+	execve(r->shell, argv, r->envp);
+	ft_error_and_exit(r->shell, strerror(errno), 127);
+}
+
+/**
+ * @brief Starts a shell for one session.
+ *
+ * @param r The replay.
+ * @param s Receives the pid of the shell, the pipes to and from it, the
+ *          start time and room for the latencies.
+ */
+static void	start_session(t_replay *r, t_session *s)
+{
+	int	in[2];
+	int	out[2];
+
+	s->lat = malloc(sizeof(long long) * r->count);
+	if (s->lat == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (pipe(in) == -1 || pipe(out) == -1)
+		ft_error_and_exit("pipe", strerror(errno), EXIT_FAILURE);
+	s->pid = fork();
+	if (s->pid == -1)
+		ft_error_and_exit("fork", strerror(errno), EXIT_FAILURE);
+	if (s->pid == 0)
+		exec_shell(r, in, out);
+	close(in[0]);
+	close(out[1]);
+	s->to_shell = in[1];
+	s->from_shell = out[0];
+	s->start_us = replay_clock_us();
+}
+
+/**
+ * @brief Sends a command line, followed by a command that echoes
+ * REPLAY_MARK once the line has finished.
+ *
+ * @return 1 on success, 0 if the shell is gone.
+ */
+static int	send_line(int fd, const char *line)
+{
+	static const char	mark[] = {'\n', 'e', 'c', 'h', 'o', ' ',
+		REPLAY_MARK, '\n'};
+
+	if (write(fd, line, ft_strlen(line)) < 0)
+		return (0);
+	return (write(fd, mark, sizeof(mark)) == sizeof(mark));
+}
+
+/**
+ * @brief Reads the output of the shell up to the next REPLAY_MARK.
+ *
+ * A line that reads standard input swallows the rest of the session,
+ * mark included, so a shell that stays silent for REPLAY_TIMEOUT_MS is
+ * given up on.
+ *
+ * @return 1 once the mark is seen, 0 if the shell exits or times out.
+ */
+static int	wait_for_mark(int fd)
+{
+	struct pollfd	pfd;
+	char			buf[REPLAY_CHUNK];
+	ssize_t			n;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	n = 1;
+	while (n != 0)
+	{
+		if (poll(&pfd, 1, REPLAY_TIMEOUT_MS) == 0)
+		{
+			ft_error("replay", "no answer from the shell; session ended");
+			return (0);
+		}
+		n = read(fd, buf, sizeof(buf));
+		if (n == -1 && errno != EINTR)
+			return (0);
+		if (n > 0 && ft_memchr(buf, REPLAY_MARK, n) != NULL)
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Replays the session against a shell of its own and sends the
+ * latency of every line to `result_fd`.
+ *
+ * Line `i` is sent at its recorded offset divided by the speed, or at
+ * once if the shell is still busy. Its latency runs from sending it to
+ * seeing the mark that follows it. A line that makes the shell exit, or
+ * never finishes, ends the session.
+ *
+ * @param r The replay.
+ * @param result_fd Where to send the latencies; see send_results().
+ */
+void	run_session(t_replay *r, int result_fd)
+{
+	t_session	s;
+	long long	sent;
+	int			i;
+
+	signal(SIGPIPE, SIG_IGN);
+	start_session(r, &s);
+	i = 0;
+	while (i < r->count)
+	{
+		if (r->speed > 0)
+			sleep_until(s.start_us + (long long)(r->cmds[i].offset_us
+					/ r->speed));
+		sent = replay_clock_us();
+		if (!send_line(s.to_shell, r->cmds[i].line)
+			|| !wait_for_mark(s.from_shell))
+			break ;
+		s.lat[i++] = replay_clock_us() - sent;
+	}
+	close(s.to_shell);
+	close(s.from_shell);
+	waitpid(s.pid, NULL, 0);
+	send_results(result_fd, s.lat, i);
+	free(s.lat);
+}
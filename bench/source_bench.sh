@@ -0,0 +1,43 @@
+#!/bin/sh
+# Compares sourcing an unchanged helper file again, which is served from
+# the parsed-script cache after one stat(), with sourcing files that were
+# never seen before, which are mapped and parsed each time.
+#
+# The helper file defines FUNCS small functions.
+#
+# usage: bench/source_bench.sh [count] [funcs] [path/to/minishell]
+
+COUNT=${1:-200}
+FUNCS=${2:-100}
+SHELL_BIN=${3:-./minishell}
+TMP=${TMPDIR:-/tmp}/minishell_source_bench.$$
+
+elapsed_us()
+{
+	start=$(date +%s%N)
+	"$SHELL_BIN" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000 ))
+}
+
+mkdir -p "$TMP"
+for f in $(seq 1 "$FUNCS"); do
+	printf 'helper_%s() {\n\tif [ -n "$1" ]; then\n\t\techo "$1"\n\tfi\n}\n' "$f"
+done > "$TMP/lib.sh"
+runs=$(seq 1 "$COUNT" | tr '\n' ' ')
+echo "for i in $runs; do source $TMP/lib.sh; done" > "$TMP/cached"
+for i in $runs; do
+	cp "$TMP/lib.sh" "$TMP/lib_$i.sh"
+	echo "source $TMP/lib_$i.sh"
+done > "$TMP/fresh"
+: > "$TMP/empty"
+
+base=$(elapsed_us "$TMP/empty")
+cached=$(elapsed_us "$TMP/cached")
+fresh=$(elapsed_us "$TMP/fresh")
+rm -rf "$TMP"
+
+echo "sources:             $COUNT of $FUNCS functions"
+echo "startup:             ${base} us"
+echo "first parse:         $(( (fresh - base) / COUNT )) us/source"
+echo "cached:              $(( (cached - base) / COUNT )) us/source"
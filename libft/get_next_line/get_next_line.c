@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/05 15:56:46 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/09 13:26:28 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,33 +20,63 @@ and returns the extracted line.
 This process repeats on each call of get_next_line, returning one line at a time
 while handling partial reads and leftover data with the "leftover" buffer. */
 
-char	*get_next_line(int fd)
+static char	**gnl_storage(void)
 {
 	static char	*storage = NULL;
+
+	return (&storage);
+}
+
+char	*get_next_line(int fd)
+{
+	char		**storage;
 	char		*read_buffer;
 	ssize_t		bytes_read;
 
 	if (fd < 0 || BUFFER_SIZE <= 0)
 		return (NULL);
+	storage = gnl_storage();
 	read_buffer = malloc(sizeof(char) * (BUFFER_SIZE + 1));
 	if (!read_buffer)
 		return (NULL);
-	while (!gnl_ft_strchr(storage, '\n'))
+	bytes_read = 1;
+	while (bytes_read > 0 && !gnl_ft_strchr(*storage, '\n'))
 	{
 		bytes_read = read(fd, read_buffer, BUFFER_SIZE);
 		if (bytes_read < 0)
-			return (free(read_buffer), free(storage), storage = NULL, NULL);
-		if (bytes_read == 0)
-			break ;
+			return (free(read_buffer), free(*storage), *storage = NULL, NULL);
 		read_buffer[bytes_read] = '\0';
-		storage = gnl_ft_strjoin(storage, read_buffer);
-		if (!storage)
+		*storage = gnl_ft_strjoin(*storage, read_buffer);
+		if (!*storage)
 			return (free(read_buffer), NULL);
 	}
 	free(read_buffer);
-	if (!storage || *storage == '\0')
-		return (free(storage), storage = NULL, NULL);
-	return (extract_line_and_update_storage(&storage));
+	if (!*storage || **storage == '\0')
+		return (free(*storage), *storage = NULL, NULL);
+	return (extract_line_and_update_storage(storage));
+}
+
+/* get_next_line_getc takes the first byte of what get_next_line has read
+past the last line it returned, for a caller that goes on reading the same
+input byte by byte. It returns 1 with the byte in c, or 0 if nothing was
+read ahead. */
+
+int	get_next_line_getc(char *c)
+{
+	char	*storage;
+	size_t	i;
+
+	storage = *gnl_storage();
+	if (storage == NULL || storage[0] == '\0')
+		return (0);
+	*c = storage[0];
+	i = 0;
+	while (storage[i] != '\0')
+	{
+		storage[i] = storage[i + 1];
+		i++;
+	}
+	return (1);
 }
 
 void	get_next_line_cleanup(void)
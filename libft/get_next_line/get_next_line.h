@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/05 15:56:50 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/09 09:39:34 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,6 +30,7 @@ char	*gnl_ft_strjoin(char *s1, char const *s2);
 char	*gnl_ft_substr(char const *s, unsigned int start, size_t len);
 char	*extract_line_and_update_storage(char **storage);
 char	*get_next_line(int fd);
+int		get_next_line_getc(char *c);
 void	get_next_line_cleanup(void);
 
 #endif
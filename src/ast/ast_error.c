@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_error.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Measures the token to quote in a syntax error message.
+ *
+ * @param p The script parser state.
+ * @return The length of the word or operator at the cursor.
+ */
+static size_t	unexpected_token_len(t_script_parser *p)
+{
+	const char	*s;
+	size_t		len;
+
+	s = p->text + p->pos;
+	len = sp_word_len(p);
+	if (len > 0)
+		return (len);
+	if ((s[0] == ';' || s[0] == '&' || s[0] == '|') && s[1] == s[0])
+		return (2);
+	return (1);
+}
+
+/**
+ * @brief Reports an unexpected token and marks the parse as failed.
+ *
+ * @param p The script parser state.
+ * @param token The offending token, printed between backticks.
+ */
+void	sp_unexpected(t_script_parser *p, const char *token)
+{
+	char	*tmp;
+	char	*msg;
+
+	if (p->status != AST_OK)
+		return ;
+	p->status = AST_ERROR;
+	if (p->pd)
+		p->pd->last_exit_status = 2;
+	tmp = ft_strjoin("syntax error near unexpected token `", token);
+	if (tmp == NULL)
+		return ;
+	msg = ft_strjoin(tmp, "'");
+	free(tmp);
+	if (msg == NULL)
+		return ;
+	ft_error(NULL, msg);
+	free(msg);
+}
+
+/**
+ * @brief Reports a syntax error on the token at the cursor.
+ *
+ * When nothing but blanks and newlines is left, the script is not wrong
+ * but unfinished; it is marked incomplete so the caller can read more.
+ * Does nothing if an earlier error was already recorded.
+ *
+ * @param p The script parser state.
+ */
+void	sp_syntax_error(t_script_parser *p)
+{
+	char	*token;
+
+	if (p->status != AST_OK)
+		return ;
+	sp_skip_newlines(p);
+	if (p->text[p->pos] == '\0')
+	{
+		p->status = AST_INCOMPLETE;
+		return ;
+	}
+	token = ft_substr(p->text, p->pos, unexpected_token_len(p));
+	if (token == NULL)
+	{
+		p->status = AST_ERROR;
+		return ;
+	}
+	sp_unexpected(p, token);
+	free(token);
+}
+
+/**
+ * @brief Marks the parse as failed unless a reason was already recorded.
+ *
+ * Used on allocation failures so a NULL node is never mistaken for an
+ * empty list.
+ *
+ * @param p The script parser state.
+ * @return Always NULL, so it can end a node-returning function.
+ */
+void	*sp_fail(t_script_parser *p)
+{
+	if (p->status == AST_OK)
+		p->status = AST_ERROR;
+	return (NULL);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_exec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks whether the last command was interrupted by Ctrl-C.
+ *
+ * @param status The exit status of the last executed node.
+ * @return 1 if execution of the script must stop, 0 otherwise.
+ */
+int	ast_interrupted(int status)
+{
+	return (status == 128 + SIGINT || g_signal_received == SIGINT);
+}
+
+/**
+ * @brief Runs a node according to its type, ignoring its redirections.
+ *
+ * @param node The node to run.
+ * @param pd The process data.
+ * @return The exit status of the node.
+ */
+static int	dispatch_node(t_ast_node *node, t_process_data *pd)
+{
+	if (node->type == NODE_SIMPLE)
+		return (execute_tokens(node->words, pd->env_list, pd));
+	if (node->type == NODE_PIPELINE)
+		return (execute_pipeline_node(node, pd));
+	if (node->type == NODE_IF)
+		return (execute_if(node, pd));
+	if (node->type == NODE_FOR)
+		return (execute_for(node, pd));
+	if (node->type == NODE_CASE)
+		return (execute_case(node, pd));
+	if (node->type == NODE_GROUP)
+		return (execute_ast(node->body, pd));
+	if (node->type == NODE_FUNCDEF)
+		return (define_function(node, pd));
+	return (execute_loop(node, pd));
+}
+
+/**
+ * @brief Runs a compound command with its trailing redirections applied.
+ *
+ * The redirection tokens are expanded and opened on every run, then the
+ * standard descriptors are swapped in the shell itself for the duration
+ * of the command, as is done for builtins.
+ *
+ * @param node The compound command node.
+ * @param pd The process data.
+ * @return The exit status of the command, or 1 on a redirection error.
+ */
+static int	execute_with_redirs(t_ast_node *node, t_process_data *pd)
+{
+	t_execute_data	data;
+	char			**args;
+	int				redirects_input;
+	int				status;
+
+	ft_bzero(&data, sizeof(t_execute_data));
+	args = expand_and_split_args(node->redirs, pd);
+	if (args == NULL)
+		return (1);
+	pd->in_pipeline = 0;
+	data.clean_args = handle_redirection(args, pd, &data);
+	free_split(args);
+	if (data.clean_args == NULL)
+		return (free_execute_data(&data), 1);
+	redirects_input = fd_ops_redirect(data.fd_ops, STDIN_FILENO);
+	if (redirects_input)
+		sync_read_buffer(pd);
+	status = setup_builtin_io(&data);
+	if (status == 0)
+		status = dispatch_node(node, pd);
+	if (redirects_input)
+		sync_read_buffer(pd);
+	restore_builtin_io(&data);
+	free_execute_data(&data);
+	return (status);
+}
+
+/**
+ * @brief Runs a single node and records its exit status.
+ *
+ * A node prefixed with `time` is measured from before its redirections
+ * are opened to after they are closed, and reported once it is done.
+ * A `pipesize` prefix holds for every pipe created while the node runs.
+ * Its heredocs replay the bodies read with it (see sp_take_heredocs()).
+ *
+ * @param node The node to run.
+ * @param pd The process data.
+ * @return The exit status of the node, inverted if it is negated with `!`.
+ */
+int	execute_ast_node(t_ast_node *node, t_process_data *pd)
+{
+	t_timing	*timing;
+	long		saved_hint;
+	int			status;
+
+	timing = NULL;
+	if (node->timed)
+		timing = start_timing(node, pd);
+	saved_hint = pd->pipe_size_hint;
+	if (node->pipe_size != 0)
+		pd->pipe_size_hint = node->pipe_size;
+	pd->heredocs = node->heredocs;
+	if (node->redirs != NULL)
+		status = execute_with_redirs(node, pd);
+	else
+		status = dispatch_node(node, pd);
+	pd->heredocs = NULL;
+	pd->pipe_size_hint = saved_hint;
+	if (timing != NULL)
+		finish_timing(timing, pd);
+	if (node->negate)
+		status = (status == 0);
+	pd->last_exit_status = status;
+	return (status);
+}
+
+/**
+ * @brief Runs a list of nodes, honouring `&&` and `||` connectors.
+ *
+ * A node is skipped when it follows `&&` after a failure or `||` after a
+ * success. The list stops early on Ctrl-C or on `break`/`continue`/`return`.
+ *
+ * @param list The first node of the list (can be NULL).
+ * @param pd The process data.
+ * @return The exit status of the last node that ran, or 0.
+ */
+int	execute_ast(t_ast_node *list, t_process_data *pd)
+{
+	int			status;
+	t_connector	prev;
+
+	status = 0;
+	prev = CONN_SEQ;
+	while (list != NULL && pd->loop_ctl == LOOP_NONE)
+	{
+		if (!(prev == CONN_AND && status != 0)
+			&& !(prev == CONN_OR && status == 0))
+			status = execute_ast_node(list, pd);
+		if (ast_interrupted(status))
+			break ;
+		prev = list->connector;
+		list = list->next;
+	}
+	return (status);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_exec_case.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/11 12:48:21 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <fnmatch.h>
+
+/**
+ * @brief Expands a word to a single string without word splitting.
+ *
+ * @param token The word to expand.
+ * @param pd The process data.
+ * @return The expanded, unquoted string, or NULL on allocation failure.
+ */
+static char	*expand_case_word(t_token *token, t_process_data *pd)
+{
+	char	*expanded;
+	char	*result;
+
+	expanded = expand_variables(token->value, pd, token->quote);
+	if (expanded == NULL)
+		return (NULL);
+	result = remove_quotes_and_join(expanded);
+	free(expanded);
+	return (result);
+}
+
+/**
+ * @brief Copies one pattern character, escaping it if it was quoted.
+ *
+ * @param glob The pattern being built.
+ * @param j The current write index in `glob`.
+ * @param c The character to copy.
+ * @param quote The quote character `c` was found in, or 0.
+ * @return The new write index.
+ */
+static size_t	put_glob_char(char *glob, size_t j, char c, char quote)
+{
+	if (quote && ft_strchr("*?[]\\", c))
+		glob[j++] = '\\';
+	glob[j++] = c;
+	return (j);
+}
+
+/**
+ * @brief Turns an expanded pattern into an fnmatch() pattern.
+ *
+ * Quotes are removed; glob characters that were inside quotes are escaped
+ * so they match literally, as in `case $x in "*") ...`.
+ *
+ * @param s The expanded pattern, still holding its quotes.
+ * @return The fnmatch() pattern, or NULL on allocation failure.
+ */
+static char	*build_glob(const char *s)
+{
+	char	*glob;
+	size_t	i;
+	size_t	j;
+	char	quote;
+
+	glob = malloc(ft_strlen(s) * 2 + 1);
+	if (glob == NULL)
+		return (NULL);
+	i = 0;
+	j = 0;
+	quote = 0;
+	while (s[i] != '\0')
+	{
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		else
+			j = put_glob_char(glob, j, s[i], quote);
+		i++;
+	}
+	glob[j] = '\0';
+	return (glob);
+}
+
+/**
+ * @brief Checks whether a case pattern matches the subject.
+ *
+ * @param pattern The pattern token, expanded here on every run.
+ * @param subject The expanded case subject.
+ * @param pd The process data.
+ * @return 1 if the pattern matches, 0 otherwise.
+ */
+static int	pattern_matches(t_token *pattern, const char *subject,
+				t_process_data *pd)
+{
+	char	*expanded;
+	char	*glob;
+	int		match;
+
+	expanded = expand_variables(pattern->value, pd, pattern->quote);
+	if (expanded == NULL)
+		return (0);
+	glob = build_glob(expanded);
+	free(expanded);
+	if (glob == NULL)
+		return (0);
+	match = (fnmatch(glob, subject, 0) == 0);
+	free(glob);
+	return (match);
+}
+
+/**
+ * @brief Runs a case command: the body of the first matching arm.
+ *
+ * @param node The NODE_CASE node.
+ * @param pd The process data.
+ * @return The status of the body that ran, or 0 if no pattern matched.
+ */
+int	execute_case(t_ast_node *node, t_process_data *pd)
+{
+	char		*subject;
+	t_case_item	*item;
+	int			i;
+
+	subject = expand_case_word(node->words[0], pd);
+	if (subject == NULL)
+		return (1);
+	item = node->items;
+	while (item != NULL)
+	{
+		i = 0;
+		while (item->patterns[i] != NULL)
+		{
+			if (pattern_matches(item->patterns[i], subject, pd))
+			{
+				free(subject);
+				return (execute_ast(item->body, pd));
+			}
+			i++;
+		}
+		item = item->next;
+	}
+	free(subject);
+	return (0);
+}
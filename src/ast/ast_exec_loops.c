@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_exec_loops.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/11 12:48:21 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Decides whether a loop must stop after running one of its lists.
+ *
+ * A pending `break N` or `continue N` aimed at an outer loop is passed on
+ * by leaving `loop_ctl` set; one aimed at this loop is consumed here. A
+ * `return` leaves every loop of the function and is consumed by the call.
+ *
+ * @param pd The process data.
+ * @param status The exit status of the list that just ran.
+ * @return 1 if the loop must stop, 0 if it goes on.
+ */
+int	loop_should_stop(t_process_data *pd, int status)
+{
+	if (ast_interrupted(status))
+		return (1);
+	if (pd->loop_ctl == LOOP_NONE)
+		return (0);
+	if (pd->loop_ctl == LOOP_RETURN)
+		return (1);
+	if (pd->loop_levels > 1)
+	{
+		pd->loop_levels--;
+		return (1);
+	}
+	if (pd->loop_ctl == LOOP_BREAK)
+	{
+		pd->loop_ctl = LOOP_NONE;
+		return (1);
+	}
+	pd->loop_ctl = LOOP_NONE;
+	return (0);
+}
+
+/**
+ * @brief Runs an if command.
+ *
+ * @param node The NODE_IF node; `alt` holds the elif clause or else list.
+ * @param pd The process data.
+ * @return The status of the branch that ran, or 0 if none did.
+ */
+int	execute_if(t_ast_node *node, t_process_data *pd)
+{
+	int	cond;
+
+	cond = execute_ast(node->cond, pd);
+	if (ast_interrupted(cond) || pd->loop_ctl != LOOP_NONE)
+		return (cond);
+	if (cond == 0)
+		return (execute_ast(node->body, pd));
+	if (node->alt != NULL)
+		return (execute_ast(node->alt, pd));
+	return (0);
+}
+
+/**
+ * @brief Runs a while or until loop.
+ *
+ * @param node The NODE_WHILE or NODE_UNTIL node.
+ * @param pd The process data.
+ * @return The status of the last body run, or 0 if the body never ran.
+ */
+int	execute_loop(t_ast_node *node, t_process_data *pd)
+{
+	int	status;
+	int	cond;
+
+	status = 0;
+	pd->loop_depth++;
+	while (1)
+	{
+		cond = execute_ast(node->cond, pd);
+		if (loop_should_stop(pd, cond))
+			break ;
+		if ((cond == 0) != (node->type == NODE_WHILE))
+			break ;
+		status = execute_ast(node->body, pd);
+		if (loop_should_stop(pd, status))
+			break ;
+	}
+	pd->loop_depth--;
+	if (ast_interrupted(cond) || ast_interrupted(status))
+		return (128 + SIGINT);
+	return (status);
+}
+
+/**
+ * @brief Runs a for loop, assigning each expanded word to the variable.
+ *
+ * @param node The NODE_FOR node.
+ * @param pd The process data.
+ * @return The status of the last body run, or 0 if the body never ran.
+ */
+int	execute_for(t_ast_node *node, t_process_data *pd)
+{
+	char	**values;
+	int		status;
+	int		i;
+
+	if (node->words == NULL || node->words[0] == NULL)
+		return (0);
+	values = expand_and_split_args(node->words, pd);
+	if (values == NULL)
+		return (pd->syntax_error);
+	status = 0;
+	i = 0;
+	pd->loop_depth++;
+	while (values[i] != NULL)
+	{
+		set_shell_var(node->name, values[i], pd);
+		status = execute_ast(node->body, pd);
+		if (loop_should_stop(pd, status))
+			break ;
+		i++;
+	}
+	pd->loop_depth--;
+	free_split(values);
+	return (status);
+}
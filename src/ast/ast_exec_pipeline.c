@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_exec_pipeline.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include "../../libft/get_next_line/get_next_line.h"
+
+/**
+ * @brief Builds the t_command for one stage of a parsed pipeline.
+ *
+ * Simple stages are expanded now, like any pipeline command. Compound
+ * stages are only wrapped: the child process runs the node itself.
+ *
+ * @param stage The stage node.
+ * @param pd The process data, with `path_dirs` already filled in.
+ * @return The command, or NULL on error.
+ */
+static t_command	*build_stage(t_ast_node *stage, t_process_data *pd)
+{
+	t_command	*cmd;
+	char		**args;
+
+	if (stage->type != NODE_SIMPLE)
+	{
+		cmd = create_empty_command();
+		if (cmd != NULL)
+			cmd->node = stage;
+		return (cmd);
+	}
+	args = expand_and_split_args(stage->words, pd);
+	if (args == NULL && pd->syntax_error)
+		return (NULL);
+	if (args == NULL || args[0] == NULL)
+		return (free_split(args), create_empty_command());
+	pd->heredocs = stage->heredocs;
+	cmd = create_command(args, pd->path_dirs, pd);
+	pd->heredocs = NULL;
+	free_split(args);
+	return (cmd);
+}
+
+/**
+ * @brief Builds the command array for every stage of a pipeline node.
+ *
+ * @param node The NODE_PIPELINE node.
+ * @param pd The process data receiving `cmds`.
+ * @return 1 on success, 0 on error.
+ */
+static int	build_stages(t_ast_node *node, t_process_data *pd)
+{
+	int	i;
+
+	i = 0;
+	while (i < node->stage_count)
+	{
+		pd->cmds[i] = build_stage(node->stages[i], pd);
+		if (pd->cmds[i] == NULL)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Runs a parsed pipeline through the regular pipeline machinery.
+ *
+ * @param node The NODE_PIPELINE node.
+ * @param pd The process data.
+ * @return The exit status of the last stage.
+ */
+int	execute_pipeline_node(t_ast_node *node, t_process_data *pd)
+{
+	int	status;
+
+	pd->cmds = ft_calloc(node->stage_count + 1, sizeof(t_command *));
+	if (pd->cmds == NULL)
+		return (1);
+	pd->cmd_count = node->stage_count;
+	pd->path_dirs = find_path_dirs(pd->env_list);
+	pd->in_pipeline = 1;
+	if (!build_stages(node, pd))
+	{
+		cleanup_pipeline_resources(pd);
+		if (g_signal_received == SIGINT)
+			return (128 + SIGINT);
+		return (1);
+	}
+	optimize_pipeline(pd);
+	status = run_command_pipeline(pd);
+	cleanup_pipeline_resources(pd);
+	return (status);
+}
+
+/**
+ * @brief Runs a compound pipeline stage inside its child process.
+ *
+ * The pipeline bookkeeping inherited from the parent is released first,
+ * so nested pipelines in the stage can reuse the same process data.
+ *
+ * @param cmd The stage command; `cmd->node` is the node to run.
+ * @param data The process data of the child.
+ */
+void	run_compound_in_child(t_command *cmd, t_process_data *data)
+{
+	t_ast_node	*node;
+	int			status;
+
+	node = cmd->node;
+	data->pipes = NULL;
+	cleanup_pipeline_resources(data);
+	data->in_pipeline = 0;
+	status = execute_ast_node(node, data);
+	get_next_line_cleanup();
+	cleanup_child_pipeline_resources(data);
+	exit(status);
+}
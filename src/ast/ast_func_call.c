@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_func_call.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/11 11:40:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include "../../libft/get_next_line/get_next_line.h"
+
+/**
+ * @brief Puts back the variables shadowed by `local` in a finished call.
+ *
+ * @param frame The call that is returning.
+ * @param pd The process data.
+ */
+static void	restore_locals(t_call_frame *frame, t_process_data *pd)
+{
+	t_env_var	*saved;
+	t_env_var	*next;
+
+	saved = frame->saved;
+	while (saved != NULL)
+	{
+		next = saved->next;
+		if (saved->value == NULL)
+			unset_shell_var(saved->key, pd);
+		else
+			set_shell_var(saved->key, saved->value, pd);
+		free(saved->key);
+		free(saved->value);
+		free(saved);
+		saved = next;
+	}
+	frame->saved = NULL;
+}
+
+/**
+ * @brief Fills in the frame of a new call from its arguments.
+ *
+ * @param frame The frame to fill in, linked to the caller's frame.
+ * @param args The command name followed by the arguments.
+ * @param pd The process data.
+ * @return 1 on success, 0 if calls are nested too deeply.
+ */
+static int	init_frame(t_call_frame *frame, char **args, t_process_data *pd)
+{
+	ft_bzero(frame, sizeof(t_call_frame));
+	frame->prev = pd->frame;
+	if (frame->prev != NULL)
+		frame->depth = frame->prev->depth + 1;
+	if (frame->depth >= FUNC_MAX_DEPTH)
+	{
+		ft_error(args[0], "maximum function nesting level exceeded");
+		return (0);
+	}
+	frame->argv = args + 1;
+	while (frame->argv[frame->argc] != NULL)
+		frame->argc++;
+	return (1);
+}
+
+/**
+ * @brief Calls a function body in the current shell process.
+ *
+ * The arguments become the positional parameters for the duration of the
+ * call. Enclosing loops are hidden from the body, so `break` cannot leave
+ * the function, and a `return` stops the body without going further.
+ * Also used by `source` when it is given arguments.
+ *
+ * @param body The function body, or the list of a sourced script.
+ * @param args The command name followed by the arguments.
+ * @param pd The process data.
+ * @return The exit status of the body, or of `return`.
+ */
+int	call_function(t_ast_node *body, char **args, t_process_data *pd)
+{
+	t_call_frame	frame;
+	int				saved_depth;
+	int				status;
+
+	if (!init_frame(&frame, args, pd))
+		return (1);
+	pd->frame = &frame;
+	saved_depth = pd->loop_depth;
+	pd->loop_depth = 0;
+	status = execute_ast(body, pd);
+	if (pd->loop_ctl == LOOP_RETURN)
+		pd->loop_ctl = LOOP_NONE;
+	pd->loop_depth = saved_depth;
+	restore_locals(&frame, pd);
+	pd->frame = frame.prev;
+	return (status);
+}
+
+/**
+ * @brief Runs a function call from a single command line.
+ *
+ * Like a builtin, the call runs in the shell itself, with the command's
+ * redirections swapped in around it.
+ *
+ * @param fn The function to call.
+ * @param data The execution data with the arguments and redirections.
+ * @param pd The process data.
+ * @return The exit status of the call, or 1 on a redirection error.
+ */
+int	execute_function_command(t_function *fn, t_execute_data *data,
+								t_process_data *pd)
+{
+	int	redirects_input;
+	int	status;
+
+	redirects_input = fd_ops_redirect(data->fd_ops, STDIN_FILENO);
+	if (redirects_input)
+		sync_read_buffer(pd);
+	status = setup_builtin_io(data);
+	if (status == 0)
+		status = call_function(fn->body, data->clean_args, pd);
+	if (redirects_input)
+		sync_read_buffer(pd);
+	restore_builtin_io(data);
+	return (status);
+}
+
+/**
+ * @brief Runs a pipeline stage that calls a function, inside its child.
+ *
+ * The arguments are taken over from the command before the pipeline data
+ * is released, so the body can run nested pipelines of its own. Returns
+ * without doing anything if the command is not a function.
+ *
+ * @param cmd The stage command, with a non-empty argument list.
+ * @param data The process data of the child.
+ */
+void	run_function_in_child(t_command *cmd, t_process_data *data)
+{
+	t_function	*fn;
+	char		**args;
+	int			status;
+
+	fn = find_function(data, cmd->args[0]);
+	if (fn == NULL)
+		return ;
+	apply_env_prefix(cmd->env_prefix, data);
+	args = cmd->args;
+	cmd->args = NULL;
+	data->pipes = NULL;
+	cleanup_pipeline_resources(data);
+	data->in_pipeline = 0;
+	status = call_function(fn->body, args, data);
+	free_split(args);
+	get_next_line_cleanup();
+	cleanup_child_pipeline_resources(data);
+	exit(status);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_func_table.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/11 11:02:40 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/11 11:02:40 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Hashes a function name into a bucket of the function table.
+ *
+ * @param name The function name.
+ * @return The bucket index, below FUNC_BUCKETS.
+ */
+static unsigned int	function_hash(const char *name)
+{
+	unsigned int	hash;
+	size_t			i;
+
+	hash = 5381;
+	i = 0;
+	while (name[i] != '\0')
+	{
+		hash = hash * 33 + (unsigned char)name[i];
+		i++;
+	}
+	return (hash % FUNC_BUCKETS);
+}
+
+/**
+ * @brief Looks up a function by name.
+ *
+ * This is a single probe of the hash table, so it is cheap enough to be
+ * done for every command before the builtin and PATH lookups.
+ *
+ * @param pd The process data holding the function table.
+ * @param name The command name.
+ * @return The function, or NULL if no function has that name.
+ */
+t_function	*find_function(t_process_data *pd, const char *name)
+{
+	t_function	*fn;
+
+	if (pd->functions == NULL || name == NULL)
+		return (NULL);
+	fn = pd->functions[function_hash(name)];
+	while (fn != NULL && ft_strncmp(fn->name, name, ft_strlen(name) + 1))
+		fn = fn->next;
+	return (fn);
+}
+
+/**
+ * @brief Runs a function definition: adds or replaces the function.
+ *
+ * Only the pointer to the already parsed body is stored. The script that
+ * holds it is kept alive by release_script_ast() once it has finished.
+ *
+ * @param node The NODE_FUNCDEF node.
+ * @param pd The process data holding the function table.
+ * @return 0; exits the shell on allocation failure.
+ */
+int	define_function(t_ast_node *node, t_process_data *pd)
+{
+	t_function		*fn;
+	unsigned int	bucket;
+
+	if (pd->functions == NULL)
+		pd->functions = ft_calloc(FUNC_BUCKETS, sizeof(t_function *));
+	if (pd->functions == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	fn = find_function(pd, node->name);
+	if (fn == NULL)
+	{
+		fn = malloc(sizeof(t_function));
+		if (fn == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		fn->name = ft_strdup(node->name);
+		if (fn->name == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		bucket = function_hash(node->name);
+		fn->next = pd->functions[bucket];
+		pd->functions[bucket] = fn;
+	}
+	fn->body = node->body;
+	pd->keep_script = 1;
+	return (0);
+}
+
+/**
+ * @brief Frees a finished script, or keeps it if it defined functions.
+ *
+ * Kept scripts are chained as NODE_GROUP wrappers on `kept_scripts` and
+ * freed with the function table.
+ *
+ * @param ast The script's tree (can be NULL).
+ * @param pd The process data.
+ */
+void	release_script_ast(t_ast_node *ast, t_process_data *pd)
+{
+	t_ast_node	*keep;
+
+	if (!pd->keep_script || ast == NULL)
+	{
+		free_ast(ast);
+		return ;
+	}
+	pd->keep_script = 0;
+	keep = new_ast_node(NODE_GROUP);
+	if (keep == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	keep->body = ast;
+	keep->next = pd->kept_scripts;
+	pd->kept_scripts = keep;
+}
+
+/**
+ * @brief Frees the function table and every script kept for it.
+ *
+ * @param pd The process data.
+ */
+void	free_functions(t_process_data *pd)
+{
+	t_function	*fn;
+	t_function	*next;
+	int			i;
+
+	i = 0;
+	while (pd->functions != NULL && i < FUNC_BUCKETS)
+	{
+		fn = pd->functions[i];
+		while (fn != NULL)
+		{
+			next = fn->next;
+			free(fn->name);
+			free(fn);
+			fn = next;
+		}
+		i++;
+	}
+	free(pd->functions);
+	pd->functions = NULL;
+	free_ast(pd->kept_scripts);
+	pd->kept_scripts = NULL;
+}
@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_heredoc.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 10:12:44 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds where the heredoc bodies of the line the cursor is on
+ * start: just after the newline ending it, which is the first one not
+ * inside quotes or a comment.
+ *
+ * @param p The script parser state.
+ */
+static void	start_heredoc_bodies(t_script_parser *p)
+{
+	const char	*s;
+	size_t		i;
+	char		quote;
+
+	s = p->text;
+	i = p->pos;
+	quote = 0;
+	while (s[i] != '\0' && (quote || s[i] != '\n'))
+	{
+		if (quote == 0 && s[i] == '#' && i > 0
+			&& (s[i - 1] == ' ' || s[i - 1] == '\t'))
+		{
+			while (s[i] != '\0' && s[i] != '\n')
+				i++;
+			break ;
+		}
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		i++;
+	}
+	p->heredoc_nl = i;
+	p->heredoc_next = i + (s[i] == '\n');
+}
+
+/**
+ * @brief Finds the line holding only the delimiter of a heredoc.
+ *
+ * @param s The script text.
+ * @param i The start of the body.
+ * @param delim The delimiter, without quotes.
+ * @param body_end Receives the end of the body: the start of the
+ *                 delimiter line, or the end of the text.
+ * @return The index just past the delimiter line, or 0 if there is none.
+ */
+static size_t	find_delimiter(const char *s, size_t i, const char *delim,
+		size_t *body_end)
+{
+	size_t	len;
+
+	len = ft_strlen(delim);
+	while (s[i] != '\0')
+	{
+		if (ft_strncmp(s + i, delim, len) == 0
+			&& (s[i + len] == '\n' || s[i + len] == '\0'))
+		{
+			*body_end = i;
+			return (i + len + (s[i + len] == '\n'));
+		}
+		while (s[i] != '\0' && s[i] != '\n')
+			i++;
+		if (s[i] == '\n')
+			i++;
+	}
+	*body_end = i;
+	return (0);
+}
+
+/**
+ * @brief Reads the body of one heredoc from the script text.
+ *
+ * Without its delimiter line the script is incomplete, unless no more
+ * text will come: the body then runs to the end, with a warning.
+ *
+ * @param p The script parser state.
+ * @param word The delimiter as written.
+ * @param body Receives the body, each line ending with a newline.
+ * @return 1 on success, 0 if the script is incomplete or on error.
+ */
+static int	read_heredoc_body(t_script_parser *p, char *word, char **body)
+{
+	char	*delim;
+	size_t	body_end;
+	size_t	next;
+
+	delim = remove_quotes_and_join(word);
+	if (delim == NULL)
+		return (sp_fail(p), 0);
+	next = find_delimiter(p->text, p->heredoc_next, delim, &body_end);
+	if (next == 0 && p->final)
+		handle_eof_warning(delim);
+	free(delim);
+	if (next == 0 && !p->final && p->status == AST_OK)
+		p->status = AST_INCOMPLETE;
+	if (next == 0 && !p->final)
+		return (0);
+	if (next == 0)
+		next = body_end;
+	*body = ft_substr(p->text, p->heredoc_next, body_end - p->heredoc_next);
+	if (*body == NULL)
+		return (sp_fail(p), 0);
+	p->heredoc_next = next;
+	return (1);
+}
+
+/**
+ * @brief Counts the heredoc redirections of a token list.
+ */
+static int	count_heredoc_tokens(t_token **tokens)
+{
+	int	count;
+	int	i;
+
+	count = 0;
+	i = 0;
+	while (tokens[i] != NULL && tokens[i + 1] != NULL)
+	{
+		if (redirect_kind(tokens[i]->value, NULL) == REDIR_HEREDOC)
+			count++;
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Reads the bodies of the heredocs of a command as it is parsed.
+ *
+ * As in any shell, the bodies are the lines that follow the line of the
+ * command, one after the other. They are read now from the script text,
+ * whether it comes from the terminal, standard input or a sourced file,
+ * and kept on the node, so a loop or a function replays the same body
+ * on every run instead of reading input. sp_skip_newlines() skips them
+ * when it passes the end of the command's line.
+ *
+ * @param p The script parser state, just past the command.
+ * @param node The node receiving the bodies.
+ * @param tokens The tokens of the command.
+ * @return 1 on success, 0 if the script is incomplete or on error.
+ */
+int	sp_take_heredocs(t_script_parser *p, t_ast_node *node, t_token **tokens)
+{
+	int	count;
+	int	i;
+
+	count = count_heredoc_tokens(tokens);
+	if (count == 0)
+		return (1);
+	node->heredocs = ft_calloc(count + 1, sizeof(char *));
+	if (node->heredocs == NULL)
+		return (sp_fail(p), 0);
+	if (p->heredoc_next == 0)
+		start_heredoc_bodies(p);
+	count = 0;
+	i = 0;
+	while (tokens[i] != NULL && tokens[i + 1] != NULL)
+	{
+		if (redirect_kind(tokens[i]->value, NULL) == REDIR_HEREDOC)
+		{
+			if (!read_heredoc_body(p, tokens[i + 1]->value,
+					&node->heredocs[count]))
+				return (0);
+			count++;
+		}
+		i++;
+	}
+	return (1);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_input.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks a line for an unquoted list operator or comment.
+ *
+ * @param line The input line.
+ * @return 1 if the line holds `;`, `&&`, `||`, a newline or a comment.
+ */
+static int	has_list_operator(const char *line)
+{
+	size_t	i;
+	char	quote;
+
+	i = 0;
+	quote = 0;
+	while (line[i] != '\0')
+	{
+		if (quote == 0 && (line[i] == '\'' || line[i] == '"'))
+			quote = line[i];
+		else if (quote && line[i] == quote)
+			quote = 0;
+		else if (quote == 0 && (line[i] == ';' || line[i] == '\n'))
+			return (1);
+		else if (quote == 0 && (line[i] == '&' || line[i] == '|')
+			&& line[i + 1] == line[i])
+			return (1);
+		else if (quote == 0 && line[i] == '#' && i > 0
+			&& (line[i - 1] == ' ' || line[i - 1] == '\t'))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Decides whether a line needs the script parser.
+ *
+ * Lines starting with a reserved word, `{`, `!`, `time`, `pipesize`, a
+ * function definition or a comment, and lines with list operators, go
+ * through the AST; plain commands and pipelines keep the direct
+ * execute_command() path.
+ *
+ * @param line The input line.
+ * @return 1 if the line must be run with run_script_input(), 0 otherwise.
+ */
+int	is_compound_input(const char *line)
+{
+	static const char	*words[] = {"if", "while", "until", "for", "case",
+		"{", "!", "time", "pipesize", NULL};
+	t_script_parser		p;
+	int					i;
+
+	ft_bzero(&p, sizeof(t_script_parser));
+	p.text = line;
+	sp_skip_blanks(&p);
+	if (line[p.pos] == '\0' || sp_at_funcdef(&p))
+		return (1);
+	i = 0;
+	while (words[i] != NULL)
+	{
+		if (sp_at_word(&p, words[i]))
+			return (1);
+		i++;
+	}
+	return (has_list_operator(line));
+}
+
+/**
+ * @brief Reports a script that ended before its compound commands did.
+ *
+ * @param pd The process data.
+ * @return The exit status set: 130 after Ctrl-C, 2 at end of input.
+ */
+static int	report_unfinished(t_process_data *pd)
+{
+	if (g_signal_received == SIGINT)
+		pd->last_exit_status = 128 + SIGINT;
+	else
+	{
+		ft_error(NULL, "syntax error: unexpected end of file");
+		pd->last_exit_status = 2;
+	}
+	return (pd->last_exit_status);
+}
+
+/**
+ * @brief Parses a script once and runs it from its AST.
+ *
+ * Continuation lines are read until every compound command and heredoc
+ * is closed (see parse_input()). The whole script is added to the
+ * history as one entry. Its tree is kept afterwards if it defined
+ * functions, whose bodies point into it.
+ *
+ * @param line The first line of the script.
+ * @param interactive Non-zero when reading from a terminal.
+ * @param pd The process data.
+ * @return The exit status of the script.
+ */
+int	run_script_input(char *line, int interactive, t_process_data *pd)
+{
+	char		*text;
+	t_ast_node	*ast;
+	int			status;
+
+	ast = NULL;
+	text = ft_strdup(line);
+	status = AST_ERROR;
+	if (text != NULL)
+		status = parse_input(&text, interactive, &ast, pd);
+	if (text == NULL)
+		return (report_unfinished(pd));
+	if (interactive)
+		history_add(pd, text);
+	if (status == AST_OK && ast != NULL && check_heredoc_limit(text))
+	{
+		g_signal_received = 0;
+		execute_ast(ast, pd);
+	}
+	release_script_ast(ast, pd);
+	free(text);
+	return (pd->last_exit_status);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_input_helper.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 10:12:44 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Reads one more line of an unfinished script and appends it.
+ *
+ * @param text The script read so far; replaced by the joined script, or
+ *             freed and set to NULL if they cannot be joined.
+ * @param interactive Non-zero to prompt with readline, 0 to read stdin.
+ * @return 1 if a line was appended, 0 on end of input or Ctrl-C.
+ */
+static int	read_continuation(char **text, int interactive)
+{
+	char	*more;
+	char	*tmp;
+	char	*nl;
+
+	if (interactive)
+	{
+		rl_event_hook = signal_event_hook;
+		more = readline("> ");
+		rl_event_hook = NULL;
+	}
+	else
+		more = get_next_line(STDIN_FILENO);
+	if (more == NULL || g_signal_received == SIGINT)
+		return (free(more), 0);
+	nl = ft_strchr(more, '\n');
+	if (nl != NULL)
+		*nl = '\0';
+	tmp = ft_strjoin(*text, "\n");
+	free(*text);
+	*text = NULL;
+	if (tmp != NULL)
+		*text = ft_strjoin(tmp, more);
+	free(tmp);
+	free(more);
+	return (*text != NULL);
+}
+
+/**
+ * @brief Parses a script, reading continuation lines until every
+ * compound command and heredoc body is closed.
+ *
+ * At end of input the script is parsed one last time as final, so that
+ * a heredoc missing its delimiter ends there, as it would in a file.
+ *
+ * @param text The script read so far; replaced as lines are appended,
+ *             freed and set to NULL if it stays unfinished.
+ * @param interactive Non-zero when reading from a terminal.
+ * @param ast Receives the parsed list.
+ * @param pd The process data.
+ * @return The status of the last parse.
+ */
+int	parse_input(char **text, int interactive, t_ast_node **ast,
+		t_process_data *pd)
+{
+	int	status;
+
+	status = parse_script(*text, ast, pd, 0);
+	while (status == AST_INCOMPLETE)
+	{
+		if (!read_continuation(text, interactive))
+		{
+			if (*text != NULL && g_signal_received != SIGINT)
+				status = parse_script(*text, ast, pd, 1);
+			break ;
+		}
+		status = parse_script(*text, ast, pd, 0);
+	}
+	if (status == AST_INCOMPLETE)
+	{
+		free(*text);
+		*text = NULL;
+	}
+	return (status);
+}
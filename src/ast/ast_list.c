@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_list.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Appends an and-or chain to a list and returns the new tail.
+ *
+ * @param head The head of the list; set if the list is empty.
+ * @param tail The current tail of the list.
+ * @param chain The chain to append.
+ * @return The last node of the appended chain.
+ */
+static t_ast_node	*list_append(t_ast_node **head, t_ast_node *tail,
+						t_ast_node *chain)
+{
+	if (*head == NULL)
+		*head = chain;
+	else
+		tail->next = chain;
+	tail = chain;
+	while (tail->next != NULL)
+		tail = tail->next;
+	return (tail);
+}
+
+/**
+ * @brief Consumes the separator after a list element.
+ *
+ * @param p The script parser state.
+ * @return 1 if a `;` or newline follows and the list goes on, 0 otherwise.
+ */
+static int	consume_separator(t_script_parser *p)
+{
+	if (sp_at_op(p, ";;"))
+		return (0);
+	if (p->text[p->pos] == ';')
+	{
+		p->pos++;
+		return (1);
+	}
+	return (p->text[p->pos] == '\n');
+}
+
+/**
+ * @brief Parses a list of and-or chains separated by `;` or newlines.
+ *
+ * Parsing stops at the end of the text or at a reserved word that closes
+ * the enclosing compound command (`then`, `fi`, `done`, `;;`, ...).
+ *
+ * @param p The script parser state.
+ * @return The first node of the list; NULL with an AST_OK status means
+ *         the list is empty.
+ */
+t_ast_node	*parse_list(t_script_parser *p)
+{
+	t_ast_node	*head;
+	t_ast_node	*tail;
+	t_ast_node	*chain;
+
+	head = NULL;
+	tail = NULL;
+	while (p->status == AST_OK)
+	{
+		sp_skip_newlines(p);
+		if (sp_at_list_end(p))
+			break ;
+		chain = parse_and_or(p);
+		if (chain == NULL)
+			return (free_ast(head), sp_fail(p));
+		tail = list_append(&head, tail, chain);
+		if (!consume_separator(p))
+			break ;
+	}
+	return (head);
+}
+
+/**
+ * @brief Parses the non-empty list forming the body of a compound command.
+ *
+ * @param p The script parser state.
+ * @return The parsed list, or NULL if it is missing or invalid.
+ */
+t_ast_node	*parse_body(t_script_parser *p)
+{
+	t_ast_node	*list;
+
+	list = parse_list(p);
+	if (list == NULL && p->status == AST_OK)
+		sp_syntax_error(p);
+	if (list == NULL)
+		return (sp_fail(p));
+	return (list);
+}
+
+/**
+ * @brief Consumes a `time` or `time -p` prefix of a pipeline.
+ *
+ * @param p The script parser state.
+ * @return TIME_DEFAULT or TIME_POSIX if a prefix was consumed, else 0.
+ */
+int	sp_take_time(t_script_parser *p)
+{
+	if (!sp_at_word(p, "time"))
+		return (0);
+	p->pos += 4;
+	if (!sp_at_word(p, "-p"))
+		return (TIME_DEFAULT);
+	p->pos += 2;
+	return (TIME_POSIX);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_node.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Allocates a zeroed AST node of the given type.
+ *
+ * @param type The kind of node to create.
+ * @return The new node, or NULL on allocation failure.
+ */
+t_ast_node	*new_ast_node(t_node_type type)
+{
+	t_ast_node	*node;
+
+	node = malloc(sizeof(t_ast_node));
+	if (node == NULL)
+		return (NULL);
+	ft_bzero(node, sizeof(t_ast_node));
+	node->type = type;
+	node->connector = CONN_SEQ;
+	return (node);
+}
+
+/**
+ * @brief Frees every arm of a case command.
+ *
+ * @param item The first arm of the list.
+ */
+static void	free_case_items(t_case_item *item)
+{
+	t_case_item	*next;
+
+	while (item != NULL)
+	{
+		next = item->next;
+		if (item->patterns)
+			free_tokens(item->patterns);
+		free_ast(item->body);
+		free(item);
+		item = next;
+	}
+}
+
+/**
+ * @brief Frees the stage array of a pipeline node.
+ *
+ * @param stages The array of stage nodes.
+ * @param count The number of stages in the array.
+ */
+static void	free_stages(t_ast_node **stages, int count)
+{
+	int	i;
+
+	if (stages == NULL)
+		return ;
+	i = 0;
+	while (i < count)
+	{
+		free_ast(stages[i]);
+		i++;
+	}
+	free(stages);
+}
+
+/**
+ * @brief Frees a list of AST nodes and everything they own.
+ *
+ * @param node The first node of the list (can be NULL).
+ */
+void	free_ast(t_ast_node *node)
+{
+	t_ast_node	*next;
+
+	while (node != NULL)
+	{
+		next = node->next;
+		if (node->words)
+			free_tokens(node->words);
+		if (node->redirs)
+			free_tokens(node->redirs);
+		free(node->name);
+		free_split(node->heredocs);
+		free_stages(node->stages, node->stage_count);
+		free_ast(node->cond);
+		free_ast(node->body);
+		free_ast(node->alt);
+		free_case_items(node->items);
+		free(node);
+		node = next;
+	}
+}
+
+/**
+ * @brief Tokenizes a slice of the script with the regular command lexer.
+ *
+ * The slice gets the same redirection pre-check as an interactive line,
+ * so a command inside a compound reports the same errors.
+ *
+ * @param p The script parser state.
+ * @param start Index of the first character of the slice.
+ * @param end Index just past the last character of the slice.
+ * @return The token array, or NULL on error.
+ */
+t_token	**sp_parse_slice(t_script_parser *p, size_t start, size_t end)
+{
+	char	*slice;
+	t_token	**tokens;
+
+	slice = ft_substr(p->text, start, end - start);
+	if (slice == NULL)
+		return (sp_fail(p));
+	tokens = NULL;
+	if (precheck_redir_syntax(slice, p->pd))
+		tokens = parse_line(slice, p->pd);
+	free(slice);
+	if (tokens == NULL)
+		return (sp_fail(p));
+	return (tokens);
+}
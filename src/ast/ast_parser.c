@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Appends a stage to a pipeline node, growing its stage array.
+ *
+ * @param pipe The pipeline node.
+ * @param stage The stage to append; freed on failure.
+ * @return 1 on success, 0 on allocation failure.
+ */
+static int	add_stage(t_ast_node *pipe, t_ast_node *stage)
+{
+	t_ast_node	**grown;
+	int			i;
+
+	grown = malloc(sizeof(t_ast_node *) * (pipe->stage_count + 1));
+	if (grown == NULL)
+	{
+		free_ast(stage);
+		return (0);
+	}
+	i = 0;
+	while (i < pipe->stage_count)
+	{
+		grown[i] = pipe->stages[i];
+		i++;
+	}
+	grown[i] = stage;
+	free(pipe->stages);
+	pipe->stages = grown;
+	pipe->stage_count++;
+	return (1);
+}
+
+/**
+ * @brief Collects the remaining `| command` stages after the first one.
+ *
+ * @param p The script parser state.
+ * @param first The already parsed first stage.
+ * @return The pipeline node, or NULL on error.
+ */
+static t_ast_node	*parse_pipeline_stages(t_script_parser *p,
+						t_ast_node *first)
+{
+	t_ast_node	*pipe;
+	t_ast_node	*stage;
+
+	pipe = new_ast_node(NODE_PIPELINE);
+	if (pipe == NULL)
+		return (free_ast(first), sp_fail(p));
+	if (!add_stage(pipe, first))
+		return (free_ast(pipe), sp_fail(p));
+	while (sp_at_op(p, "|") && !sp_at_op(p, "||"))
+	{
+		p->pos++;
+		sp_skip_newlines(p);
+		stage = parse_command(p);
+		if (stage == NULL)
+			return (free_ast(pipe), sp_fail(p));
+		if (!add_stage(pipe, stage))
+			return (free_ast(pipe), sp_fail(p));
+	}
+	return (pipe);
+}
+
+/**
+ * @brief Parses a pipeline with its optional prefixes:
+ * `[time [-p]] [!] [pipesize SIZE] cmd [| cmd]...`, in any order.
+ *
+ * A pipeline of a single command is returned as that command's node. A
+ * bare `time` times an empty command.
+ *
+ * @param p The script parser state.
+ * @return The parsed node, or NULL on error.
+ */
+static t_ast_node	*parse_pipeline(t_script_parser *p)
+{
+	t_ast_node			*node;
+	t_pipeline_prefix	pre;
+
+	if (!sp_take_prefixes(p, &pre))
+		return (NULL);
+	if (pre.timed
+		&& (sp_at_list_end(p) || sp_at_op(p, ";") || sp_at_op(p, "\n")))
+		node = new_ast_node(NODE_GROUP);
+	else
+		node = parse_command(p);
+	if (node == NULL)
+		return (sp_fail(p));
+	if (sp_at_op(p, "|") && !sp_at_op(p, "||"))
+		node = parse_pipeline_stages(p, node);
+	if (node == NULL)
+		return (NULL);
+	node->negate = pre.negate;
+	node->timed = pre.timed;
+	node->pipe_size = pre.pipe_size;
+	return (node);
+}
+
+/**
+ * @brief Parses pipelines joined by `&&` and `||`.
+ *
+ * The result is a flat chain linked through `next`; each node records in
+ * `connector` how it is joined to the following one.
+ *
+ * @param p The script parser state.
+ * @return The first node of the chain, or NULL on error.
+ */
+t_ast_node	*parse_and_or(t_script_parser *p)
+{
+	t_ast_node	*head;
+	t_ast_node	*tail;
+
+	head = parse_pipeline(p);
+	tail = head;
+	while (tail != NULL && (sp_at_op(p, "&&") || sp_at_op(p, "||")))
+	{
+		tail->connector = CONN_OR;
+		if (p->text[p->pos] == '&')
+			tail->connector = CONN_AND;
+		p->pos += 2;
+		sp_skip_newlines(p);
+		tail->next = parse_pipeline(p);
+		tail = tail->next;
+	}
+	if (tail == NULL)
+		return (free_ast(head), sp_fail(p));
+	return (head);
+}
+
+/**
+ * @brief Parses a whole script into an AST.
+ *
+ * @param text The script text; tokens are copied out of it.
+ * @param out Receives the parsed list, or NULL on error or incomplete input.
+ * @param pd The process data, used for error reporting.
+ * @param final Non-zero if no more text will follow: a heredoc that is
+ *              not closed then ends with the text, as at end of file.
+ * @return AST_OK, AST_INCOMPLETE if more input is needed, or AST_ERROR.
+ */
+int	parse_script(const char *text, t_ast_node **out, t_process_data *pd,
+		int final)
+{
+	t_script_parser	p;
+
+	ft_bzero(&p, sizeof(t_script_parser));
+	p.text = text;
+	p.status = AST_OK;
+	p.final = final;
+	p.pd = pd;
+	*out = parse_list(&p);
+	if (p.status == AST_OK)
+	{
+		sp_skip_newlines(&p);
+		if (p.text[p.pos] != '\0')
+			sp_syntax_error(&p);
+	}
+	if (p.status != AST_OK)
+	{
+		free_ast(*out);
+		*out = NULL;
+	}
+	return (p.status);
+}
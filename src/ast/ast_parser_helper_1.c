@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_1.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Parses a simple command up to the next separator.
+ *
+ * The command text is tokenized here, once; expansion happens each time
+ * the node is executed.
+ *
+ * @param p The script parser state.
+ * @return The NODE_SIMPLE node, or NULL on error.
+ */
+static t_ast_node	*parse_simple(t_script_parser *p)
+{
+	t_ast_node	*node;
+	size_t		end;
+
+	end = sp_command_end(p);
+	if (p->status != AST_OK)
+		return (NULL);
+	if (end == p->pos)
+		return (sp_syntax_error(p), sp_fail(p));
+	node = new_ast_node(NODE_SIMPLE);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->words = sp_parse_slice(p, p->pos, end);
+	p->pos = end;
+	if (node->words == NULL || !sp_take_heredocs(p, node, node->words))
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+/**
+ * @brief Checks that a token list only holds `op target` pairs.
+ *
+ * @param p The script parser state.
+ * @param redirs The tokens following a compound command.
+ * @return 1 if every token is part of a redirection, 0 otherwise.
+ */
+static int	only_redirections(t_script_parser *p, t_token **redirs)
+{
+	int	i;
+
+	i = 0;
+	while (redirs[i] != NULL && is_redirect(redirs[i]->value)
+		&& redirs[i + 1] != NULL)
+		i += 2;
+	if (redirs[i] == NULL)
+		return (1);
+	sp_unexpected(p, redirs[i]->value);
+	return (0);
+}
+
+/**
+ * @brief Parses the redirections written after a compound command.
+ *
+ * They are kept as tokens on the node, e.g. for `done > out` or
+ * `} 2>&1`, and are expanded and applied each time the compound command runs.
+ *
+ * @param p The script parser state.
+ * @param node The compound command node.
+ * @return 1 on success or if there are none, 0 on error.
+ */
+static int	parse_compound_redirs(t_script_parser *p, t_ast_node *node)
+{
+	size_t	end;
+
+	sp_skip_blanks(p);
+	if (redirect_op_len(p->text + p->pos) == 0)
+		return (1);
+	end = sp_command_end(p);
+	if (p->status != AST_OK)
+		return (0);
+	node->redirs = sp_parse_slice(p, p->pos, end);
+	if (node->redirs == NULL)
+		return (0);
+	p->pos = end;
+	if (!only_redirections(p, node->redirs))
+		return (0);
+	return (sp_take_heredocs(p, node, node->redirs));
+}
+
+/**
+ * @brief Parses the compound command starting at the cursor.
+ *
+ * @param p The script parser state, on a word accepted by sp_at_compound().
+ * @return The parsed node, or NULL on error.
+ */
+static t_ast_node	*parse_compound(t_script_parser *p)
+{
+	if (sp_at_word(p, "if"))
+		return (parse_if(p));
+	if (sp_at_word(p, "while"))
+		return (parse_loop(p, NODE_WHILE));
+	if (sp_at_word(p, "until"))
+		return (parse_loop(p, NODE_UNTIL));
+	if (sp_at_word(p, "for"))
+		return (parse_for(p));
+	if (sp_at_word(p, "case"))
+		return (parse_case(p));
+	if (sp_at_word(p, "{"))
+		return (parse_group(p));
+	return (parse_funcdef(p));
+}
+
+/**
+ * @brief Parses one command: a compound command or a simple command.
+ *
+ * @param p The script parser state.
+ * @return The parsed node, or NULL on error.
+ */
+t_ast_node	*parse_command(t_script_parser *p)
+{
+	t_ast_node	*node;
+
+	if (sp_at_list_end(p))
+		return (sp_syntax_error(p), sp_fail(p));
+	if (!sp_at_compound(p))
+		return (parse_simple(p));
+	node = parse_compound(p);
+	if (node == NULL)
+		return (sp_fail(p));
+	if (!parse_compound_redirs(p, node))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_2.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+static t_ast_node	*parse_if_clause(t_script_parser *p);
+
+/**
+ * @brief Parses what follows the `then` body of an if clause.
+ *
+ * An `elif` starts a nested clause stored in `alt` that also consumes the
+ * closing `fi`; an `else` body is stored in `alt` directly.
+ *
+ * @param p The script parser state.
+ * @param node The if node being built.
+ * @return 1 on success, 0 on error.
+ */
+static int	parse_if_tail(t_script_parser *p, t_ast_node *node)
+{
+	if (sp_at_word(p, "elif"))
+	{
+		p->pos += 4;
+		node->alt = parse_if_clause(p);
+		return (node->alt != NULL);
+	}
+	if (sp_at_word(p, "else"))
+	{
+		p->pos += 4;
+		node->alt = parse_body(p);
+		if (node->alt == NULL)
+			return (0);
+	}
+	return (sp_expect_word(p, "fi"));
+}
+
+/**
+ * @brief Parses `list then list [elif ...|else list] fi`.
+ *
+ * @param p The script parser state, positioned after `if` or `elif`.
+ * @return The NODE_IF node, or NULL on error.
+ */
+static t_ast_node	*parse_if_clause(t_script_parser *p)
+{
+	t_ast_node	*node;
+
+	node = new_ast_node(NODE_IF);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->cond = parse_body(p);
+	if (node->cond == NULL || !sp_expect_word(p, "then"))
+		return (free_ast(node), sp_fail(p));
+	node->body = parse_body(p);
+	if (node->body == NULL || !parse_if_tail(p, node))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
+
+/**
+ * @brief Parses an `if` command.
+ *
+ * @param p The script parser state, positioned on `if`.
+ * @return The NODE_IF node, or NULL on error.
+ */
+t_ast_node	*parse_if(t_script_parser *p)
+{
+	p->pos += 2;
+	return (parse_if_clause(p));
+}
+
+/**
+ * @brief Parses a `while` or `until` command.
+ *
+ * @param p The script parser state, positioned on the keyword.
+ * @param type NODE_WHILE or NODE_UNTIL.
+ * @return The loop node, or NULL on error.
+ */
+t_ast_node	*parse_loop(t_script_parser *p, t_node_type type)
+{
+	t_ast_node	*node;
+
+	p->pos += 5;
+	node = new_ast_node(type);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->cond = parse_body(p);
+	if (node->cond == NULL || !sp_expect_word(p, "do"))
+		return (free_ast(node), sp_fail(p));
+	node->body = parse_body(p);
+	if (node->body == NULL || !sp_expect_word(p, "done"))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_3.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Parses the loop variable name of a `for` command.
+ *
+ * @param p The script parser state, positioned after `for`.
+ * @param node The for node receiving the name.
+ * @return 1 on success, 0 on error.
+ */
+static int	parse_for_name(t_script_parser *p, t_ast_node *node)
+{
+	size_t	len;
+
+	sp_skip_blanks(p);
+	len = sp_word_len(p);
+	if (len == 0)
+		return (sp_syntax_error(p), 0);
+	node->name = ft_substr(p->text, p->pos, len);
+	if (node->name == NULL)
+		return (sp_fail(p), 0);
+	if (!is_valid_identifier(node->name))
+	{
+		sp_unexpected(p, node->name);
+		return (0);
+	}
+	p->pos += len;
+	return (1);
+}
+
+/**
+ * @brief Parses the optional `in word...` part of a `for` command.
+ *
+ * Without `in`, `words` stays NULL and the loop runs over the positional
+ * parameters. With an empty `in`, `words` is an empty token array.
+ *
+ * @param p The script parser state.
+ * @param node The for node receiving the words.
+ * @return 1 on success, 0 on error.
+ */
+static int	parse_for_words(t_script_parser *p, t_ast_node *node)
+{
+	size_t	end;
+
+	sp_skip_newlines(p);
+	if (!sp_at_word(p, "in"))
+		return (1);
+	p->pos += 2;
+	sp_skip_blanks(p);
+	end = sp_command_end(p);
+	if (p->status != AST_OK)
+		return (0);
+	if (end == p->pos)
+		node->words = ft_calloc(1, sizeof(t_token *));
+	else
+		node->words = sp_parse_slice(p, p->pos, end);
+	if (node->words == NULL)
+		return (sp_fail(p), 0);
+	p->pos = end;
+	return (1);
+}
+
+/**
+ * @brief Parses `for name [in word...]; do list done`.
+ *
+ * @param p The script parser state, positioned on `for`.
+ * @return The NODE_FOR node, or NULL on error.
+ */
+t_ast_node	*parse_for(t_script_parser *p)
+{
+	t_ast_node	*node;
+
+	p->pos += 3;
+	node = new_ast_node(NODE_FOR);
+	if (node == NULL)
+		return (sp_fail(p));
+	if (!parse_for_name(p, node) || !parse_for_words(p, node))
+		return (free_ast(node), sp_fail(p));
+	if (sp_at_op(p, ";") && !sp_at_op(p, ";;"))
+		p->pos++;
+	if (!sp_expect_word(p, "do"))
+		return (free_ast(node), sp_fail(p));
+	node->body = parse_body(p);
+	if (node->body == NULL || !sp_expect_word(p, "done"))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_4.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds the unquoted `)` closing the pattern list of a case arm.
+ *
+ * @param p The script parser state, positioned on the first pattern.
+ * @return The index of the `)`, or 0 on error or incomplete input.
+ */
+static size_t	find_pattern_end(t_script_parser *p)
+{
+	const char	*s;
+	size_t		i;
+	char		quote;
+
+	s = p->text;
+	i = p->pos;
+	quote = 0;
+	while (s[i] != '\0' && (quote || (s[i] != ')' && s[i] != '\n')))
+	{
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		i++;
+	}
+	if (s[i] == ')' && i > p->pos)
+		return (i);
+	p->pos = i;
+	sp_syntax_error(p);
+	return (0);
+}
+
+/**
+ * @brief Blanks out the unquoted `|` separators of a pattern list.
+ *
+ * This lets the regular lexer split the list into one token per pattern.
+ *
+ * @param slice The pattern list, modified in place.
+ */
+static void	blank_pattern_separators(char *slice)
+{
+	size_t	i;
+	char	quote;
+
+	i = 0;
+	quote = 0;
+	while (slice[i] != '\0')
+	{
+		if (quote == 0 && (slice[i] == '\'' || slice[i] == '"'))
+			quote = slice[i];
+		else if (quote && slice[i] == quote)
+			quote = 0;
+		else if (quote == 0 && slice[i] == '|')
+			slice[i] = ' ';
+		i++;
+	}
+}
+
+/**
+ * @brief Tokenizes the `pat | pat ...` list of a case arm.
+ *
+ * @param p The script parser state.
+ * @param end The index of the closing `)`.
+ * @return The pattern tokens, or NULL on error.
+ */
+static t_token	**parse_patterns(t_script_parser *p, size_t end)
+{
+	char	*slice;
+	t_token	**patterns;
+
+	slice = ft_substr(p->text, p->pos, end - p->pos);
+	if (slice == NULL)
+		return (sp_fail(p));
+	blank_pattern_separators(slice);
+	patterns = parse_line(slice, p->pd);
+	free(slice);
+	if (patterns == NULL || patterns[0] == NULL)
+		return (free_tokens(patterns), sp_syntax_error(p), sp_fail(p));
+	p->pos = end + 1;
+	return (patterns);
+}
+
+/**
+ * @brief Parses one `[(] pattern [| pattern]...) list [;;]` arm.
+ *
+ * @param p The script parser state, positioned on the arm.
+ * @return The parsed arm, or NULL on error.
+ */
+t_case_item	*parse_case_item(t_script_parser *p)
+{
+	t_case_item	*item;
+	size_t		end;
+
+	if (sp_at_op(p, "("))
+		p->pos++;
+	sp_skip_blanks(p);
+	end = find_pattern_end(p);
+	if (end == 0)
+		return (sp_fail(p));
+	item = ft_calloc(1, sizeof(t_case_item));
+	if (item == NULL)
+		return (sp_fail(p));
+	item->patterns = parse_patterns(p, end);
+	if (item->patterns != NULL)
+		item->body = parse_list(p);
+	if (p->status == AST_OK && sp_at_op(p, ";;"))
+		p->pos += 2;
+	else if (p->status == AST_OK && !sp_at_word(p, "esac"))
+		sp_syntax_error(p);
+	if (p->status == AST_OK)
+		return (item);
+	free_tokens(item->patterns);
+	free_ast(item->body);
+	free(item);
+	return (sp_fail(p));
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_5.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Parses the arms of a case command up to and including `esac`.
+ *
+ * @param p The script parser state, positioned after `in`.
+ * @param node The case node receiving the arms.
+ * @return 1 on success, 0 on error.
+ */
+static int	parse_case_items(t_script_parser *p, t_ast_node *node)
+{
+	t_case_item	**link;
+
+	link = &node->items;
+	while (p->status == AST_OK)
+	{
+		sp_skip_newlines(p);
+		if (sp_at_word(p, "esac"))
+		{
+			p->pos += 4;
+			return (1);
+		}
+		if (sp_at_eof(p))
+			return (sp_syntax_error(p), 0);
+		*link = parse_case_item(p);
+		if (*link == NULL)
+			return (0);
+		link = &(*link)->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Parses `case word in [arm]... esac`.
+ *
+ * @param p The script parser state, positioned on `case`.
+ * @return The NODE_CASE node, or NULL on error.
+ */
+t_ast_node	*parse_case(t_script_parser *p)
+{
+	t_ast_node	*node;
+	size_t		len;
+
+	p->pos += 4;
+	sp_skip_blanks(p);
+	len = sp_word_len(p);
+	if (len == 0)
+		return (sp_syntax_error(p), sp_fail(p));
+	node = new_ast_node(NODE_CASE);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->words = sp_parse_slice(p, p->pos, p->pos + len);
+	p->pos += len;
+	if (node->words == NULL || !sp_expect_word(p, "in")
+		|| !parse_case_items(p, node))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parser_helper_6.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/11 10:31:18 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/11 10:31:18 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks whether the cursor is on a function definition header.
+ *
+ * A header is a valid identifier followed by `(` and `)`, with optional
+ * blanks in between, as in `greet ()` or `greet()`.
+ *
+ * @param p The script parser state.
+ * @return 1 if a `name()` header starts at the cursor, 0 otherwise.
+ */
+int	sp_at_funcdef(t_script_parser *p)
+{
+	const char	*s;
+	char		*name;
+	size_t		len;
+	size_t		i;
+	int			valid;
+
+	sp_skip_blanks(p);
+	s = p->text;
+	len = sp_word_len(p);
+	i = p->pos + len;
+	while (s[i] == ' ' || s[i] == '\t')
+		i++;
+	if (len == 0 || s[i] != '(')
+		return (0);
+	i++;
+	while (s[i] == ' ' || s[i] == '\t')
+		i++;
+	if (s[i] != ')')
+		return (0);
+	name = ft_substr(s, p->pos, len);
+	valid = (name != NULL && is_valid_identifier(name));
+	free(name);
+	return (valid);
+}
+
+/**
+ * @brief Checks whether the cursor is on the start of a compound command.
+ *
+ * @param p The script parser state.
+ * @return 1 on a reserved word opening a compound command, `{` or a
+ *         function definition, 0 otherwise.
+ */
+int	sp_at_compound(t_script_parser *p)
+{
+	static const char	*words[] = {"if", "while", "until", "for", "case",
+		"{", NULL};
+	int					i;
+
+	i = 0;
+	while (words[i] != NULL)
+	{
+		if (sp_at_word(p, words[i]))
+			return (1);
+		i++;
+	}
+	return (sp_at_funcdef(p));
+}
+
+/**
+ * @brief Parses a `{ list; }` group.
+ *
+ * @param p The script parser state, positioned on `{`.
+ * @return The NODE_GROUP node, or NULL on error.
+ */
+t_ast_node	*parse_group(t_script_parser *p)
+{
+	t_ast_node	*node;
+
+	p->pos += 1;
+	node = new_ast_node(NODE_GROUP);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->body = parse_body(p);
+	if (node->body == NULL || !sp_expect_word(p, "}"))
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
+
+/**
+ * @brief Skips the `(` `)` of a function header and the lines after it.
+ *
+ * @param p The script parser state, positioned after the function name.
+ */
+static void	skip_funcdef_parens(t_script_parser *p)
+{
+	sp_skip_blanks(p);
+	p->pos++;
+	sp_skip_blanks(p);
+	p->pos++;
+	sp_skip_newlines(p);
+}
+
+/**
+ * @brief Parses `name() compound-command`.
+ *
+ * The body is parsed here, once, together with any redirections written
+ * after it; they are applied on every call, not at definition time.
+ *
+ * @param p The script parser state, positioned on the function name.
+ * @return The NODE_FUNCDEF node, or NULL on error.
+ */
+t_ast_node	*parse_funcdef(t_script_parser *p)
+{
+	t_ast_node	*node;
+	size_t		len;
+
+	len = sp_word_len(p);
+	node = new_ast_node(NODE_FUNCDEF);
+	if (node == NULL)
+		return (sp_fail(p));
+	node->name = ft_substr(p->text, p->pos, len);
+	if (node->name == NULL)
+		return (free_ast(node), sp_fail(p));
+	p->pos += len;
+	skip_funcdef_parens(p);
+	if (!sp_at_compound(p) || sp_at_funcdef(p))
+		return (free_ast(node), sp_syntax_error(p), sp_fail(p));
+	node->body = parse_command(p);
+	if (node->body == NULL)
+		return (free_ast(node), sp_fail(p));
+	return (node);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_prefix.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 15:22:10 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 15:22:10 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Consumes a `pipesize SIZE` prefix of a pipeline.
+ *
+ * @param p The script parser state.
+ * @param size Receives the capacity; see parse_pipe_size().
+ * @return 1 if a prefix was consumed, 0 if there is none, -1 on a missing
+ *         or invalid size.
+ */
+static int	sp_take_pipe_size(t_script_parser *p, long *size)
+{
+	size_t	len;
+	char	*word;
+
+	if (!sp_at_word(p, "pipesize"))
+		return (0);
+	p->pos += 8;
+	sp_skip_blanks(p);
+	len = sp_word_len(p);
+	if (len == 0 && (p->text[p->pos] == '\n' || p->text[p->pos] == '\0'))
+		sp_unexpected(p, "newline");
+	else if (len == 0)
+		sp_syntax_error(p);
+	if (len == 0)
+		return (-1);
+	word = ft_strndup(p->text + p->pos, len);
+	if (word == NULL)
+		return (sp_fail(p), -1);
+	*size = parse_pipe_size(word);
+	if (*size == 0)
+		sp_unexpected(p, word);
+	free(word);
+	p->pos += len;
+	if (*size == 0)
+		return (-1);
+	return (1);
+}
+
+/**
+ * @brief Consumes the prefixes of a pipeline, in any order:
+ * `time [-p]`, `!` and `pipesize SIZE`, each at most once.
+ *
+ * @param p The script parser state.
+ * @param pre Receives the prefixes found.
+ * @return 1 on success, 0 on a syntax error.
+ */
+int	sp_take_prefixes(t_script_parser *p, t_pipeline_prefix *pre)
+{
+	int	took;
+
+	ft_bzero(pre, sizeof(t_pipeline_prefix));
+	took = 1;
+	while (took > 0)
+	{
+		took = 0;
+		if (pre->timed == 0)
+		{
+			pre->timed = sp_take_time(p);
+			took = (pre->timed != 0);
+		}
+		if (took == 0 && !pre->negate && sp_at_word(p, "!"))
+		{
+			p->pos++;
+			pre->negate = 1;
+			took = 1;
+		}
+		if (took == 0 && pre->pipe_size == 0)
+			took = sp_take_pipe_size(p, &pre->pipe_size);
+	}
+	return (took == 0);
+}
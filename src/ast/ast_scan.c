@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_scan.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Skips blanks and a trailing comment at the parser cursor.
+ *
+ * A `#` found where a word could start begins a comment that runs up to,
+ * but not including, the next newline.
+ *
+ * @param p The script parser state.
+ */
+void	sp_skip_blanks(t_script_parser *p)
+{
+	const char	*s;
+
+	s = p->text;
+	while (s[p->pos] == ' ' || s[p->pos] == '\t')
+		p->pos++;
+	if (s[p->pos] == '#')
+	{
+		while (s[p->pos] != '\0' && s[p->pos] != '\n')
+			p->pos++;
+	}
+}
+
+/**
+ * @brief Skips blanks, comments and any number of newlines.
+ *
+ * The heredoc bodies read after a newline (see sp_take_heredocs()) are
+ * skipped along with it.
+ *
+ * @param p The script parser state.
+ */
+void	sp_skip_newlines(t_script_parser *p)
+{
+	sp_skip_blanks(p);
+	while (p->text[p->pos] == '\n')
+	{
+		if (p->heredoc_next != 0 && p->pos == p->heredoc_nl)
+		{
+			p->pos = p->heredoc_next;
+			p->heredoc_next = 0;
+		}
+		else
+			p->pos++;
+		sp_skip_blanks(p);
+	}
+}
+
+/**
+ * @brief Measures the word starting at the parser cursor.
+ *
+ * A word ends at the first unquoted blank, newline or shell operator
+ * character. Quoted sections are part of the word.
+ *
+ * @param p The script parser state.
+ * @return The length of the word, 0 if the cursor is on an operator.
+ */
+size_t	sp_word_len(t_script_parser *p)
+{
+	const char	*s;
+	size_t		i;
+	char		quote;
+
+	s = p->text + p->pos;
+	i = 0;
+	quote = 0;
+	while (s[i] != '\0')
+	{
+		if (quote == 0 && ft_strchr(" \t\n;&|()<>", s[i]))
+			break ;
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Checks whether the next word is exactly the given reserved word.
+ *
+ * Only an unquoted word that matches in full is recognized, so `done`
+ * matches but `doner` or `"done"` do not.
+ *
+ * @param p The script parser state.
+ * @param word The reserved word to look for.
+ * @return 1 if the next word is `word`, 0 otherwise.
+ */
+int	sp_at_word(t_script_parser *p, const char *word)
+{
+	size_t	len;
+
+	sp_skip_blanks(p);
+	len = ft_strlen(word);
+	if (sp_word_len(p) != len)
+		return (0);
+	return (ft_strncmp(p->text + p->pos, word, len) == 0);
+}
+
+/**
+ * @brief Checks whether the text at the cursor starts with an operator.
+ *
+ * @param p The script parser state.
+ * @param op The operator to look for, e.g. "&&" or ";;".
+ * @return 1 if the operator is found at the cursor, 0 otherwise.
+ */
+int	sp_at_op(t_script_parser *p, const char *op)
+{
+	sp_skip_blanks(p);
+	return (ft_strncmp(p->text + p->pos, op, ft_strlen(op)) == 0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_scan_helper.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/11 12:48:21 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks whether an unquoted character ends a simple command.
+ *
+ * @param s The script text.
+ * @param i The index of the character to check.
+ * @return 1 if a simple command stops at `s[i]`, 0 otherwise.
+ */
+static int	is_command_stop(const char *s, size_t i)
+{
+	if (s[i] == '\n' || s[i] == ';' || s[i] == '|')
+		return (1);
+	if (s[i] == '&' && s[i + 1] == '&')
+		return (1);
+	if (s[i] == '#' && i > 0 && (s[i - 1] == ' ' || s[i - 1] == '\t'))
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Finds the end of the simple command starting at the cursor.
+ *
+ * The command runs up to the first unquoted newline, `;`, `|`, `&&` or
+ * comment. An unterminated quote marks the script as incomplete.
+ *
+ * @param p The script parser state.
+ * @return The index just past the last character of the command.
+ */
+size_t	sp_command_end(t_script_parser *p)
+{
+	const char	*s;
+	size_t		i;
+	char		quote;
+
+	s = p->text;
+	i = p->pos;
+	quote = 0;
+	while (s[i] != '\0' && (quote || !is_command_stop(s, i)))
+	{
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote && s[i] == quote)
+			quote = 0;
+		i++;
+	}
+	if (quote && p->status == AST_OK)
+		p->status = AST_INCOMPLETE;
+	return (i);
+}
+
+/**
+ * @brief Checks whether the cursor is at the end of the script.
+ *
+ * @param p The script parser state.
+ * @return 1 if only blanks or a comment remain on the text, 0 otherwise.
+ */
+int	sp_at_eof(t_script_parser *p)
+{
+	sp_skip_blanks(p);
+	return (p->text[p->pos] == '\0');
+}
+
+/**
+ * @brief Checks whether the cursor is on a word or operator closing a list.
+ *
+ * @param p The script parser state.
+ * @return 1 if the current list must stop here, 0 otherwise.
+ */
+int	sp_at_list_end(t_script_parser *p)
+{
+	static const char	*words[] = {"then", "elif", "else", "fi", "do",
+		"done", "esac", "}", NULL};
+	int					i;
+
+	if (sp_at_eof(p) || sp_at_op(p, ";;"))
+		return (1);
+	i = 0;
+	while (words[i] != NULL)
+	{
+		if (sp_at_word(p, words[i]))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Consumes the expected reserved word or reports a syntax error.
+ *
+ * @param p The script parser state.
+ * @param word The reserved word that must come next.
+ * @return 1 if the word was consumed, 0 on error or end of input.
+ */
+int	sp_expect_word(t_script_parser *p, const char *word)
+{
+	if (p->status != AST_OK)
+		return (0);
+	sp_skip_newlines(p);
+	if (sp_at_word(p, word))
+	{
+		p->pos += ft_strlen(word);
+		return (1);
+	}
+	sp_syntax_error(p);
+	return (0);
+}
@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_source_cache.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/12 09:47:10 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 14:36:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <sys/mman.h>
+
+/**
+ * @brief Maps a script file read-only as a NUL-terminated string.
+ *
+ * An anonymous mapping one byte longer than the file, rounded up to whole
+ * pages, is reserved first and the file is mapped over its start. The
+ * text is then always followed by a zero byte, even when the file size is
+ * a multiple of the page size, and is never copied.
+ *
+ * @param fd The open script file.
+ * @param size The size of the file.
+ * @param map_len Receives the length to pass to munmap().
+ * @return The mapped text, or NULL on error.
+ */
+static char	*map_script(int fd, size_t size, size_t *map_len)
+{
+	size_t	page;
+	char	*text;
+	void	*file;
+
+	page = (size_t)sysconf(_SC_PAGESIZE);
+	*map_len = (size / page + 1) * page;
+	text = mmap(NULL, *map_len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (text == MAP_FAILED)
+		return (NULL);
+	if (size == 0)
+		return (text);
+	file = mmap(text, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+	if (file == MAP_FAILED)
+	{
+		munmap(text, *map_len);
+		return (NULL);
+	}
+	return (text);
+}
+
+/**
+ * @brief Parses a script file straight from its mapping.
+ *
+ * Heredoc bodies are read from the file along with the commands, never
+ * from the input of the shell running `source`; the whole file is there,
+ * so a heredoc left open ends with it.
+ *
+ * @param path The path of the file.
+ * @param st The file status, taken just before.
+ * @param ast Receives the parsed list (NULL for an empty script).
+ * @param pd The process data, used for error reporting.
+ * @return 0 on success, 1 if the file cannot be read, 2 on a syntax error.
+ */
+static int	parse_source_file(const char *path, struct stat *st,
+				t_ast_node **ast, t_process_data *pd)
+{
+	int		fd;
+	int		err;
+	char	*text;
+	size_t	map_len;
+	int		status;
+
+	if (S_ISDIR(st->st_mode))
+		return (ft_error((char *)path, "is a directory"), 1);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (ft_error((char *)path, strerror(errno)), 1);
+	text = map_script(fd, (size_t)st->st_size, &map_len);
+	err = errno;
+	close(fd);
+	if (text == NULL)
+		return (ft_error((char *)path, strerror(err)), 1);
+	status = parse_script(text, ast, pd, 1);
+	munmap(text, map_len);
+	if (status == AST_INCOMPLETE)
+		ft_error((char *)path, "syntax error: unexpected end of file");
+	if (status != AST_OK)
+		return (2);
+	return (0);
+}
+
+/**
+ * @brief Finds the up-to-date cache entry of a file.
+ *
+ * An entry for the same path whose device, inode, modification time or
+ * size differ is stale: it loses its path, so it is never found again,
+ * but its tree is kept since function bodies may point into it.
+ *
+ * @param path The path of the file.
+ * @param st The current file status.
+ * @param pd The process data holding the cache.
+ * @return The entry, or NULL if the file must be parsed.
+ */
+static t_source_cache	*find_entry(const char *path, struct stat *st,
+							t_process_data *pd)
+{
+	t_source_cache	*entry;
+
+	entry = pd->sources;
+	while (entry != NULL && (entry->path == NULL
+			|| ft_strncmp(entry->path, path, ft_strlen(path) + 1) != 0))
+		entry = entry->next;
+	if (entry == NULL)
+		return (NULL);
+	if (source_entry_current(entry, st))
+		return (entry);
+	free(entry->path);
+	entry->path = NULL;
+	return (NULL);
+}
+
+/**
+ * @brief Returns the parsed form of a script file, parsing it if needed.
+ *
+ * A file that has not changed since it was last sourced costs a single
+ * stat(); otherwise it is mapped, parsed once and cached for the session.
+ *
+ * @param path The path of the file.
+ * @param pd The process data holding the cache.
+ * @param status Receives 0 on success, 1 if the file cannot be read, or
+ *               2 on a syntax error.
+ * @return The cache entry, whose `ast` is NULL for an empty script, or
+ *         NULL on error.
+ */
+t_source_cache	*load_source(const char *path, t_process_data *pd, int *status)
+{
+	struct stat		st;
+	t_source_cache	*entry;
+
+	*status = 1;
+	if (stat(path, &st) == -1)
+		return (ft_error((char *)path, strerror(errno)), NULL);
+	*status = 0;
+	entry = find_entry(path, &st, pd);
+	if (entry != NULL)
+		return (entry);
+	entry = ft_calloc(1, sizeof(t_source_cache));
+	if (entry == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	*status = parse_source_file(path, &st, &entry->ast, pd);
+	entry->path = ft_strdup(path);
+	if (*status != 0 || entry->path == NULL)
+		return (free_ast(entry->ast), free(entry->path), free(entry), NULL);
+	entry->dev = st.st_dev;
+	entry->ino = st.st_ino;
+	entry->mtime = st.st_mtim;
+	entry->size = st.st_size;
+	entry->next = pd->sources;
+	pd->sources = entry;
+	return (entry);
+}
+
+/**
+ * @brief Frees every cached script, stale or not.
+ *
+ * @param pd The process data holding the cache.
+ */
+void	free_source_cache(t_process_data *pd)
+{
+	t_source_cache	*next;
+
+	while (pd->sources != NULL)
+	{
+		next = pd->sources->next;
+		free(pd->sources->path);
+		free(pd->sources->name);
+		free(pd->sources->path_value);
+		free_ast(pd->sources->ast);
+		free(pd->sources);
+		pd->sources = next;
+	}
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_source_lookup.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 14:36:08 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 14:36:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether a cache entry still describes the file it was
+ * parsed from: same device, inode, modification time and size.
+ *
+ * @param entry The cache entry.
+ * @param st The current status of the file.
+ * @return 1 if the entry is up to date, 0 otherwise.
+ */
+int	source_entry_current(t_source_cache *entry, struct stat *st)
+{
+	return (entry->dev == st->st_dev && entry->ino == st->st_ino
+		&& entry->size == st->st_size
+		&& entry->mtime.tv_sec == st->st_mtim.tv_sec
+		&& entry->mtime.tv_nsec == st->st_mtim.tv_nsec);
+}
+
+/**
+ * @brief Returns the value of PATH, or NULL if it is unset.
+ */
+static char	*current_path_value(t_process_data *pd)
+{
+	t_env_var	*var;
+
+	var = find_env_var("PATH", pd->env_list);
+	if (var == NULL)
+		return (NULL);
+	return (var->value);
+}
+
+/**
+ * @brief Tells whether two strings, either of them possibly NULL, are
+ * the same.
+ */
+static int	same_value(const char *a, const char *b)
+{
+	if (a == NULL || b == NULL)
+		return (a == b);
+	return (ft_strncmp(a, b, ft_strlen(a) + 1) == 0);
+}
+
+/**
+ * @brief Finds the cached file a name without a slash was last found at
+ * by `source`, while PATH is unchanged.
+ *
+ * The PATH search is not done again: the file is only stat()ed, once,
+ * to check that the entry is still up to date. A file added since then
+ * to an earlier directory of PATH is not noticed, as with the hashed
+ * paths of commands in other shells.
+ *
+ * @param name The name given to `source`.
+ * @param pd The process data holding the cache.
+ * @return The up-to-date entry, or NULL if the name must be looked up.
+ */
+t_source_cache	*find_source_name(const char *name, t_process_data *pd)
+{
+	t_source_cache	*entry;
+	char			*value;
+	struct stat		st;
+
+	value = current_path_value(pd);
+	entry = pd->sources;
+	while (entry != NULL && (entry->path == NULL || entry->name == NULL
+			|| ft_strncmp(entry->name, name, ft_strlen(name) + 1) != 0
+			|| !same_value(entry->path_value, value)))
+		entry = entry->next;
+	if (entry == NULL || stat(entry->path, &st) == -1
+		|| !source_entry_current(entry, &st))
+		return (NULL);
+	return (entry);
+}
+
+/**
+ * @brief Records that a name without a slash was found by `source` at
+ * the file of a cache entry, under the current PATH.
+ *
+ * @param entry The cache entry of the file.
+ * @param name The name given to `source`.
+ * @param pd The process data, used for PATH.
+ */
+void	remember_source_name(t_source_cache *entry, const char *name,
+		t_process_data *pd)
+{
+	char	*value;
+
+	if (ft_strchr(name, '/') != NULL)
+		return ;
+	free(entry->name);
+	free(entry->path_value);
+	value = current_path_value(pd);
+	entry->name = ft_strdup(name);
+	entry->path_value = NULL;
+	if (value != NULL)
+		entry->path_value = ft_strdup(value);
+	if (entry->name == NULL || (value != NULL && entry->path_value == NULL))
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+}
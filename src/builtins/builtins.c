@@ -6,12 +6,65 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/28 09:00:14 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 09:05:58 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
+/**
+ * @brief Returns the table of built-in commands.
+ *
+ * Every builtin is reached through an adapter with the same signature, so
+ * adding one is a matter of adding a row here. Tab completion offers
+ * every name of the table as a command.
+ *
+ * @return The table, terminated by a row with a NULL name.
+ */
+const t_builtin	*builtin_table(void)
+{
+	static const t_builtin	table[] = {
+	{"echo", builtin_echo, NULL}, {"cd", builtin_cd, NULL},
+	{"pwd", builtin_pwd, NULL}, {"exit", builtin_exit, NULL},
+	{"env", builtin_env, NULL}, {"export", builtin_export, NULL},
+	{"unset", builtin_unset, NULL}, {"break", run_break, NULL},
+	{"continue", run_continue, NULL}, {"true", run_true, NULL},
+	{":", run_true, NULL}, {"false", run_false, NULL},
+	{"local", run_local, NULL}, {"return", run_return, NULL},
+	{"source", run_source, NULL}, {".", run_source, NULL},
+	{"read", run_read, NULL}, {"printf", run_printf, NULL},
+	{"test", run_test, NULL}, {"[", run_test, NULL},
+	{"stats", run_stats, NULL}, {"shellstat", run_shellstat, NULL},
+	{"cat", run_cat, cat_accepts}, {"tee", run_tee, tee_accepts},
+	{"exec", run_exec, NULL}, {"declare", run_declare, NULL},
+	{"history", run_history, NULL}, {NULL, NULL, NULL}
+	};
+
+	return (table);
+}
+
+/**
+ * @brief Looks up a built-in command by name.
+ *
+ * @param name The command name.
+ * @return The matching table entry, or NULL if `name` is not a builtin.
+ */
+const t_builtin	*find_builtin(const char *name)
+{
+	const t_builtin	*entry;
+
+	if (name == NULL)
+		return (NULL);
+	entry = builtin_table();
+	while (entry->name != NULL)
+	{
+		if (ft_strncmp(name, entry->name, ft_strlen(entry->name) + 1) == 0)
+			return (entry);
+		entry++;
+	}
+	return (NULL);
+}
+
 /**
  * @brief Executes a built-in command.
  *
@@ -22,43 +75,33 @@
  */
 int	run_builtin(char **args, t_process_data *process_data)
 {
+	const t_builtin	*entry;
+
 	if (args == NULL || args[0] == NULL)
 		return (1);
-	if (ft_strncmp(args[0], "echo", 5) == 0)
-		return (run_echo(args, process_data->env_list), 0);
-	if (ft_strncmp(args[0], "cd", 3) == 0)
-		return (run_cd(args, process_data->env_list));
-	if (ft_strncmp(args[0], "pwd", 4) == 0)
-		return (run_pwd());
-	if (ft_strncmp(args[0], "exit", 5) == 0)
-	{
-		cleanup_child_pipeline_resources(process_data);
-		return (run_exit(args, process_data->last_exit_status));
-	}
-	if (ft_strncmp(args[0], "env", 4) == 0)
-		return (run_env(process_data->env_list), 0);
-	if (ft_strncmp(args[0], "export", 7) == 0)
-		return (run_export(process_data->env_list, args));
-	if (ft_strncmp(args[0], "unset", 6) == 0)
-		return (run_unset(&(process_data->env_list), args));
-	return (0);
+	entry = find_builtin(args[0]);
+	if (entry == NULL)
+		return (0);
+	return (entry->fn(args, process_data));
 }
 
 /**
- * @brief Checks if a command is a built-in.
+ * @brief Checks if a command is run by a built-in.
+ *
+ * A builtin such as `cat` only covers some options; with the others the
+ * external command runs instead.
  *
- * @param cmd The command to check.
+ * @param args The command and its arguments.
  * @return 1 if the command is a built-in, 0 otherwise.
  */
-int	is_builtin(char *cmd)
+int	is_builtin(char **args)
 {
-	if (cmd == NULL)
+	const t_builtin	*entry;
+
+	if (args == NULL)
+		return (0);
+	entry = find_builtin(args[0]);
+	if (entry == NULL)
 		return (0);
-	return (ft_strncmp(cmd, "echo", 5) == 0
-		|| ft_strncmp(cmd, "cd", 3) == 0
-		|| ft_strncmp(cmd, "pwd", 4) == 0
-		|| ft_strncmp(cmd, "exit", 5) == 0
-		|| ft_strncmp(cmd, "env", 4) == 0
-		|| ft_strncmp(cmd, "export", 7) == 0
-		|| ft_strncmp(cmd, "unset", 6) == 0);
+	return (entry->accepts == NULL || entry->accepts(args));
 }
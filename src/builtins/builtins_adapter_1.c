@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_adapter_1.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Adapter for the `echo` builtin.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return Always 0.
+ */
+int	builtin_echo(char **args, t_process_data *process_data)
+{
+	run_echo(args, process_data->env_list);
+	return (0);
+}
+
+/**
+ * @brief Adapter for the `cd` builtin.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return The exit status of `cd`.
+ */
+int	builtin_cd(char **args, t_process_data *process_data)
+{
+	return (run_cd(args, process_data->env_list));
+}
+
+/**
+ * @brief Adapter for the `pwd` builtin.
+ *
+ * @param args The command and its arguments (unused).
+ * @param process_data The process data (unused).
+ * @return The exit status of `pwd`.
+ */
+int	builtin_pwd(char **args, t_process_data *process_data)
+{
+	(void)args;
+	(void)process_data;
+	return (run_pwd());
+}
+
+/**
+ * @brief Adapter for the `exit` builtin.
+ *
+ * Pipeline resources are released first, since `exit` does not return
+ * unless it is given too many arguments.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return 1 if there were too many arguments; otherwise does not return.
+ */
+int	builtin_exit(char **args, t_process_data *process_data)
+{
+	cleanup_child_pipeline_resources(process_data);
+	return (run_exit(args, process_data->last_exit_status));
+}
+
+/**
+ * @brief Adapter for the `env` builtin.
+ *
+ * @param args The command and its arguments (unused).
+ * @param process_data The process data.
+ * @return Always 0.
+ */
+int	builtin_env(char **args, t_process_data *process_data)
+{
+	(void)args;
+	run_env(process_data->env_list);
+	return (0);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_adapter_2.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Moves the shell-local variables named by `export` arguments
+ * (`NAME`, `NAME=value` or `NAME+=value`) into the environment, so that
+ * run_export() finds them there with their current value.
+ *
+ * @param args The command and its arguments.
+ * @param pd The process data.
+ */
+static void	export_local_names(char **args, t_process_data *pd)
+{
+	char	*name;
+	size_t	len;
+
+	while (*(++args) != NULL)
+	{
+		len = 0;
+		while ((*args)[len] != '\0' && (*args)[len] != '='
+			&& ft_strncmp(*args + len, "+=", 2) != 0)
+			len++;
+		name = ft_substr(*args, 0, len);
+		if (name == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		export_shell_var(name, pd);
+		free(name);
+	}
+}
+
+/**
+ * @brief Adapter for the `export` builtin.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return The exit status of `export`.
+ */
+int	builtin_export(char **args, t_process_data *process_data)
+{
+	export_local_names(args, process_data);
+	invalidate_envp(process_data);
+	return (run_export(process_data->env_list, args));
+}
+
+/**
+ * @brief Adapter for the `unset` builtin.
+ *
+ * Arrays are removed too, and `unset 'name[sub]'` removes one element.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return The exit status of `unset`.
+ */
+int	builtin_unset(char **args, t_process_data *process_data)
+{
+	unset_array_args(args, process_data);
+	run_unset(&(process_data->shell_vars), args);
+	invalidate_envp(process_data);
+	return (run_unset(&(process_data->env_list), args));
+}
+
+/**
+ * @brief Executes the `true` and `:` builtins.
+ *
+ * @param args The command and its arguments (ignored).
+ * @param process_data The process data (unused).
+ * @return Always 0.
+ */
+int	run_true(char **args, t_process_data *process_data)
+{
+	(void)args;
+	(void)process_data;
+	return (0);
+}
+
+/**
+ * @brief Executes the `false` builtin.
+ *
+ * @param args The command and its arguments (ignored).
+ * @param process_data The process data (unused).
+ * @return Always 1.
+ */
+int	run_false(char **args, t_process_data *process_data)
+{
+	(void)args;
+	(void)process_data;
+	return (1);
+}
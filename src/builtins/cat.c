@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cat.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 17:02:15 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether an argument of `cat` is an option rather than a
+ * file (`-` alone means standard input).
+ */
+static int	is_cat_option(const char *arg)
+{
+	return (arg[0] == '-' && arg[1] != '\0');
+}
+
+/**
+ * @brief Tells whether the builtin `cat` handles these arguments.
+ *
+ * Only `-u` (which asks for what the builtin always does) is supported;
+ * with any other option, such as `-n`, the external cat is run instead.
+ *
+ * @param args The command and its arguments.
+ * @return 1 if the builtin can run them, 0 otherwise.
+ */
+int	cat_accepts(char **args)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] != NULL && ft_strncmp(args[i], "--", 3) != 0)
+	{
+		if (is_cat_option(args[i]) && ft_strncmp(args[i], "-u", 3) != 0)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Tells whether a file of `cat` is also its output, which would
+ * make an appending `cat f >> f` grow without end.
+ *
+ * @param fd The descriptor of the file.
+ * @return 1 if both are the same regular file and it is not empty (as
+ *         after `cat f > f`), 0 otherwise.
+ */
+static int	is_output_file(int fd)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+
+	if (fstat(fd, &in_st) == -1 || fstat(STDOUT_FILENO, &out_st) == -1)
+		return (0);
+	return (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode)
+		&& in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino
+		&& in_st.st_size > 0);
+}
+
+/**
+ * @brief Copies one file (or standard input, for `-`) to standard output.
+ *
+ * @param name The file name.
+ * @param status The exit status of `cat`, raised on failure.
+ */
+static void	cat_file(char *name, int *status)
+{
+	int	fd;
+	int	ret;
+
+	fd = STDIN_FILENO;
+	if (ft_strncmp(name, "-", 2) != 0)
+		fd = open(name, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+	{
+		ft_error_with_arg("cat", name, strerror(errno));
+		ret = 1;
+	}
+	else if (is_output_file(fd))
+	{
+		ft_error_with_arg("cat", name, "input file is output file");
+		ret = 1;
+	}
+	else if (copy_fd(fd, STDOUT_FILENO) == -1)
+		ret = copy_error("cat", name);
+	else
+		ret = 0;
+	if (fd != STDIN_FILENO && fd != -1)
+		close(fd);
+	if (ret > *status)
+		*status = ret;
+}
+
+/**
+ * @brief Executes the `cat [-u] [file ...]` builtin.
+ *
+ * Data moves with copy_file_range() or splice() where the descriptors
+ * allow it; see copy_fd(). A failing file does not stop the others, but a
+ * closed output or Ctrl-C does.
+ *
+ * @param args The command, its options and the files.
+ * @param process_data The process data.
+ * @return 0 on success, 1 if a file failed, or 128 + the signal number.
+ */
+int	run_cat(char **args, t_process_data *process_data)
+{
+	int	status;
+	int	i;
+	int	operands;
+	int	dashdash;
+
+	sync_read_buffer(process_data);
+	status = 0;
+	operands = 0;
+	dashdash = 0;
+	i = 0;
+	while (args[++i] != NULL && status <= 1)
+	{
+		if (!dashdash && ft_strncmp(args[i], "--", 3) == 0)
+			dashdash = 1;
+		else if (dashdash || !is_cat_option(args[i]))
+		{
+			cat_file(args[i], &status);
+			operands++;
+		}
+	}
+	if (operands == 0)
+		cat_file("-", &status);
+	return (status);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   copy_fd.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether a failed zero-copy call means "not supported for
+ * these descriptors" rather than a real I/O error.
+ */
+static int	zero_copy_unsupported(int err)
+{
+	return (err == EINVAL || err == ENOSYS || err == EXDEV
+		|| err == EBADF || err == EOPNOTSUPP);
+}
+
+/**
+ * @brief Copies between two regular files with copy_file_range(), which
+ * lets the kernel (or the filesystem, with reflinks) do the work.
+ *
+ * @return 1 once the input is exhausted, 0 if the descriptors do not
+ *         support it and nothing was copied, -1 on error.
+ */
+static int	copy_by_range(int in, int out)
+{
+	ssize_t	n;
+	int		moved;
+
+	moved = 0;
+	n = copy_file_range(in, NULL, out, NULL, COPY_CHUNK, 0);
+	while ((n > 0 || (n == -1 && errno == EINTR))
+		&& g_signal_received != SIGINT)
+	{
+		moved |= (n > 0);
+		n = copy_file_range(in, NULL, out, NULL, COPY_CHUNK, 0);
+	}
+	if (n == 0)
+		return (1);
+	if (g_signal_received == SIGINT)
+		errno = EINTR;
+	else if (!moved && zero_copy_unsupported(errno))
+		return (0);
+	return (-1);
+}
+
+/**
+ * @brief Moves data with splice() when either descriptor is a pipe; the
+ * pages go from one to the other without passing through user space.
+ *
+ * @return 1 once the input is exhausted, 0 if the descriptors do not
+ *         support it and nothing was moved, -1 on error.
+ */
+static int	copy_by_splice(int in, int out)
+{
+	ssize_t	n;
+	int		moved;
+
+	moved = 0;
+	n = splice(in, NULL, out, NULL, COPY_CHUNK, SPLICE_F_MOVE | SPLICE_F_MORE);
+	while ((n > 0 || (n == -1 && errno == EINTR))
+		&& g_signal_received != SIGINT)
+	{
+		moved |= (n > 0);
+		n = splice(in, NULL, out, NULL, COPY_CHUNK,
+				SPLICE_F_MOVE | SPLICE_F_MORE);
+	}
+	if (n == 0)
+		return (1);
+	if (g_signal_received == SIGINT)
+		errno = EINTR;
+	else if (!moved && zero_copy_unsupported(errno))
+		return (0);
+	return (-1);
+}
+
+/**
+ * @brief Copies through a COPY_BUF_SIZE buffer, for descriptors neither
+ * zero-copy call supports (terminals, sockets, O_APPEND files...).
+ *
+ * @return 1 once the input is exhausted, -1 on error.
+ */
+static int	copy_by_rw(int in, int out)
+{
+	char	*buf;
+	ssize_t	n;
+	int		ret;
+
+	buf = malloc(COPY_BUF_SIZE);
+	if (buf == NULL)
+		return (-1);
+	ret = 1;
+	n = copy_read(in, buf, COPY_BUF_SIZE);
+	while (n > 0 && ret == 1)
+	{
+		if (write_all(out, buf, n) == -1)
+			ret = -1;
+		else
+			n = copy_read(in, buf, COPY_BUF_SIZE);
+	}
+	free(buf);
+	if (n < 0)
+		return (-1);
+	return (ret);
+}
+
+/**
+ * @brief Copies everything left on `in` to `out`, the cheapest way the
+ * two descriptors allow.
+ *
+ * Regular files are copied with copy_file_range() (unless they claim to
+ * be empty, as /proc files do), anything involving a pipe is spliced, and
+ * the rest goes through a buffer. A terminal is never
+ * spliced from, so Ctrl-C can still interrupt the wait for input, and
+ * every pass checks for it, so an endless input (`cat /dev/zero`) can be
+ * stopped too.
+ *
+ * @param in The descriptor to read from.
+ * @param out The descriptor to write to.
+ * @return 0 on success, -1 on error with errno set (EINTR after Ctrl-C).
+ */
+int	copy_fd(int in, int out)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+	int			done;
+
+	if (fstat(in, &in_st) == -1 || fstat(out, &out_st) == -1)
+		return (-1);
+	done = 0;
+	if (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode)
+		&& in_st.st_size > 0)
+		done = copy_by_range(in, out);
+	else if ((S_ISFIFO(in_st.st_mode) || S_ISFIFO(out_st.st_mode))
+		&& !isatty(in))
+		done = copy_by_splice(in, out);
+	if (done == 0)
+		done = copy_by_rw(in, out);
+	if (done == 1)
+		return (0);
+	return (-1);
+}
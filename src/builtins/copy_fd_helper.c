@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   copy_fd_helper.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <poll.h>
+
+/**
+ * @brief Reads a chunk of input for `cat` or `tee`.
+ *
+ * A terminal is polled first: the shell's SIGINT handler restarts read()
+ * but never poll(), so this is where Ctrl-C gets through. Once Ctrl-C has
+ * been pressed nothing more is read, so an input that never blocks
+ * (`cat /dev/zero`) is stopped as well.
+ *
+ * @param fd The descriptor to read from.
+ * @param buf The buffer to fill.
+ * @param size The size of the buffer.
+ * @return The number of bytes read, 0 at end of file, -1 on error (EINTR
+ *         after Ctrl-C).
+ */
+ssize_t	copy_read(int fd, char *buf, size_t size)
+{
+	struct pollfd	pfd;
+	ssize_t			n;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	if (g_signal_received == SIGINT)
+	{
+		errno = EINTR;
+		return (-1);
+	}
+	while (isatty(fd) && poll(&pfd, 1, -1) == -1)
+	{
+		if (errno != EINTR || g_signal_received == SIGINT)
+			return (-1);
+	}
+	n = read(fd, buf, size);
+	while (n == -1 && errno == EINTR && g_signal_received != SIGINT)
+		n = read(fd, buf, size);
+	return (n);
+}
+
+/**
+ * @brief Writes a whole buffer, retrying short writes.
+ *
+ * @param fd The descriptor to write to.
+ * @param buf The data.
+ * @param len The number of bytes to write.
+ * @return 0 on success, -1 on error with errno set.
+ */
+int	write_all(int fd, const char *buf, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = write(fd, buf, len);
+		if (n == -1 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n == -1)
+			return (-1);
+		buf += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Turns a failed copy into the exit status of `cat` or `tee`.
+ *
+ * A closed output pipe ends the command quietly with the status it would
+ * have had if SIGPIPE had killed it, and Ctrl-C with that of SIGINT;
+ * anything else is reported.
+ *
+ * @param cmd The command name.
+ * @param arg The file being copied.
+ * @return The exit status.
+ */
+int	copy_error(char *cmd, char *arg)
+{
+	if (errno == EPIPE)
+		return (128 + SIGPIPE);
+	if (errno == EINTR)
+		return (128 + SIGINT);
+	ft_error_with_arg(cmd, arg, strerror(errno));
+	return (1);
+}
@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   declare.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Reports a bad option of `declare` along with the usage line.
+ *
+ * @param opt The option letter.
+ * @return 2, the exit status of `declare` on a usage error.
+ */
+static int	declare_usage_error(char opt)
+{
+	char	name[3];
+
+	name[0] = '-';
+	name[1] = opt;
+	name[2] = '\0';
+	ft_error_with_arg("declare", name, "invalid option");
+	ft_putstr_fd("declare: usage: declare [-aA] [name[=value] ...]\n",
+		STDERR_FILENO);
+	return (2);
+}
+
+/**
+ * @brief Parses the options of `declare`: `-a` (indexed array) and `-A`
+ * (associative array).
+ *
+ * @param args The arguments of `declare`.
+ * @param kind Receives 0 for `-a`, 1 for `-A` and -1 for neither.
+ * @param status Receives the exit status of `declare` on failure.
+ * @return The index of the first name, or -1 on failure.
+ */
+static int	parse_declare_options(char **args, int *kind, int *status)
+{
+	int	i;
+	int	j;
+
+	*kind = -1;
+	i = 1;
+	while (args[i] != NULL && args[i][0] == '-' && args[i][1] != '\0')
+	{
+		if (ft_strncmp(args[i], "--", 3) == 0)
+			return (i + 1);
+		j = 1;
+		while (args[i][j] == 'a' || args[i][j] == 'A')
+		{
+			*kind = (args[i][j] == 'A');
+			j++;
+		}
+		if (args[i][j] != '\0')
+		{
+			*status = declare_usage_error(args[i][j]);
+			return (-1);
+		}
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Makes `name` an array of the kind asked for, if any.
+ *
+ * @param name The variable name.
+ * @param kind 0 for an indexed array, 1 for an associative one, -1 for
+ *             neither.
+ * @param pd The process data.
+ * @return 0 on success, 1 after reporting an array of the other kind.
+ */
+static int	declare_kind(const char *name, int kind, t_process_data *pd)
+{
+	if (kind < 0 || declare_array(name, kind, pd) != NULL)
+		return (0);
+	if (kind)
+		ft_error_with_arg("declare", (char *)name,
+			"cannot convert indexed to associative array");
+	else
+		ft_error_with_arg("declare", (char *)name,
+			"cannot convert associative to indexed array");
+	return (1);
+}
+
+/**
+ * @brief Declares one name, with its value if one is given.
+ *
+ * @param arg The argument: `name`, `name=value`, `name+=value` or a
+ *            compound assignment `name=(...)`.
+ * @param kind The array kind asked for; see declare_kind().
+ * @param pd The process data.
+ * @return 0 on success, 1 on failure.
+ */
+static int	declare_one(char *arg, int kind, t_process_data *pd)
+{
+	char	*name;
+	size_t	len;
+	int		status;
+
+	len = 0;
+	while (arg[len] != '\0' && !ft_strchr("=+[", arg[len]))
+		len++;
+	name = ft_substr(arg, 0, len);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	status = !is_valid_identifier(name);
+	if (status)
+		error_with_backticked_arg("declare", arg, "not a valid identifier");
+	if (!status)
+		status = declare_kind(name, kind, pd);
+	if (!status && is_compound_assignment(arg))
+		status = assign_compound(arg, kind == 1, pd);
+	else if (!status && is_assignment_word(arg) == ASSIGN_ARRAY)
+		status = run_array_assignment(arg, pd);
+	else if (!status && is_assignment_word(arg) == ASSIGN_PLAIN)
+		set_shell_var(name, arg + len + 1, pd);
+	free(name);
+	return (status);
+}
+
+/**
+ * @brief Executes the `declare [-aA] [name[=value] ...]` builtin.
+ *
+ * Only the array attributes are supported; a name is declared in the
+ * global scope, also from inside a function.
+ *
+ * @param args The command, its options and the names.
+ * @param process_data The process data.
+ * @return 0 on success, 1 if a name could not be declared, or 2 on a
+ *         usage error.
+ */
+int	run_declare(char **args, t_process_data *process_data)
+{
+	int	kind;
+	int	status;
+	int	i;
+
+	i = parse_declare_options(args, &kind, &status);
+	if (i < 0)
+		return (status);
+	status = 0;
+	while (args[i] != NULL)
+	{
+		if (declare_one(args[i], kind, process_data) != 0)
+			status = 1;
+		i++;
+	}
+	return (status);
+}
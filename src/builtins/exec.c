@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 14:20:13 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds the program that `exec` is to run, the same way an
+ * external command is found.
+ *
+ * @param name The command name, or a path.
+ * @param pd The process data holding PATH.
+ * @param status Receives the exit status of `exec` on failure.
+ * @return The path to the program, or NULL after reporting the error.
+ */
+static char	*exec_program_path(char *name, t_process_data *pd, int *status)
+{
+	char		**path_dirs;
+	char		*path;
+	struct stat	st;
+
+	path_dirs = find_path_dirs(pd->env_list);
+	path = find_full_cmd_path(name, path_dirs);
+	free_split(path_dirs);
+	*status = 127;
+	if (path == NULL || stat(path, &st) != 0)
+	{
+		ft_error_with_arg("exec", name, "not found");
+		free(path);
+		return (NULL);
+	}
+	*status = 126;
+	if (S_ISDIR(st.st_mode) || access(path, X_OK) != 0)
+	{
+		ft_error_with_arg("exec", name, "cannot execute");
+		free(path);
+		return (NULL);
+	}
+	return (path);
+}
+
+/**
+ * @brief Executes the `exec [command [argument ...]]` builtin.
+ *
+ * With a command, the shell is replaced by it: the per-shell state is
+ * released (flushing the tracer, statistics and recorder) and the
+ * program is run in place of the shell. Without one, `exec` only keeps
+ * its redirections; see execute_exec_builtin().
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return 0 without a command, or 126/127 if the command cannot be run.
+ */
+int	run_exec(char **args, t_process_data *process_data)
+{
+	char	*path;
+	char	**envp;
+	int		status;
+
+	if (args[1] == NULL)
+		return (0);
+	path = exec_program_path(args[1], process_data, &status);
+	if (path == NULL)
+		return (status);
+	envp = env_list_to_array(process_data->env_list);
+	sync_read_buffer(process_data);
+	trace_exec(process_data->trace);
+	free_shell_state(process_data);
+	reset_child_signal_handlers();
+	execve(path, args + 1, envp);
+	ft_error_and_exit(args[1], strerror(errno), 126);
+	return (126);
+}
+
+/**
+ * @brief Tells whether descriptor `fd` is one the shell keeps for itself:
+ * the history file, the trace, the session log, or a descriptor saved by
+ * an enclosing redirection. Those are the close-on-exec ones from
+ * REDIR_FD_BASE up, apart from the targets `ops` itself has opened.
+ */
+static int	is_shell_fd(t_fd_op *ops, int fd)
+{
+	int	flags;
+
+	if (fd < REDIR_FD_BASE)
+		return (0);
+	flags = fcntl(fd, F_GETFD);
+	if (flags == -1 || !(flags & FD_CLOEXEC))
+		return (0);
+	while (ops != NULL)
+	{
+		if (ops->type != FD_DUP && ops->src == fd)
+			return (0);
+		ops = ops->next;
+	}
+	return (1);
+}
+
+/**
+ * @brief Refuses the redirections of `exec` that would replace or close
+ * one of the shell's own descriptors; see is_shell_fd().
+ *
+ * @param ops The redirection list.
+ * @return 0 if there is none, -1 after reporting the first one.
+ */
+static int	check_shell_fds(t_fd_op *ops)
+{
+	t_fd_op	*op;
+	char	*name;
+
+	op = ops;
+	while (op != NULL)
+	{
+		if (is_shell_fd(ops, op->fd))
+		{
+			name = ft_itoa(op->fd);
+			if (name == NULL)
+				ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+			ft_error(name, strerror(EBADF));
+			free(name);
+			return (-1);
+		}
+		op = op->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs `exec` in the shell itself.
+ *
+ * Unlike any other builtin, its redirections are not undone afterwards:
+ * `exec 3>>log` leaves descriptor 3 open on `log` for every command that
+ * follows, and `exec 3>&-` closes it again. A redirection that would
+ * take over one of the shell's own descriptors is refused.
+ *
+ * A command that cannot be run ends a non-interactive shell with the
+ * status of `exec` (126 or 127), as in bash; whether the shell is
+ * interactive is decided before the redirections move standard input.
+ *
+ * @param data The execution data with the arguments and redirections.
+ * @param process_data The process data.
+ * @return The exit status of `exec`.
+ */
+int	execute_exec_builtin(t_execute_data *data, t_process_data *process_data)
+{
+	int	interactive;
+	int	status;
+
+	sync_read_buffer(process_data);
+	trace_mark(process_data->trace, TRACE_BUILTIN);
+	interactive = isatty(STDIN_FILENO);
+	if (check_shell_fds(data->fd_ops) != 0
+		|| apply_fd_ops(data->fd_ops, 0) != 0)
+		return (1);
+	status = run_exec(data->clean_args, process_data);
+	if (interactive || data->clean_args[1] == NULL)
+		return (status);
+	cleanup_child_pipeline_resources(process_data);
+	exit(status);
+	return (status);
+}
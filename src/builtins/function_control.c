@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   function_control.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/11 12:15:33 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 09:14:36 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Remembers the current value of a variable before `local` sets it.
+ *
+ * Only the first `local` of a name in a call is recorded, so the value
+ * restored on return is the one from before the call.
+ *
+ * @param name The variable name.
+ * @param pd The process data; the value is saved on `pd->frame`.
+ */
+static void	save_local(const char *name, t_process_data *pd)
+{
+	t_env_var	*saved;
+	t_env_var	*var;
+
+	saved = pd->frame->saved;
+	while (saved != NULL && ft_strncmp(saved->key, name, ft_strlen(name) + 1))
+		saved = saved->next;
+	if (saved != NULL)
+		return ;
+	saved = ft_calloc(1, sizeof(t_env_var));
+	if (saved == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	saved->key = ft_strdup(name);
+	var = find_shell_var(name, pd);
+	if (var != NULL && var->value != NULL)
+		saved->value = ft_strdup(var->value);
+	if (saved->key == NULL || (var && var->value && saved->value == NULL))
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	saved->next = pd->frame->saved;
+	pd->frame->saved = saved;
+}
+
+/**
+ * @brief Declares one `name` or `name=value` argument of `local`.
+ *
+ * @param arg The argument.
+ * @param pd The process data.
+ * @return 0 on success, 1 if the name is not a valid identifier.
+ */
+static int	declare_local(const char *arg, t_process_data *pd)
+{
+	char	*name;
+	char	*equal_sign;
+
+	equal_sign = ft_strchr(arg, '=');
+	if (equal_sign != NULL)
+		name = ft_substr(arg, 0, equal_sign - arg);
+	else
+		name = ft_strdup(arg);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (!is_valid_identifier(name))
+	{
+		error_with_backticked_arg("local", arg, "not a valid identifier");
+		free(name);
+		return (1);
+	}
+	save_local(name, pd);
+	if (equal_sign != NULL)
+		set_shell_var(name, equal_sign + 1, pd);
+	else
+		set_shell_var(name, "", pd);
+	free(name);
+	return (0);
+}
+
+/**
+ * @brief Executes the `local name[=value]...` builtin.
+ *
+ * The previous values are put back when the function returns.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data.
+ * @return 0 on success, 1 outside a function or on an invalid name.
+ */
+int	run_local(char **args, t_process_data *process_data)
+{
+	int	status;
+	int	i;
+
+	if (process_data->frame == NULL)
+	{
+		ft_error("local", "can only be used in a function");
+		return (1);
+	}
+	status = 0;
+	i = 1;
+	while (args[i] != NULL)
+	{
+		if (declare_local(args[i], process_data) != 0)
+			status = 1;
+		i++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Executes the `return [n]` builtin.
+ *
+ * The function body or sourced script stops once the current command has
+ * unwound; see loop_should_stop() and call_function().
+ *
+ * @param args The command and its optional status.
+ * @param process_data The process data.
+ * @return The status to return with: `n`, or the last exit status.
+ */
+int	run_return(char **args, t_process_data *process_data)
+{
+	long long	code;
+
+	if (process_data->frame == NULL && process_data->source_depth == 0)
+	{
+		ft_error("return",
+			"can only `return' from a function or sourced script");
+		return (1);
+	}
+	code = process_data->last_exit_status;
+	if (args[1] != NULL && !ft_str_to_llong(args[1], &code))
+	{
+		ft_error_with_arg("return", args[1], "numeric argument required");
+		code = 2;
+	}
+	process_data->loop_ctl = LOOP_RETURN;
+	process_data->loop_levels = 0;
+	return ((unsigned char)code);
+}
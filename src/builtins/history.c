@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 17:26:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/23 17:26:51 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Prints a history entry as `history` lists it: its number, then
+ * the line.
+ *
+ * @param id The entry.
+ * @param line Its text.
+ */
+static void	print_entry(int id, const char *line)
+{
+	char	num[16];
+
+	snprintf(num, sizeof(num), "%5d  ", id + 1);
+	ft_putstr_fd(num, STDOUT_FILENO);
+	ft_putendl_fd((char *)line, STDOUT_FILENO);
+}
+
+/**
+ * @brief Lists the last HISTSIZE entries of the history, oldest first.
+ *
+ * @param idx The history index.
+ * @return 0.
+ */
+static int	list_history(t_hindex *idx)
+{
+	int	i;
+
+	i = 0;
+	if (idx->count > idx->limit)
+		i = idx->count - idx->limit;
+	while (i < idx->count)
+	{
+		print_entry(idx->base + i, idx->lines[i]);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Lists the entries of the history that contain `pattern`, newest
+ * first, as Ctrl-R visits them.
+ *
+ * @param idx The history index.
+ * @param pattern The pattern.
+ * @return 0 if an entry matched, 1 otherwise.
+ */
+static int	search_history(t_hindex *idx, const char *pattern)
+{
+	int	id;
+	int	found;
+
+	found = 0;
+	id = index_search(idx, pattern, INT_MAX);
+	while (id >= 0)
+	{
+		print_entry(id, idx->lines[id - idx->base]);
+		found = 1;
+		id = index_search(idx, pattern, id);
+	}
+	return (!found);
+}
+
+/**
+ * @brief Executes the `history` builtin.
+ *
+ * `history` lists the history, and `history -s pattern` the entries that
+ * contain `pattern`, found through the history index. A shell that is
+ * not interactive keeps no history, so there is nothing to list.
+ *
+ * @param args The command and its arguments.
+ * @param process_data The process data holding the history.
+ * @return 0 on success, 1 if `-s` matched nothing, 2 on a usage error.
+ */
+int	run_history(char **args, t_process_data *process_data)
+{
+	t_hindex	none;
+	t_hindex	*idx;
+
+	ft_bzero(&none, sizeof(t_hindex));
+	idx = &none;
+	if (process_data->history != NULL)
+		idx = &process_data->history->index;
+	if (args[1] == NULL)
+		return (list_history(idx));
+	if (ft_strncmp(args[1], "-s", 3) == 0 && args[2] != NULL
+		&& args[3] == NULL)
+		return (search_history(idx, args[2]));
+	ft_putstr_fd("history: usage: history [-s pattern]\n", STDERR_FILENO);
+	return (2);
+}
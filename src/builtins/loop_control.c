@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loop_control.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/10 14:21:07 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Records a pending `break` or `continue` for the enclosing loops.
+ *
+ * The loops themselves act on it once the current list has unwound; see
+ * loop_should_stop().
+ *
+ * @param args The command and its optional loop count.
+ * @param pd The process data.
+ * @param ctl LOOP_BREAK or LOOP_CONTINUE.
+ * @return 0 on success, 1 on an invalid loop count.
+ */
+static int	set_loop_control(char **args, t_process_data *pd, int ctl)
+{
+	long long	levels;
+
+	if (pd->loop_depth == 0)
+	{
+		ft_error(args[0],
+			"only meaningful in a `for', `while', or `until' loop");
+		return (0);
+	}
+	levels = 1;
+	if (args[1] != NULL && !ft_str_to_llong(args[1], &levels))
+	{
+		ft_error_with_arg(args[0], args[1], "numeric argument required");
+		return (1);
+	}
+	if (levels < 1)
+	{
+		ft_error_with_arg(args[0], args[1], "loop count out of range");
+		return (1);
+	}
+	if (levels > pd->loop_depth)
+		levels = pd->loop_depth;
+	pd->loop_ctl = ctl;
+	pd->loop_levels = (int)levels;
+	return (0);
+}
+
+/**
+ * @brief Executes the `break [n]` builtin.
+ *
+ * @param args The command and its optional loop count.
+ * @param process_data The process data.
+ * @return 0 on success, 1 on an invalid loop count.
+ */
+int	run_break(char **args, t_process_data *process_data)
+{
+	return (set_loop_control(args, process_data, LOOP_BREAK));
+}
+
+/**
+ * @brief Executes the `continue [n]` builtin.
+ *
+ * @param args The command and its optional loop count.
+ * @param process_data The process data.
+ * @return 0 on success, 1 on an invalid loop count.
+ */
+int	run_continue(char **args, t_process_data *process_data)
+{
+	return (set_loop_control(args, process_data, LOOP_CONTINUE));
+}
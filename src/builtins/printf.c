@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Formats a string argument with the spec of its conversion.
+ *
+ * @param spec The printf(3) spec of the conversion.
+ * @param arg The argument.
+ * @param run The state of the current `printf`.
+ */
+static void	emit_string(const char *spec, const char *arg, t_printf_run *run)
+{
+	int	n;
+
+	n = snprintf(NULL, 0, spec, arg);
+	if (n < 0)
+		return ;
+	printf_reserve(run, (size_t)n);
+	snprintf(run->data + run->len, (size_t)n + 1, spec, arg);
+	run->len += (size_t)n;
+}
+
+/**
+ * @brief Formats a numeric argument with the spec of its conversion.
+ *
+ * @param spec The printf(3) spec of the conversion.
+ * @param value The argument.
+ * @param run The state of the current `printf`.
+ */
+static void	emit_number(const char *spec, long long value, t_printf_run *run)
+{
+	int	n;
+
+	n = snprintf(NULL, 0, spec, value);
+	if (n < 0)
+		return ;
+	printf_reserve(run, (size_t)n);
+	snprintf(run->data + run->len, (size_t)n + 1, spec, value);
+	run->len += (size_t)n;
+}
+
+/**
+ * @brief Formats the next argument (or an empty one) for a conversion.
+ *
+ * @param seg The conversion segment.
+ * @param run The state of the current `printf`.
+ */
+static void	emit_conversion(t_fmt_seg *seg, t_printf_run *run)
+{
+	const char	*arg;
+	char		*decoded;
+
+	arg = "";
+	if (*run->args != NULL)
+		arg = *run->args++;
+	if (seg->conv == 's' || seg->conv == 'c')
+		emit_string(seg->text, arg, run);
+	else if (seg->conv == 'b')
+	{
+		decoded = printf_decode_b(arg, run);
+		emit_string(seg->text, decoded, run);
+		free(decoded);
+	}
+	else
+		emit_number(seg->text, printf_number(arg, run), run);
+}
+
+/**
+ * @brief Runs through the format once, consuming arguments as it goes.
+ *
+ * An invalid conversion is reported when reached, and ends the output.
+ *
+ * @param fmt The parsed format.
+ * @param run The state of the current `printf`.
+ */
+static void	emit_format(t_printf_format *fmt, t_printf_run *run)
+{
+	t_fmt_seg	*seg;
+	char		*message;
+
+	seg = fmt->segs;
+	while (seg != NULL && !run->stop)
+	{
+		if (seg->conv == 0)
+		{
+			printf_reserve(run, seg->len);
+			ft_memcpy(run->data + run->len, seg->text, seg->len);
+			run->len += seg->len;
+		}
+		else if (seg->conv != PRINTF_BAD)
+			emit_conversion(seg, run);
+		else
+		{
+			message = "invalid format character";
+			if (seg->len == 0)
+				message = "missing format character";
+			error_with_backticked_arg("printf", seg->text, message);
+			run->status = 1;
+			run->stop = 1;
+		}
+		seg = seg->next;
+	}
+}
+
+/**
+ * @brief Executes the `printf format [arguments]` builtin.
+ *
+ * The format is reused as long as arguments are left. The output is built
+ * in memory and written with a single write().
+ *
+ * @param args The command, the format and its arguments.
+ * @param process_data The process data holding the format cache.
+ * @return 0 on success, 1 if an argument or the format was invalid, 2 on a
+ *         usage error.
+ */
+int	run_printf(char **args, t_process_data *process_data)
+{
+	t_printf_format	*fmt;
+	t_printf_run	run;
+
+	args++;
+	if (*args != NULL && ft_strncmp(*args, "--", 3) == 0)
+		args++;
+	if (*args == NULL)
+	{
+		ft_putstr_fd("printf: usage: printf format [arguments]\n",
+			STDERR_FILENO);
+		return (2);
+	}
+	fmt = find_printf_format(*args, process_data);
+	ft_bzero(&run, sizeof(t_printf_run));
+	run.args = args + 1;
+	emit_format(fmt, &run);
+	while (fmt->convs > 0 && *run.args != NULL && !run.stop)
+		emit_format(fmt, &run);
+	if (run.len > 0 && write(STDOUT_FILENO, run.data, run.len) < 0)
+	{
+		ft_error_with_arg("printf", "write error", strerror(errno));
+		run.status = 1;
+	}
+	free(run.data);
+	return (run.status);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Frees a parsed `printf` format.
+ *
+ * @param fmt The format (may be NULL).
+ */
+static void	free_printf_format(t_printf_format *fmt)
+{
+	t_fmt_seg	*seg;
+	t_fmt_seg	*next;
+
+	if (fmt == NULL)
+		return ;
+	seg = fmt->segs;
+	while (seg != NULL)
+	{
+		next = seg->next;
+		free(seg->text);
+		free(seg);
+		seg = next;
+	}
+	free(fmt->source);
+	free(fmt);
+}
+
+/**
+ * @brief Keeps only the `keep` most recently used formats in the cache.
+ *
+ * @param pd The process data holding the cache.
+ * @param keep The number of formats to keep.
+ */
+static void	trim_printf_cache(t_process_data *pd, int keep)
+{
+	t_printf_format	**link;
+	t_printf_format	*next;
+
+	link = &pd->printf_formats;
+	while (*link != NULL && keep-- > 0)
+		link = &(*link)->next;
+	while (*link != NULL)
+	{
+		next = (*link)->next;
+		free_printf_format(*link);
+		*link = next;
+	}
+}
+
+/**
+ * @brief Returns the parsed form of a `printf` format.
+ *
+ * Scripts tend to run the same few formats over and over, so the last
+ * PRINTF_CACHE_MAX of them are kept parsed, most recently used first.
+ *
+ * @param src The format.
+ * @param pd The process data holding the cache.
+ * @return The parsed format, owned by the cache.
+ */
+t_printf_format	*find_printf_format(const char *src, t_process_data *pd)
+{
+	t_printf_format	**link;
+	t_printf_format	*fmt;
+
+	link = &pd->printf_formats;
+	while (*link != NULL
+		&& ft_strncmp((*link)->source, src, ft_strlen(src) + 1) != 0)
+		link = &(*link)->next;
+	fmt = *link;
+	if (fmt != NULL)
+		*link = fmt->next;
+	else
+	{
+		fmt = parse_printf_format(src);
+		trim_printf_cache(pd, PRINTF_CACHE_MAX - 1);
+	}
+	fmt->next = pd->printf_formats;
+	pd->printf_formats = fmt;
+	return (fmt);
+}
+
+/**
+ * @brief Frees every cached `printf` format.
+ *
+ * @param pd The process data holding the cache.
+ */
+void	free_printf_cache(t_process_data *pd)
+{
+	trim_printf_cache(pd, 0);
+}
@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_format.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 16:08:31 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Creates a format segment, exiting if memory runs out.
+ *
+ * @param conv The conversion letter, 0 for literal text or PRINTF_BAD.
+ * @param text The segment text; owned by the segment from now on.
+ * @param len The length of `text`.
+ * @return The new segment.
+ */
+static t_fmt_seg	*new_segment(char conv, char *text, size_t len)
+{
+	t_fmt_seg	*seg;
+
+	if (text == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	seg = malloc(sizeof(t_fmt_seg));
+	if (seg == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	seg->conv = conv;
+	seg->text = text;
+	seg->len = len;
+	seg->next = NULL;
+	return (seg);
+}
+
+/**
+ * @brief Parses literal text up to the next conversion, decoding escapes.
+ *
+ * `%%` stands for a single `%`.
+ *
+ * @param src The format.
+ * @param i The position in the format; moved past the text.
+ * @return The literal segment.
+ */
+static t_fmt_seg	*parse_literal(const char *src, size_t *i)
+{
+	char	*text;
+	size_t	len;
+
+	text = malloc(ft_strlen(src + *i) + 1);
+	len = 0;
+	while (text != NULL && src[*i] != '\0'
+		&& (src[*i] != '%' || src[*i + 1] == '%'))
+	{
+		if (src[*i] == '\\')
+		{
+			*i += printf_escape(src + *i + 1, text + len++, 0) + 1;
+			continue ;
+		}
+		if (src[*i] == '%')
+			(*i)++;
+		text[len++] = src[(*i)++];
+	}
+	return (new_segment(0, text, len));
+}
+
+/**
+ * @brief Turns a conversion such as `%-8.3d` into a printf(3) spec.
+ *
+ * Integers are printed as long long, and `%c` as a string cut to one
+ * character so that an empty argument prints nothing. `%b` is printed
+ * like `%s` once its argument has been decoded.
+ *
+ * @param src The conversion, starting at its `%`.
+ * @param prec The offset of the precision (its `.`) or of the conversion.
+ * @param end The offset of the conversion letter.
+ * @return The spec, or NULL on allocation failure.
+ */
+static char	*build_spec(const char *src, size_t prec, size_t end)
+{
+	char	*spec;
+	char	conv;
+
+	conv = src[end];
+	spec = malloc(end + 4);
+	if (spec == NULL)
+		return (NULL);
+	if (conv == 'c')
+		end = prec;
+	ft_memcpy(spec, src, end);
+	spec[end] = '\0';
+	if (conv == 'c')
+		ft_strlcat(spec, ".1s", end + 4);
+	else if (conv == 's' || conv == 'b')
+		ft_strlcat(spec, "s", end + 4);
+	else
+	{
+		ft_strlcat(spec, "ll", end + 4);
+		spec[end + 2] = conv;
+		spec[end + 3] = '\0';
+	}
+	return (spec);
+}
+
+/**
+ * @brief Parses the conversion at `src[*i]`, which is a `%`.
+ *
+ * An unknown or missing conversion letter yields a PRINTF_BAD segment
+ * holding the offending character (or `%`, with length 0, when the letter
+ * is missing); the rest of the format is skipped.
+ *
+ * @param src The format.
+ * @param i The position of the `%`; moved past the conversion.
+ * @return The conversion segment.
+ */
+static t_fmt_seg	*parse_conversion(const char *src, size_t *i)
+{
+	size_t	start;
+	size_t	prec;
+	char	conv;
+
+	start = (*i)++;
+	while (src[*i] != '\0' && ft_strchr("-+ #0", src[*i]) != NULL)
+		(*i)++;
+	while (ft_isdigit(src[*i]))
+		(*i)++;
+	prec = *i - start;
+	*i += (src[*i] == '.');
+	while (ft_isdigit(src[*i]))
+		(*i)++;
+	conv = src[*i];
+	if (conv == '\0' || ft_strchr("diouxXcsb", conv) == NULL)
+	{
+		if (conv == '\0')
+			return (new_segment(PRINTF_BAD, ft_strdup("%"), 0));
+		start = *i;
+		*i = ft_strlen(src);
+		return (new_segment(PRINTF_BAD, ft_substr(src, start, 1), 1));
+	}
+	(*i)++;
+	return (new_segment(conv,
+			build_spec(src + start, prec, *i - start - 1), 0));
+}
+
+/**
+ * @brief Parses a `printf` format into its segments.
+ *
+ * @param src The format.
+ * @return The parsed format; the program exits if memory runs out.
+ */
+t_printf_format	*parse_printf_format(const char *src)
+{
+	t_printf_format	*fmt;
+	t_fmt_seg		**tail;
+	t_fmt_seg		*seg;
+	size_t			i;
+
+	fmt = ft_calloc(1, sizeof(t_printf_format));
+	if (fmt != NULL)
+		fmt->source = ft_strdup(src);
+	if (fmt == NULL || fmt->source == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	tail = &fmt->segs;
+	i = 0;
+	while (src[i] != '\0')
+	{
+		if (src[i] == '%' && src[i + 1] != '%')
+			seg = parse_conversion(src, &i);
+		else
+			seg = parse_literal(src, &i);
+		if (seg->conv > PRINTF_BAD)
+			fmt->convs++;
+		*tail = seg;
+		tail = &seg->next;
+	}
+	return (fmt);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_helper.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Decodes up to `max` digits of an octal or hexadecimal escape.
+ *
+ * @param s The digits.
+ * @param base 8 or 16.
+ * @param max The largest number of digits to take.
+ * @param out Receives the byte (0 if there are no digits).
+ * @return The number of digits taken.
+ */
+static int	decode_number(const char *s, int base, int max, char *out)
+{
+	const char	*digits;
+	const char	*found;
+	int			value;
+	int			count;
+
+	digits = "0123456789abcdef";
+	value = 0;
+	count = 0;
+	while (count < max && s[count] != '\0')
+	{
+		found = ft_strchr(digits, ft_tolower(s[count]));
+		if (found == NULL || found - digits >= base)
+			break ;
+		value = value * base + (int)(found - digits);
+		count++;
+	}
+	*out = (char)value;
+	return (count);
+}
+
+/**
+ * @brief Decodes the backslash escape that starts just after `s[-1]`.
+ *
+ * Knows the C escapes, `\ooo` (`\0ooo` in a `%b` argument) and `\xHH`,
+ * plus `\c` in a `%b` argument. An unknown escape stands for the backslash
+ * itself, and the character after it is left to the caller.
+ *
+ * @param s The text after the backslash.
+ * @param out Receives the decoded byte.
+ * @param in_b Whether the text is a `%b` argument rather than the format.
+ * @return The number of characters used after the backslash, or -1 for
+ *         the `\c` of a `%b` argument, which ends the output.
+ */
+int	printf_escape(const char *s, char *out, int in_b)
+{
+	static const char	names[] = "\\abfnrtv\"'";
+	static const char	codes[] = "\\\a\b\f\n\r\t\v\"'";
+	int					i;
+
+	if (in_b && *s == 'c')
+		return (-1);
+	i = 0;
+	while (*s != '\0' && names[i] != '\0' && names[i] != *s)
+		i++;
+	if (*s != '\0' && names[i] != '\0')
+	{
+		*out = codes[i];
+		return (1);
+	}
+	if (*s == 'x' && decode_number(s + 1, 16, 2, out) > 0)
+		return (1 + decode_number(s + 1, 16, 2, out));
+	if (in_b && *s == '0')
+		return (1 + decode_number(s + 1, 8, 3, out));
+	if (!in_b && *s >= '0' && *s <= '7')
+		return (decode_number(s, 8, 3, out));
+	*out = '\\';
+	return (0);
+}
+
+/**
+ * @brief Makes room for `extra` more bytes (and a NUL) in the output.
+ *
+ * @param run The state of the current `printf`.
+ * @param extra The number of bytes about to be added.
+ */
+void	printf_reserve(t_printf_run *run, size_t extra)
+{
+	char	*grown;
+
+	if (run->len + extra < run->cap)
+		return ;
+	if (run->cap == 0)
+		run->cap = 256;
+	while (run->len + extra >= run->cap)
+		run->cap *= 2;
+	grown = malloc(run->cap);
+	if (grown == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (run->data != NULL)
+		ft_memcpy(grown, run->data, run->len);
+	free(run->data);
+	run->data = grown;
+}
+
+/**
+ * @brief Decodes the escapes of a `%b` argument.
+ *
+ * A `\c` cuts the argument short and ends the output of `printf`.
+ *
+ * @param arg The argument.
+ * @param run The state of the current `printf`.
+ * @return The decoded argument; the program exits if memory runs out.
+ */
+char	*printf_decode_b(const char *arg, t_printf_run *run)
+{
+	char	*out;
+	size_t	len;
+	int		used;
+
+	out = malloc(ft_strlen(arg) + 1);
+	if (out == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	len = 0;
+	while (*arg != '\0' && !run->stop)
+	{
+		if (*arg != '\\')
+		{
+			out[len++] = *arg++;
+			continue ;
+		}
+		used = printf_escape(arg + 1, out + len, 1);
+		run->stop = (used < 0);
+		len += (used >= 0);
+		arg += used + 1;
+	}
+	out[len] = '\0';
+	return (out);
+}
+
+/**
+ * @brief Converts the argument of a numeric conversion.
+ *
+ * Accepts decimal, octal and hexadecimal integers, and `'c` or `"c` for
+ * the code of the character c. A missing or empty argument is 0.
+ *
+ * @param arg The argument.
+ * @param run The state of the current `printf`; an invalid number sets
+ *            its exit status to 1.
+ * @return The value, as much of it as could be read.
+ */
+long long	printf_number(const char *arg, t_printf_run *run)
+{
+	char		*end;
+	long long	value;
+
+	if (*arg == '\0')
+		return (0);
+	if (*arg == '\'' || *arg == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	value = strtoll(arg, &end, 0);
+	if (end == arg || *end != '\0')
+	{
+		ft_error_with_arg("printf", (char *)arg, "invalid number");
+		run->status = 1;
+	}
+	else if (errno == ERANGE)
+	{
+		ft_error_with_arg("printf", (char *)arg, strerror(ERANGE));
+		run->status = 1;
+	}
+	return (value);
+}
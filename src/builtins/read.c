@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/13 10:42:18 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Parses the timeout of `read -t`: seconds, with an optional
+ * fraction.
+ *
+ * @param str The option argument.
+ * @param ms Receives the timeout in milliseconds.
+ * @return 1 on success, 0 if `str` is not a valid timeout.
+ */
+static int	parse_timeout(const char *str, long long *ms)
+{
+	long long	seconds;
+	long long	scale;
+
+	if (*str == '\0' || (!ft_isdigit(*str) && *str != '.'))
+		return (0);
+	seconds = 0;
+	while (ft_isdigit(*str))
+	{
+		if (seconds < 100000000)
+			seconds = seconds * 10 + (*str - '0');
+		str++;
+	}
+	*ms = seconds * 1000;
+	if (*str == '.')
+		str++;
+	scale = 100;
+	while (ft_isdigit(*str))
+	{
+		*ms += (*str - '0') * scale;
+		scale /= 10;
+		str++;
+	}
+	return (*str == '\0');
+}
+
+/**
+ * @brief Applies an option of `read` that takes an argument.
+ *
+ * @param opt The option letter: 'd', 'n' or 't'.
+ * @param arg The option argument, or NULL if it is missing.
+ * @param st The state of the current `read`.
+ * @return 0 on success, or the exit status of `read` on a bad argument.
+ */
+static int	apply_read_option(char opt, char *arg, t_read_state *st)
+{
+	if (arg == NULL)
+		return (read_usage_error(opt, "option requires an argument"));
+	if (opt == 'd')
+		st->delim = arg[0];
+	else if (opt == 'n')
+	{
+		if (!ft_str_to_llong(arg, &st->nchars) || st->nchars < 0)
+			return (ft_error_with_arg("read", arg, "invalid number"), 1);
+	}
+	else if (!parse_timeout(arg, &st->deadline))
+	{
+		ft_error_with_arg("read", arg, "invalid timeout specification");
+		return (1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Parses one option word such as `-r`, `-rn3` or `-d :`.
+ *
+ * @param args The arguments of `read`.
+ * @param i The index of the option word; moved past a separate argument.
+ * @param st The state of the current `read`.
+ * @return 0 on success, or the exit status of `read` on a bad option.
+ */
+static int	parse_option_word(char **args, int *i, t_read_state *st)
+{
+	char	*word;
+	char	*value;
+
+	word = args[*i] + 1;
+	while (*word == 'r')
+	{
+		st->raw = 1;
+		word++;
+	}
+	if (*word == '\0')
+		return (0);
+	if (ft_strchr("dnt", *word) == NULL)
+		return (read_usage_error(*word, "invalid option"));
+	value = word + 1;
+	if (*value == '\0')
+	{
+		(*i)++;
+		value = args[*i];
+	}
+	return (apply_read_option(*word, value, st));
+}
+
+/**
+ * @brief Parses the options and variable names of `read`.
+ *
+ * @param args The arguments of `read`.
+ * @param st Receives the options.
+ * @param status Receives the exit status of `read` on failure.
+ * @return The index of the first variable name, or -1 on failure.
+ */
+static int	parse_read_args(char **args, t_read_state *st, int *status)
+{
+	int	i;
+
+	ft_bzero(st, sizeof(t_read_state));
+	st->delim = '\n';
+	st->nchars = -1;
+	st->deadline = -1;
+	i = 1;
+	while (args[i] != NULL && args[i][0] == '-' && args[i][1] != '\0')
+	{
+		if (ft_strncmp(args[i], "--", 3) == 0)
+		{
+			i++;
+			break ;
+		}
+		*status = parse_option_word(args, &i, st);
+		if (*status != 0)
+			return (-1);
+		i++;
+	}
+	*status = 1;
+	if (!check_read_names(args + i))
+		return (-1);
+	return (i);
+}
+
+/**
+ * @brief Executes the `read [-r] [-d delim] [-n nchars] [-t timeout]
+ * [name ...]` builtin.
+ *
+ * Standard input is read through a per-shell read-ahead buffer; see
+ * read_next_char(). `-t 0` only reports whether input is waiting.
+ *
+ * @param args The command, its options and the variable names.
+ * @param process_data The process data.
+ * @return 0 if a whole line was read, 1 at end of file or on error, 2 on
+ *         a usage error, 128 + SIGALRM on timeout, or 128 + SIGINT if
+ *         Ctrl-C stopped it (nothing is assigned then).
+ */
+int	run_read(char **args, t_process_data *process_data)
+{
+	t_read_state	st;
+	int				first;
+	int				status;
+
+	first = parse_read_args(args, &st, &status);
+	if (first < 0)
+		return (status);
+	if (st.deadline == 0)
+		return (!read_input_ready(process_data, STDIN_FILENO));
+	if (st.deadline > 0)
+		st.deadline += read_clock_ms();
+	st.script = read_from_script(process_data, STDIN_FILENO);
+	status = read_input(process_data, &st);
+	if (status == -1 && errno == EINTR)
+		status = 128 + SIGINT;
+	else if (status == -1)
+		ft_error_with_arg("read", "read error", strerror(errno));
+	if (status != 128 + SIGINT)
+		assign_read_fields(st.line, args + first, process_data);
+	free(st.line);
+	if (status == READ_TIMEOUT)
+		return (128 + SIGALRM);
+	if (status == 128 + SIGINT)
+		return (status);
+	return (status != 1);
+}
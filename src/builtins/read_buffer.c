@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_buffer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/13 10:42:18 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <poll.h>
+
+/**
+ * @brief Waits until `fd` has input or the deadline of `read -t` passes.
+ *
+ * @param fd The descriptor to wait on.
+ * @param deadline The deadline in milliseconds (see read_clock_ms()), or
+ *                 -1 to wait for as long as it takes.
+ * @return 1 once input (or end of file) can be read, or Ctrl-C was
+ *         pressed, 0 on timeout.
+ */
+int	wait_for_input(int fd, long long deadline)
+{
+	struct pollfd	pfd;
+	long long		left;
+	int				ret;
+
+	if (deadline < 0)
+		return (1);
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	ret = -1;
+	while (ret == -1)
+	{
+		left = deadline - read_clock_ms();
+		if (left < 0)
+			left = 0;
+		ret = poll(&pfd, 1, (int)left);
+		if (ret == -1 && (errno != EINTR || g_signal_received == SIGINT))
+			return (1);
+	}
+	return (ret > 0);
+}
+
+/**
+ * @brief Refills the read-ahead buffer from `fd`.
+ *
+ * A seekable descriptor is read a block at a time, since whatever `read`
+ * does not use can be handed back with lseek() before anyone else looks
+ * at the descriptor; see sync_read_buffer(). Anything else (a pipe or a
+ * terminal) is read one byte at a time, so no input meant for a later
+ * command is ever swallowed. The read itself is copy_read()'s, which
+ * Ctrl-C stops even at a terminal.
+ *
+ * @param buf The buffer, empty on entry.
+ * @param fd The descriptor to read from.
+ * @param deadline The deadline of `read -t`, or -1.
+ * @return The number of bytes read, 0 at end of file, -1 on error (EINTR
+ *         after Ctrl-C) or READ_TIMEOUT.
+ */
+static ssize_t	fill_read_buffer(t_read_buffer *buf, int fd, long long deadline)
+{
+	size_t	want;
+	ssize_t	n;
+
+	buf->fd = fd;
+	buf->start = 0;
+	buf->end = 0;
+	if (!wait_for_input(fd, deadline))
+		return (READ_TIMEOUT);
+	want = 1;
+	if (lseek(fd, 0, SEEK_CUR) != -1)
+		want = READ_BUF_SIZE;
+	n = copy_read(fd, buf->data, want);
+	if (n > 0)
+		buf->end = (size_t)n;
+	return (n);
+}
+
+/**
+ * @brief Takes the next input byte for the `read` builtin.
+ *
+ * When standard input is the script itself, the bytes the script reader
+ * read past the current command come first; they are not in the file
+ * any more.
+ *
+ * @param pd The process data owning the read-ahead buffer.
+ * @param fd The descriptor being read.
+ * @param st The state of the current `read`, for its deadline.
+ * @param c Receives the byte.
+ * @return 1 on success, 0 at end of file, -1 on error or READ_TIMEOUT.
+ */
+int	read_next_char(t_process_data *pd, int fd, t_read_state *st, char *c)
+{
+	t_read_buffer	*buf;
+	ssize_t			n;
+
+	if (pd->read_buf == NULL)
+	{
+		pd->read_buf = malloc(sizeof(t_read_buffer));
+		if (pd->read_buf == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		ft_bzero(pd->read_buf, sizeof(t_read_buffer));
+	}
+	buf = pd->read_buf;
+	if (buf->fd != fd)
+		sync_read_buffer(pd);
+	if (buf->start == buf->end && st->script && get_next_line_getc(c))
+		return (1);
+	if (buf->start == buf->end)
+	{
+		n = fill_read_buffer(buf, fd, st->deadline);
+		if (n <= 0)
+			return ((int)n);
+	}
+	*c = buf->data[buf->start++];
+	return (1);
+}
+
+/**
+ * @brief Hands the unread part of the read-ahead buffer back to its file.
+ *
+ * Seeks the descriptor back to the byte after the last one `read` used,
+ * so the next command (or the process the shell forks or execs) starts
+ * reading exactly where `read` stopped. Must be called before the
+ * buffered descriptor is shared with or replaced for anyone else.
+ *
+ * @param pd The process data owning the buffer.
+ */
+void	sync_read_buffer(t_process_data *pd)
+{
+	t_read_buffer	*buf;
+
+	buf = pd->read_buf;
+	if (buf == NULL || buf->start == buf->end)
+		return ;
+	lseek(buf->fd, -(off_t)(buf->end - buf->start), SEEK_CUR);
+	buf->start = 0;
+	buf->end = 0;
+}
+
+/**
+ * @brief Syncs and frees the read-ahead buffer.
+ *
+ * @param pd The process data owning the buffer.
+ */
+void	free_read_buffer(t_process_data *pd)
+{
+	sync_read_buffer(pd);
+	free(pd->read_buf);
+	pd->read_buf = NULL;
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_helper_1.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/13 10:42:18 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <time.h>
+
+/**
+ * @brief Returns a monotonic clock reading, for the deadline of `read -t`.
+ *
+ * @return The time in milliseconds since an arbitrary starting point.
+ */
+long long	read_clock_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief Appends a byte to the line being read, growing it as needed.
+ *
+ * @param st The state of the current `read`.
+ * @param c The byte to append.
+ */
+static void	push_char(t_read_state *st, char c)
+{
+	char	*grown;
+
+	if (st->len + 1 >= st->cap)
+	{
+		if (st->cap == 0)
+			st->cap = 64;
+		else
+			st->cap *= 2;
+		grown = malloc(st->cap);
+		if (grown == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		if (st->line != NULL)
+			ft_memcpy(grown, st->line, st->len);
+		free(st->line);
+		st->line = grown;
+	}
+	st->line[st->len++] = c;
+	st->line[st->len] = '\0';
+}
+
+/**
+ * @brief Reads one line (up to the delimiter) from standard input.
+ *
+ * Without `-r` a backslash quotes the next character, and a backslash
+ * before a newline continues the line. With `-n` at most that many
+ * characters are read. The delimiter itself is not stored.
+ *
+ * @param pd The process data owning the read-ahead buffer.
+ * @param st The state of the current `read`; st->line receives the line.
+ * @return 1 if the delimiter or the `-n` count ended the line, 0 at end of
+ *         file, -1 on error or READ_TIMEOUT.
+ */
+int	read_input(t_process_data *pd, t_read_state *st)
+{
+	char		c;
+	int			ret;
+	long long	count;
+
+	count = 0;
+	while (st->nchars < 0 || count < st->nchars)
+	{
+		ret = read_next_char(pd, STDIN_FILENO, st, &c);
+		if (ret == 1 && c == st->delim)
+			return (1);
+		if (ret == 1 && c == '\\' && !st->raw)
+		{
+			ret = read_next_char(pd, STDIN_FILENO, st, &c);
+			if (ret == 1 && c == '\n')
+				continue ;
+		}
+		if (ret != 1)
+			return (ret);
+		push_char(st, c);
+		count++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Tells whether `read -t 0` would find input waiting.
+ *
+ * @param pd The process data owning the read-ahead buffer.
+ * @param fd The descriptor to check.
+ * @return 1 if input is buffered or can be read without blocking.
+ */
+int	read_input_ready(t_process_data *pd, int fd)
+{
+	if (pd->read_buf != NULL && pd->read_buf->fd == fd
+		&& pd->read_buf->start < pd->read_buf->end)
+		return (1);
+	return (wait_for_input(fd, read_clock_ms()));
+}
+
+/**
+ * @brief Tells whether `fd` is the script the shell reads its commands
+ * from, so `read` takes what the script reader has already read ahead
+ * (see get_next_line_getc()) before reading the file itself.
+ *
+ * @param pd The process data, with the script's file.
+ * @param fd The descriptor `read` is about to read.
+ * @return 1 if it is the script, 0 otherwise.
+ */
+int	read_from_script(t_process_data *pd, int fd)
+{
+	struct stat	st;
+
+	if (pd->script_st.st_ino == 0 || fstat(fd, &st) == -1)
+		return (0);
+	return (st.st_dev == pd->script_st.st_dev
+		&& st.st_ino == pd->script_st.st_ino);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_helper_2.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/13 10:42:18 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/13 10:42:18 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Field separators of `read`, the same set ft_split_whitespace()
+ * splits on.
+ */
+static int	is_field_space(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\n'
+		|| c == '\v' || c == '\f' || c == '\r');
+}
+
+/**
+ * @brief Cuts the next field off the line being split.
+ *
+ * Leading separators are skipped. The last field takes the rest of the
+ * line, minus trailing separators.
+ *
+ * @param cursor The position in the line; moved past the field.
+ * @param last Whether this field is for the last variable name.
+ * @return The field, or NULL on allocation failure.
+ */
+static char	*take_field(char **cursor, int last)
+{
+	char	*start;
+	char	*end;
+
+	while (**cursor != '\0' && is_field_space(**cursor))
+		(*cursor)++;
+	start = *cursor;
+	end = start;
+	if (last)
+	{
+		end = start + ft_strlen(start);
+		while (end > start && is_field_space(end[-1]))
+			end--;
+	}
+	else
+	{
+		while (*end != '\0' && !is_field_space(*end))
+			end++;
+	}
+	*cursor = end;
+	return (ft_strndup(start, end - start));
+}
+
+/**
+ * @brief Assigns the line read to the variables named on the command line.
+ *
+ * Each name but the last gets one whitespace-separated field and the last
+ * one gets the rest of the line. Names left over are set to the empty
+ * string. Without names the whole line goes to REPLY, untrimmed.
+ *
+ * @param line The line read (NULL if nothing was read).
+ * @param names The variable names, NULL-terminated.
+ * @param pd The process data holding the variables.
+ */
+void	assign_read_fields(char *line, char **names, t_process_data *pd)
+{
+	char	*cursor;
+	char	*value;
+
+	if (line == NULL)
+		line = "";
+	if (names[0] == NULL)
+	{
+		set_shell_var("REPLY", line, pd);
+		return ;
+	}
+	cursor = line;
+	while (*names != NULL)
+	{
+		value = take_field(&cursor, names[1] == NULL);
+		if (value == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		set_shell_var(*names, value, pd);
+		free(value);
+		names++;
+	}
+}
+
+/**
+ * @brief Checks that every variable name given to `read` is valid.
+ *
+ * @param names The variable names, NULL-terminated.
+ * @return 1 if all are valid, 0 after reporting the first invalid one.
+ */
+int	check_read_names(char **names)
+{
+	while (*names != NULL)
+	{
+		if (!is_valid_identifier(*names))
+		{
+			error_with_backticked_arg("read", *names,
+				"not a valid identifier");
+			return (0);
+		}
+		names++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Reports a bad option of `read` along with the usage line.
+ *
+ * @param opt The option letter.
+ * @param message What is wrong with it.
+ * @return 2, the exit status of `read` on a usage error.
+ */
+int	read_usage_error(char opt, char *message)
+{
+	char	name[3];
+
+	name[0] = '-';
+	name[1] = opt;
+	name[2] = '\0';
+	ft_error_with_arg("read", name, message);
+	ft_putstr_fd("read: usage: read [-r] [-d delim] [-n nchars] "
+		"[-t timeout] [name ...]\n", STDERR_FILENO);
+	return (2);
+}
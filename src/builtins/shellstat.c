@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shellstat.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Adds the counts in `add` to `sum`.
+ */
+static void	add_counts(t_instr_counts *sum, const t_instr_counts *add)
+{
+	int	i;
+
+	sum->allocs += add->allocs;
+	sum->frees += add->frees;
+	sum->bytes += add->bytes;
+	i = 0;
+	while (i < INSTR_CALLS)
+	{
+		sum->calls[i] += add->calls[i];
+		i++;
+	}
+}
+
+/**
+ * @brief Prints one row of the `shellstat` table.
+ *
+ * @param name The phase (or "total", "last line") the row is for.
+ * @param counts The counts, or NULL to print the column titles.
+ */
+static void	print_counts_row(const char *name, const t_instr_counts *counts)
+{
+	static const char	*calls[] = {"access", "stat", "open", "close", "dup",
+		"dup2", "pipe", "fork", "read", "write"};
+	char				line[INSTR_LINE_MAX];
+	int					len;
+	int					i;
+
+	if (counts == NULL)
+		len = snprintf(line, sizeof(line), "%-10s %9s %9s %11s", name,
+				"allocs", "frees", "bytes");
+	else
+		len = snprintf(line, sizeof(line), "%-10s %9lld %9lld %11lld", name,
+				counts->allocs, counts->frees, counts->bytes);
+	i = 0;
+	while (i < INSTR_CALLS)
+	{
+		if (counts == NULL)
+			len += snprintf(line + len, sizeof(line) - len, " %6s", calls[i]);
+		else
+			len += snprintf(line + len, sizeof(line) - len, " %6lld",
+					counts->calls[i]);
+		i++;
+	}
+	ft_putendl_fd(line, STDOUT_FILENO);
+}
+
+/**
+ * @brief Prints the counters: one row per phase, their total, and the
+ * last command line run before this one.
+ *
+ * @param state The counters.
+ */
+static void	print_shellstat(t_instr *state)
+{
+	t_instr_counts	total;
+	int				i;
+
+	ft_bzero(&total, sizeof(t_instr_counts));
+	print_counts_row("phase", NULL);
+	i = 0;
+	while (i < INSTR_PHASES)
+	{
+		print_counts_row(trace_phase_name(i), &state->phases[i]);
+		add_counts(&total, &state->phases[i]);
+		i++;
+	}
+	print_counts_row("total", &total);
+	print_counts_row("last line", &state->last_line);
+}
+
+/**
+ * @brief Executes the `shellstat [-r]` builtin.
+ *
+ * Prints the allocations, bytes allocated and wrapped syscalls the shell
+ * itself has made, per phase and for the last command line. `-r` zeroes
+ * the counters. The counts only exist in a build made with
+ * `make instrument`.
+ *
+ * @param args The command and its option.
+ * @param process_data The process data (unused).
+ * @return 0 on success, 1 in a build without counters, 2 on a usage
+ *         error.
+ */
+int	run_shellstat(char **args, t_process_data *process_data)
+{
+	t_instr	*state;
+
+	(void)process_data;
+	if (args[1] != NULL && (args[2] != NULL || ft_strncmp(args[1], "-r", 3)))
+	{
+		ft_error_with_arg("shellstat", args[1], "invalid option");
+		ft_putstr_fd("shellstat: usage: shellstat [-r]\n", STDERR_FILENO);
+		return (2);
+	}
+	if (!INSTRUMENT)
+	{
+		ft_error("shellstat", "not an instrumented build (make instrument)");
+		return (1);
+	}
+	state = instr_state();
+	if (args[1] == NULL)
+		print_shellstat(state);
+	else
+	{
+		ft_bzero(state->phases, sizeof(state->phases));
+		ft_bzero(&state->line, sizeof(t_instr_counts));
+		ft_bzero(&state->last_line, sizeof(t_instr_counts));
+	}
+	return (0);
+}
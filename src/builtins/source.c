@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   source.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/12 10:22:54 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 14:36:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds the file named by `source`.
+ *
+ * A name without a slash is looked up in PATH first and then taken as
+ * relative to the current directory, as bash does.
+ *
+ * @param name The file name given to `source`.
+ * @param pd The process data, used for PATH.
+ * @return The path to load, or NULL on allocation failure.
+ */
+static char	*resolve_source_path(char *name, t_process_data *pd)
+{
+	char	**path_dirs;
+	char	*path;
+
+	if (ft_strchr(name, '/') != NULL)
+		return (ft_strdup(name));
+	path_dirs = find_path_dirs(pd->env_list);
+	path = find_full_cmd_path(name, path_dirs);
+	free_split(path_dirs);
+	if (path == NULL)
+		path = ft_strdup(name);
+	return (path);
+}
+
+/**
+ * @brief Finds the parsed form of the file named by `source`.
+ *
+ * A name without a slash that was already found in PATH is not looked
+ * up again while PATH is unchanged: the file it led to costs a single
+ * stat(), like any cached script (see find_source_name()).
+ *
+ * @param name The file name given to `source`.
+ * @param pd The process data.
+ * @param status Receives 0 on success, 1 if the file cannot be read, or
+ *               2 on a syntax error.
+ * @return The cache entry of the file, or NULL on error.
+ */
+static t_source_cache	*find_source(char *name, t_process_data *pd,
+							int *status)
+{
+	t_source_cache	*entry;
+	char			*path;
+
+	*status = 0;
+	if (ft_strchr(name, '/') == NULL)
+	{
+		entry = find_source_name(name, pd);
+		if (entry != NULL)
+			return (entry);
+	}
+	path = resolve_source_path(name, pd);
+	if (path == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	entry = load_source(path, pd, status);
+	free(path);
+	if (entry != NULL)
+		remember_source_name(entry, name, pd);
+	return (entry);
+}
+
+/**
+ * @brief Runs a sourced script in the current shell.
+ *
+ * With extra arguments the script gets them as positional parameters, as
+ * in a function call; otherwise it sees those of the caller. Either way
+ * `return` ends the script and loops around `source` are out of reach.
+ *
+ * @param ast The parsed script (NULL for an empty one).
+ * @param args `source`, the file name and the optional arguments.
+ * @param pd The process data.
+ * @return The exit status of the last command of the script.
+ */
+static int	run_sourced(t_ast_node *ast, char **args, t_process_data *pd)
+{
+	int	saved_depth;
+	int	saved_keep;
+	int	status;
+
+	saved_keep = pd->keep_script;
+	pd->source_depth++;
+	if (args[2] != NULL)
+		status = call_function(ast, args + 1, pd);
+	else
+	{
+		saved_depth = pd->loop_depth;
+		pd->loop_depth = 0;
+		status = execute_ast(ast, pd);
+		if (pd->loop_ctl == LOOP_RETURN)
+			pd->loop_ctl = LOOP_NONE;
+		pd->loop_depth = saved_depth;
+	}
+	pd->source_depth--;
+	pd->keep_script = saved_keep;
+	return (status);
+}
+
+/**
+ * @brief Executes the `source file [args...]` (or `. file`) builtin.
+ *
+ * The file is parsed once per session and then cached; see load_source().
+ *
+ * @param args The command, the file name and the optional arguments.
+ * @param process_data The process data.
+ * @return The status of the script, 1 if it cannot be read, or 2 on a
+ *         syntax error or a missing file name.
+ */
+int	run_source(char **args, t_process_data *process_data)
+{
+	t_source_cache	*entry;
+	int				status;
+
+	if (args[1] == NULL)
+	{
+		ft_error(args[0], "filename argument required");
+		return (2);
+	}
+	if (process_data->source_depth >= FUNC_MAX_DEPTH)
+	{
+		ft_error(args[0], "maximum source nesting level exceeded");
+		return (1);
+	}
+	entry = find_source(args[1], process_data, &status);
+	if (entry == NULL)
+		return (status);
+	return (run_sourced(entry->ast, args, process_data));
+}
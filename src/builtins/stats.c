@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Sorts entries by total time, largest first (insertion sort; the
+ * table holds one entry per distinct command name).
+ *
+ * @param list The entries.
+ * @param n The number of entries.
+ */
+static void	sort_entries(t_cmd_stats **list, int n)
+{
+	t_cmd_stats	*key;
+	int			i;
+	int			j;
+
+	i = 1;
+	while (i < n)
+	{
+		key = list[i];
+		j = i - 1;
+		while (j >= 0 && list[j]->total_us < key->total_us)
+		{
+			list[j + 1] = list[j];
+			j--;
+		}
+		list[j + 1] = key;
+		i++;
+	}
+}
+
+/**
+ * @brief Lists the entries of the statistics table, the commands that took
+ * the most time in total first.
+ *
+ * @param stats The statistics table.
+ * @return The entries, NULL-terminated, or NULL on allocation failure.
+ */
+static t_cmd_stats	**sorted_entries(t_stats *stats)
+{
+	t_cmd_stats	**list;
+	t_cmd_stats	*entry;
+	int			n;
+	int			i;
+
+	list = ft_calloc(stats->count + 1, sizeof(t_cmd_stats *));
+	if (list == NULL)
+		return (NULL);
+	n = 0;
+	i = 0;
+	while (i < STATS_BUCKETS)
+	{
+		entry = stats->table[i];
+		while (entry != NULL)
+		{
+			list[n++] = entry;
+			entry = entry->next;
+		}
+		i++;
+	}
+	sort_entries(list, n);
+	return (list);
+}
+
+/**
+ * @brief Prints the statistics table, one row per command.
+ *
+ * @param stats The statistics table.
+ * @return 0 on success, 1 on allocation failure.
+ */
+static int	print_stats_table(t_stats *stats)
+{
+	t_cmd_stats	**list;
+	char		line[STATS_LINE_MAX];
+	int			i;
+
+	list = sorted_entries(stats);
+	if (list == NULL)
+		return (ft_error("stats", strerror(errno)), 1);
+	ft_putstr_fd("command                    calls  forks  fails   total_ms"
+		"    mean_us     p50_us     p99_us     max_us\n", STDOUT_FILENO);
+	i = 0;
+	while (list[i] != NULL)
+	{
+		snprintf(line, sizeof(line), "%-24s %7lu %6lu %6lu %10.3f %10llu "
+			"%10llu %10llu %10llu\n", list[i]->name, list[i]->calls,
+			list[i]->forks, list[i]->failures, list[i]->total_us / 1000.0,
+			list[i]->total_us / list[i]->calls, stats_percentile(list[i], 500),
+			stats_percentile(list[i], 990), list[i]->max_us);
+		ft_putstr_fd(line, STDOUT_FILENO);
+		i++;
+	}
+	free(list);
+	return (0);
+}
+
+/**
+ * @brief Executes the `stats [-r | -p]` builtin.
+ *
+ * Without options, prints the calls, forks, failures and latency
+ * percentiles of every command run so far. `-r` empties the table and
+ * `-p` prints it in Prometheus text format, as MINISHELL_STATS does on
+ * exit.
+ *
+ * @param args The command and its option.
+ * @param process_data The process data holding the statistics.
+ * @return 0 on success, 2 on a usage error.
+ */
+int	run_stats(char **args, t_process_data *process_data)
+{
+	t_stats	*stats;
+
+	stats = process_data->stats;
+	if (args[1] != NULL && (args[2] != NULL || (ft_strncmp(args[1], "-r", 3)
+				&& ft_strncmp(args[1], "-p", 3))))
+	{
+		ft_error_with_arg("stats", args[1], "invalid option");
+		ft_putstr_fd("stats: usage: stats [-r | -p]\n", STDERR_FILENO);
+		return (2);
+	}
+	if (stats == NULL)
+		return (0);
+	if (args[1] == NULL)
+		return (print_stats_table(stats));
+	if (args[1][1] == 'r')
+		stats_reset(stats);
+	else
+		write_stats_prometheus(stats, STDOUT_FILENO);
+	return (0);
+}
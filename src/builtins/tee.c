@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tp.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 17:46:31 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether an argument of `tee` is an option rather than a
+ * file.
+ */
+static int	is_tee_option(const char *arg)
+{
+	return (arg[0] == '-' && arg[1] != '\0');
+}
+
+/**
+ * @brief Tells whether the builtin `tee` handles these arguments.
+ *
+ * Only `-a` is supported; with any other option the external tee is run
+ * instead.
+ *
+ * @param args The command and its arguments.
+ * @return 1 if the builtin can run them, 0 otherwise.
+ */
+int	tee_accepts(char **args)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] != NULL && ft_strncmp(args[i], "--", 3) != 0)
+	{
+		if (is_tee_option(args[i]) && ft_strncmp(args[i], "-a", 3) != 0)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Sorts the arguments of `tee` into the `-a` flag and the files.
+ *
+ * @param args The command and its arguments.
+ * @param tp Receives the files, with room for their descriptors.
+ * @return 1 on success, 0 on allocation failure.
+ */
+static int	collect_tee_files(char **args, t_tee *tp)
+{
+	int	dashdash;
+	int	n;
+	int	i;
+
+	n = 0;
+	while (args[n] != NULL)
+		n++;
+	tp->names = malloc(sizeof(char *) * n);
+	tp->fds = malloc(sizeof(int) * n);
+	if (tp->names == NULL || tp->fds == NULL)
+		return (0);
+	dashdash = 0;
+	i = 0;
+	while (args[++i] != NULL)
+	{
+		if (!dashdash && ft_strncmp(args[i], "--", 3) == 0)
+			dashdash = 1;
+		else if (!dashdash && is_tee_option(args[i]))
+			tp->append = 1;
+		else
+			tp->names[tp->count++] = args[i];
+	}
+	return (1);
+}
+
+/**
+ * @brief Opens the files of `tee`, truncating them unless `-a` was given.
+ *
+ * A file that cannot be opened is reported and skipped.
+ *
+ * @param tp The files; their descriptors are filled in (-1 on failure).
+ */
+static void	open_tee_files(t_tee *tp)
+{
+	int	flags;
+	int	i;
+
+	flags = O_WRONLY | O_CREAT | O_CLOEXEC | O_TRUNC;
+	if (tp->append)
+		flags = O_WRONLY | O_CREAT | O_CLOEXEC | O_APPEND;
+	i = 0;
+	while (i < tp->count)
+	{
+		tp->fds[i] = open(tp->names[i], flags, 0644);
+		if (tp->fds[i] == -1)
+		{
+			ft_error_with_arg("tee", tp->names[i], strerror(errno));
+			tp->status = 1;
+		}
+		else
+			tp->opened++;
+		i++;
+	}
+}
+
+/**
+ * @brief Executes the `tee [-a] [file ...]` builtin: copies standard
+ * input to standard output and to every file.
+ *
+ * See tee_stream() for how the data is moved.
+ *
+ * @param args The command, its options and the files.
+ * @param process_data The process data.
+ * @return 0 on success, 1 if a file failed, or 128 + the signal number.
+ */
+int	run_tee(char **args, t_process_data *process_data)
+{
+	t_tee	tp;
+	int		i;
+
+	sync_read_buffer(process_data);
+	ft_bzero(&tp, sizeof(t_tee));
+	if (collect_tee_files(args, &tp))
+	{
+		open_tee_files(&tp);
+		tee_stream(&tp);
+	}
+	else
+		tp.status = copy_error("tee", NULL);
+	i = 0;
+	while (i < tp.count)
+	{
+		if (tp.fds[i] != -1)
+			close(tp.fds[i]);
+		i++;
+	}
+	free(tp.names);
+	free(tp.fds);
+	return (tp.status);
+}
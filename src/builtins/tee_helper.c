@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tee_helper.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Moves `len` bytes from the standard input pipe into a file with
+ * splice(), consuming what tee(2) already duplicated to standard output.
+ *
+ * @return 0 on success, -1 on error with errno set.
+ */
+static int	drain_to_file(int fd, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = splice(STDIN_FILENO, NULL, fd, NULL, len, SPLICE_F_MOVE);
+		if (n == -1 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n <= 0)
+			return (-1);
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies standard input to standard output and one file without
+ * copying a byte in user space: tee(2) duplicates each chunk into the
+ * output pipe, then splice() moves it into the file.
+ *
+ * @param tp The `tee` state; the file is reported on failure.
+ * @param i The index of the file.
+ * @return 0 on success, -1 on a failure of standard input or output.
+ */
+static int	tee_by_splice(t_tee *tp, int i)
+{
+	ssize_t	n;
+
+	n = tee(STDIN_FILENO, STDOUT_FILENO, COPY_CHUNK, 0);
+	while ((n > 0 || (n == -1 && errno == EINTR))
+		&& g_signal_received != SIGINT)
+	{
+		if (n > 0 && drain_to_file(tp->fds[i], n) == -1)
+		{
+			ft_error_with_arg("tee", tp->names[i], strerror(errno));
+			tp->status = 1;
+			return (0);
+		}
+		n = tee(STDIN_FILENO, STDOUT_FILENO, COPY_CHUNK, 0);
+	}
+	if (n == 0)
+		return (0);
+	if (g_signal_received == SIGINT)
+		errno = EINTR;
+	return (-1);
+}
+
+/**
+ * @brief Writes a chunk to standard output and every file still open.
+ *
+ * A file that fails is reported and dropped; the others go on.
+ *
+ * @return 0 on success, -1 if standard output failed.
+ */
+static int	write_outputs(t_tee *tp, const char *buf, size_t len)
+{
+	int	i;
+
+	if (write_all(STDOUT_FILENO, buf, len) == -1)
+		return (-1);
+	i = 0;
+	while (i < tp->count)
+	{
+		if (tp->fds[i] != -1 && write_all(tp->fds[i], buf, len) == -1)
+		{
+			ft_error_with_arg("tee", tp->names[i], strerror(errno));
+			close(tp->fds[i]);
+			tp->fds[i] = -1;
+			tp->status = 1;
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies standard input to every output through one
+ * COPY_BUF_SIZE buffer.
+ *
+ * @return 0 on success, -1 on a failure of standard input or output.
+ */
+static int	tee_by_rw(t_tee *tp)
+{
+	char	*buf;
+	ssize_t	n;
+	int		ret;
+
+	buf = malloc(COPY_BUF_SIZE);
+	if (buf == NULL)
+		return (-1);
+	ret = 0;
+	n = copy_read(STDIN_FILENO, buf, COPY_BUF_SIZE);
+	while (n > 0 && ret == 0)
+	{
+		ret = write_outputs(tp, buf, n);
+		if (ret == 0)
+			n = copy_read(STDIN_FILENO, buf, COPY_BUF_SIZE);
+	}
+	free(buf);
+	if (n < 0)
+		return (-1);
+	return (ret);
+}
+
+/**
+ * @brief Copies standard input to standard output and the files of `tee`.
+ *
+ * Without files this is copy_fd(). Between two pipes with a single file
+ * that is not opened for appending (which splice() refuses), the data is
+ * teed and spliced; otherwise it goes through a buffer.
+ *
+ * @param tp The `tee` state; its status is updated.
+ */
+void	tee_stream(t_tee *tp)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+	int			file;
+	int			ret;
+
+	file = 0;
+	while (file < tp->count && tp->fds[file] == -1)
+		file++;
+	if (tp->opened == 0)
+		ret = copy_fd(STDIN_FILENO, STDOUT_FILENO);
+	else if (tp->opened == 1 && !tp->append
+		&& fstat(STDIN_FILENO, &in_st) == 0 && S_ISFIFO(in_st.st_mode)
+		&& fstat(STDOUT_FILENO, &out_st) == 0 && S_ISFIFO(out_st.st_mode))
+		ret = tee_by_splice(tp, file);
+	else
+		ret = tee_by_rw(tp);
+	if (ret == -1)
+		tp->status = copy_error("tee", NULL);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether two strings are equal.
+ */
+int	test_str_eq(const char *a, const char *b)
+{
+	return (ft_strncmp(a, b, ft_strlen(b) + 1) == 0);
+}
+
+/**
+ * @brief Reports the first error found while evaluating `test`.
+ *
+ * @param tp The state of the current `test`; marked as failed.
+ * @param arg The argument at fault, or NULL.
+ * @param message What is wrong.
+ */
+void	test_error(t_test_parse *tp, const char *arg, const char *message)
+{
+	if (tp->error)
+		return ;
+	tp->error = 1;
+	if (arg != NULL)
+		ft_error_with_arg((char *)tp->name, (char *)arg, (char *)message);
+	else
+		ft_error((char *)tp->name, (char *)message);
+}
+
+/**
+ * @brief Reports the arguments left over once the expression has ended,
+ * worded as bash does for the short forms.
+ *
+ * @param tp The state of the current `test`.
+ */
+static void	report_extra_args(t_test_parse *tp)
+{
+	if (tp->argc == 2)
+		test_error(tp, tp->args[0], "unary operator expected");
+	else if (tp->argc == 3)
+		test_error(tp, tp->args[1], "binary operator expected");
+	else
+		test_error(tp, NULL, "too many arguments");
+}
+
+/**
+ * @brief Executes the `test expr` and `[ expr ]` builtins.
+ *
+ * Supports the POSIX unary file and string tests, `=`, `!=`, the integer
+ * comparisons, `-nt`, `-ot`, `-ef`, `!`, `-a`, `-o` and parentheses.
+ *
+ * @param args The command and the expression.
+ * @param process_data The process data (unused).
+ * @return 0 if the expression is true, 1 if it is false, 2 on an error.
+ */
+int	run_test(char **args, t_process_data *process_data)
+{
+	t_test_parse	tp;
+	int				result;
+
+	(void)process_data;
+	ft_bzero(&tp, sizeof(t_test_parse));
+	tp.name = args[0];
+	tp.args = args + 1;
+	while (tp.args[tp.argc] != NULL)
+		tp.argc++;
+	if (test_str_eq(args[0], "["))
+	{
+		if (tp.argc == 0 || !test_str_eq(tp.args[tp.argc - 1], "]"))
+			return (ft_error("[", "missing `]'"), 2);
+		tp.argc--;
+	}
+	if (tp.argc == 0)
+		return (1);
+	result = test_or(&tp);
+	if (tp.pos < tp.argc)
+		report_extra_args(&tp);
+	if (tp.error)
+		return (2);
+	return (!result);
+}
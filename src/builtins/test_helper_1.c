@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_helper_1.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Evaluates a parenthesised expression; tp->pos is at the `(`.
+ *
+ * @param tp The state of the current `test`.
+ * @return The value of the expression.
+ */
+static int	test_paren(t_test_parse *tp)
+{
+	int	result;
+
+	tp->pos++;
+	result = test_or(tp);
+	if (tp->pos >= tp->argc || !test_str_eq(tp->args[tp->pos], ")"))
+		test_error(tp, NULL, "`)' expected");
+	else
+		tp->pos++;
+	return (result);
+}
+
+/**
+ * @brief Evaluates a primary: a binary or unary test, `! primary`,
+ * `( expr )` or a lone string.
+ *
+ * A binary operator in second position wins over the other readings, so
+ * `[ ! = x ]` and `[ ( = ( ]` compare strings, as POSIX asks.
+ *
+ * @param tp The state of the current `test`.
+ * @return The value of the primary.
+ */
+static int	test_primary(t_test_parse *tp)
+{
+	char	**a;
+	int		left;
+
+	a = tp->args + tp->pos;
+	left = tp->argc - tp->pos;
+	if (left <= 0)
+		return (test_error(tp, NULL, "argument expected"), 0);
+	if (left >= 3 && is_test_binary_op(a[1]))
+		return (test_binary(a[0], a[1], a[2], tp));
+	if (left >= 2 && test_str_eq(a[0], "!"))
+	{
+		tp->pos++;
+		return (!test_primary(tp));
+	}
+	if (left >= 2 && test_str_eq(a[0], "("))
+		return (test_paren(tp));
+	if (left >= 2 && is_test_unary_op(a[0]))
+		return (test_unary(a[0], a[1], tp));
+	tp->pos++;
+	return (a[0][0] != '\0');
+}
+
+/**
+ * @brief Evaluates primaries joined by `-a`.
+ *
+ * @param tp The state of the current `test`.
+ * @return The value of the conjunction.
+ */
+static int	test_and(t_test_parse *tp)
+{
+	int	result;
+
+	result = test_primary(tp);
+	while (!tp->error && tp->pos < tp->argc
+		&& test_str_eq(tp->args[tp->pos], "-a"))
+	{
+		tp->pos++;
+		if (!test_primary(tp))
+			result = 0;
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluates conjunctions joined by `-o`: a whole expression.
+ *
+ * @param tp The state of the current `test`.
+ * @return The value of the expression.
+ */
+int	test_or(t_test_parse *tp)
+{
+	int	result;
+
+	result = test_and(tp);
+	while (!tp->error && tp->pos < tp->argc
+		&& test_str_eq(tp->args[tp->pos], "-o"))
+	{
+		tp->pos++;
+		if (test_and(tp))
+			result = 1;
+	}
+	return (result);
+}
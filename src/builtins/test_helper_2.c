@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_helper_2.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether `op` is a unary operator of `test`.
+ */
+int	is_test_unary_op(const char *op)
+{
+	return (op[0] == '-' && op[1] != '\0' && op[2] == '\0'
+		&& ft_strchr("nztefdbcpSsugkOGLhrwx", op[1]) != NULL);
+}
+
+/**
+ * @brief Applies a file test to the result of stat().
+ *
+ * @param op The operator letter.
+ * @param st The status of the file.
+ * @return The result of the test.
+ */
+static int	test_file_status(char op, const struct stat *st)
+{
+	static const char	types[] = "fdbcpS";
+	static const mode_t	modes[] = {S_IFREG, S_IFDIR, S_IFBLK, S_IFCHR,
+		S_IFIFO, S_IFSOCK};
+	int					i;
+
+	i = 0;
+	while (types[i] != '\0' && types[i] != op)
+		i++;
+	if (types[i] != '\0')
+		return ((st->st_mode & S_IFMT) == modes[i]);
+	if (op == 's')
+		return (st->st_size > 0);
+	if (op == 'u')
+		return ((st->st_mode & S_ISUID) != 0);
+	if (op == 'g')
+		return ((st->st_mode & S_ISGID) != 0);
+	if (op == 'k')
+		return ((st->st_mode & S_ISVTX) != 0);
+	if (op == 'O')
+		return (st->st_uid == geteuid());
+	if (op == 'G')
+		return (st->st_gid == getegid());
+	return (1);
+}
+
+/**
+ * @brief Evaluates a unary test.
+ *
+ * File tests cost one system call per operand: access() for `-r`, `-w`
+ * and `-x`, lstat() for `-L` and `-h`, and stat() for the others.
+ *
+ * @param op The operator.
+ * @param arg The operand.
+ * @param tp The state of the current `test`; moved past the test.
+ * @return The result of the test.
+ */
+int	test_unary(const char *op, const char *arg, t_test_parse *tp)
+{
+	struct stat	st;
+	long long	fd;
+
+	tp->pos += 2;
+	if (op[1] == 'n' || op[1] == 'z')
+		return ((arg[0] != '\0') == (op[1] == 'n'));
+	if (op[1] == 't')
+	{
+		if (!ft_str_to_llong(arg, &fd) || fd < 0 || fd > 0x7fffffff)
+			return (test_error(tp, arg, "integer expression expected"), 0);
+		return (isatty((int)fd));
+	}
+	if (op[1] == 'r')
+		return (access(arg, R_OK) == 0);
+	if (op[1] == 'w')
+		return (access(arg, W_OK) == 0);
+	if (op[1] == 'x')
+		return (access(arg, X_OK) == 0);
+	if (op[1] == 'L' || op[1] == 'h')
+		return (lstat(arg, &st) == 0 && S_ISLNK(st.st_mode));
+	if (stat(arg, &st) != 0)
+		return (0);
+	return (test_file_status(op[1], &st));
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_helper_3.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:07:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/14 11:07:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether `op` is a binary operator of `test`.
+ */
+int	is_test_binary_op(const char *op)
+{
+	static const char	*ops[] = {"=", "==", "!=", "<", ">", "-eq", "-ne",
+		"-lt", "-le", "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+	int					i;
+
+	i = 0;
+	while (ops[i] != NULL && !test_str_eq(op, ops[i]))
+		i++;
+	return (ops[i] != NULL);
+}
+
+/**
+ * @brief Tells whether the file of `a` was modified after that of `b`.
+ */
+static int	mtime_after(const struct stat *a, const struct stat *b)
+{
+	if (a->st_mtim.tv_sec != b->st_mtim.tv_sec)
+		return (a->st_mtim.tv_sec > b->st_mtim.tv_sec);
+	return (a->st_mtim.tv_nsec > b->st_mtim.tv_nsec);
+}
+
+/**
+ * @brief Evaluates `-nt`, `-ot` or `-ef`, with one stat() per operand.
+ *
+ * A file that exists is newer than one that does not.
+ */
+static int	test_files(const char *l, const char *op, const char *r)
+{
+	struct stat	a;
+	struct stat	b;
+	int			has_a;
+	int			has_b;
+
+	has_a = (stat(l, &a) == 0);
+	has_b = (stat(r, &b) == 0);
+	if (op[1] == 'e')
+		return (has_a && has_b && a.st_dev == b.st_dev
+			&& a.st_ino == b.st_ino);
+	if (op[1] == 'n')
+		return (has_a && (!has_b || mtime_after(&a, &b)));
+	return (has_b && (!has_a || mtime_after(&b, &a)));
+}
+
+/**
+ * @brief Evaluates an integer comparison such as `-lt`.
+ */
+static int	test_integers(const char *l, const char *op, const char *r,
+							t_test_parse *tp)
+{
+	long long	a;
+	long long	b;
+
+	if (!ft_str_to_llong(l, &a))
+		return (test_error(tp, l, "integer expression expected"), 0);
+	if (!ft_str_to_llong(r, &b))
+		return (test_error(tp, r, "integer expression expected"), 0);
+	if (op[1] == 'e')
+		return (a == b);
+	if (op[1] == 'n')
+		return (a != b);
+	if (op[1] == 'l' && op[2] == 't')
+		return (a < b);
+	if (op[1] == 'l')
+		return (a <= b);
+	if (op[2] == 't')
+		return (a > b);
+	return (a >= b);
+}
+
+/**
+ * @brief Evaluates a binary test.
+ *
+ * @param l The left operand.
+ * @param op The operator; see is_test_binary_op().
+ * @param r The right operand.
+ * @param tp The state of the current `test`; moved past the test.
+ * @return The result of the test.
+ */
+int	test_binary(const char *l, const char *op, const char *r,
+					t_test_parse *tp)
+{
+	int	cmp;
+
+	tp->pos += 3;
+	if (test_str_eq(op, "-nt") || test_str_eq(op, "-ot")
+		|| test_str_eq(op, "-ef"))
+		return (test_files(l, op, r));
+	if (op[0] == '-')
+		return (test_integers(l, op, r, tp));
+	cmp = ft_strncmp(l, r, ft_strlen(l) + 1);
+	if (op[0] == '<')
+		return (cmp < 0);
+	if (op[0] == '>')
+		return (cmp > 0);
+	if (op[0] == '!')
+		return (cmp != 0);
+	return (cmp == 0);
+}
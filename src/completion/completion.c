@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Holds the process data for readline's completion hooks, which
+ * take no such argument.
+ *
+ * @return The slot, set by completion_init() and cleared by
+ *         free_completion().
+ */
+t_process_data	**completion_slot(void)
+{
+	static t_process_data	*pd;
+
+	return (&pd);
+}
+
+/**
+ * @brief Tells whether the word starting at `start` in the line being
+ * edited is in command position: first on the line, or right after
+ * `|`, `;`, `&` or `(`.
+ */
+static int	is_command_position(int start)
+{
+	int	i;
+
+	i = start - 1;
+	while (i >= 0 && (rl_line_buffer[i] == ' ' || rl_line_buffer[i] == '\t'))
+		i--;
+	if (i < 0)
+		return (1);
+	return (ft_strchr("|;&(", rl_line_buffer[i]) != NULL);
+}
+
+/**
+ * @brief Readline generator of the command names that start with `text`.
+ *
+ * The names are listed from the trie on the first call (`state` 0) and
+ * handed out one per call.
+ *
+ * @param text The word being completed.
+ * @param state 0 on the first call for this word.
+ * @return The next name, allocated, or NULL when there are no more.
+ */
+static char	*command_generator(const char *text, int state)
+{
+	t_completion	*comp;
+	char			*name;
+
+	comp = (*completion_slot())->completion;
+	if (state == 0)
+	{
+		free_split(comp->matches);
+		comp->matches = trie_words(comp->root, text);
+		comp->next = 0;
+	}
+	if (comp->matches == NULL || comp->matches[comp->next] == NULL)
+		return (NULL);
+	name = ft_strdup(comp->matches[comp->next++]);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (name);
+}
+
+/**
+ * @brief Readline's completion hook.
+ *
+ * A word in command position without a `/` is completed from the trie
+ * of command names. Otherwise, or if no command matches, readline falls
+ * back to completing file names.
+ *
+ * @param text The word being completed.
+ * @param start Its offset in the line.
+ * @param end The offset of its end (unused).
+ * @return The matches, or NULL for file-name completion.
+ */
+static char	**attempt_completion(const char *text, int start, int end)
+{
+	t_process_data	*pd;
+
+	(void)end;
+	pd = *completion_slot();
+	if (pd == NULL || pd->completion == NULL || ft_strchr(text, '/') != NULL
+		|| !is_command_position(start))
+		return (NULL);
+	completion_refresh(pd->completion, pd->env_list);
+	return (rl_completion_matches(text, command_generator));
+}
+
+/**
+ * @brief Sets up command-name completion for an interactive shell.
+ *
+ * Nothing is read yet: PATH is read on the first Tab.
+ *
+ * @param pd The process data receiving the completion.
+ */
+void	completion_init(t_process_data *pd)
+{
+	pd->completion = ft_calloc(1, sizeof(t_completion));
+	if (pd->completion == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	*completion_slot() = pd;
+	rl_attempted_completion_function = attempt_completion;
+}
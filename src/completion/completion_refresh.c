@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion_refresh.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether two PATH values, either of them possibly NULL,
+ * are the same.
+ */
+static int	same_path(const char *a, const char *b)
+{
+	if (a == NULL || b == NULL)
+		return (a == b);
+	return (ft_strncmp(a, b, ft_strlen(a) + 1) == 0);
+}
+
+/**
+ * @brief Replaces the directories of a completion with those of the
+ * current PATH, split by find_path_dirs() as for running a command.
+ *
+ * The new directories are read by the next refresh_dir().
+ *
+ * @param comp The completion.
+ * @param env_list The environment holding PATH.
+ * @param value The value of PATH, or NULL if it is unset.
+ */
+static void	reset_dirs(t_completion *comp, t_env_var *env_list,
+		const char *value)
+{
+	char	**paths;
+	int		n;
+
+	free_path_dirs(comp);
+	free(comp->path_value);
+	comp->path_value = NULL;
+	if (value != NULL)
+		comp->path_value = ft_strdup(value);
+	paths = find_path_dirs(env_list);
+	n = 0;
+	while (paths != NULL && paths[n] != NULL)
+		n++;
+	comp->dirs = ft_calloc(n + 1, sizeof(t_path_dir));
+	if (comp->dirs == NULL || (value != NULL && comp->path_value == NULL))
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	comp->ndirs = n;
+	while (n-- > 0)
+		comp->dirs[n].path = paths[n];
+	free(paths);
+}
+
+/**
+ * @brief Builds the trie of the builtins and of the executables of every
+ * PATH directory, from the names in memory.
+ *
+ * @param comp The completion.
+ */
+static void	rebuild_trie(t_completion *comp)
+{
+	const t_builtin	*builtin;
+	int				i;
+	int				j;
+
+	free_trie(comp->root);
+	comp->root = ft_calloc(1, sizeof(t_trie));
+	if (comp->root == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	builtin = builtin_table();
+	while (builtin->name != NULL)
+		trie_insert(comp->root, (builtin++)->name);
+	i = 0;
+	while (i < comp->ndirs)
+	{
+		j = 0;
+		while (j < comp->dirs[i].count)
+			trie_insert(comp->root, comp->dirs[i].names[j++]);
+		i++;
+	}
+}
+
+/**
+ * @brief Brings the command-name trie up to date before a completion.
+ *
+ * A change of PATH replaces the directories. Otherwise each directory is
+ * only stat()ed, and read again if its mtime changed. The trie is
+ * rebuilt only if a directory was read.
+ *
+ * @param comp The completion.
+ * @param env_list The environment holding PATH.
+ */
+void	completion_refresh(t_completion *comp, t_env_var *env_list)
+{
+	t_env_var	*var;
+	char		*value;
+	int			changed;
+	int			i;
+
+	var = find_env_var("PATH", env_list);
+	value = NULL;
+	if (var != NULL)
+		value = var->value;
+	changed = (comp->root == NULL);
+	if (comp->dirs == NULL || !same_path(value, comp->path_value))
+	{
+		reset_dirs(comp, env_list, value);
+		changed = 1;
+	}
+	i = 0;
+	while (i < comp->ndirs)
+		changed |= refresh_dir(&comp->dirs[i++]);
+	if (changed)
+		rebuild_trie(comp);
+}
+
+/**
+ * @brief Frees the command-name completion.
+ *
+ * @param pd The process data holding it.
+ */
+void	free_completion(t_process_data *pd)
+{
+	t_completion	*comp;
+
+	comp = pd->completion;
+	if (comp == NULL)
+		return ;
+	free_path_dirs(comp);
+	free(comp->path_value);
+	free_trie(comp->root);
+	free_split(comp->matches);
+	free(comp);
+	pd->completion = NULL;
+	*completion_slot() = NULL;
+	rl_attempted_completion_function = NULL;
+}
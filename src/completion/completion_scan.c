@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion_scan.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <dirent.h>
+
+/**
+ * @brief Tells whether a directory entry is a file that can be run.
+ *
+ * @param fd The directory.
+ * @param name The entry.
+ * @return 1 for a regular file with an execute bit set, 0 otherwise.
+ */
+static int	is_executable(int fd, const char *name)
+{
+	struct stat	st;
+
+	if (fstatat(fd, name, &st, 0) != 0)
+		return (0);
+	return (S_ISREG(st.st_mode) && (st.st_mode & 0111) != 0);
+}
+
+/**
+ * @brief Adds a name to the executables of a directory.
+ *
+ * @param dir The directory.
+ * @param name The name.
+ */
+static void	add_name(t_path_dir *dir, const char *name)
+{
+	char	**grown;
+
+	if (dir->count + 1 >= dir->cap)
+	{
+		dir->cap = dir->cap * 2 + 64;
+		grown = ft_calloc(dir->cap, sizeof(char *));
+		if (grown == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		if (dir->names != NULL)
+			ft_memcpy(grown, dir->names, dir->count * sizeof(char *));
+		free(dir->names);
+		dir->names = grown;
+	}
+	dir->names[dir->count] = ft_strdup(name);
+	if (dir->names[dir->count] == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	dir->count++;
+}
+
+/**
+ * @brief Reads the executables of a directory, in place of the names it
+ * had. A directory that cannot be opened has none.
+ *
+ * @param dir The directory.
+ */
+static void	read_dir(t_path_dir *dir)
+{
+	struct dirent	*ent;
+	DIR				*d;
+
+	free_split(dir->names);
+	dir->names = NULL;
+	dir->count = 0;
+	dir->cap = 0;
+	d = opendir(dir->path);
+	if (d == NULL)
+		return ;
+	ent = readdir(d);
+	while (ent != NULL)
+	{
+		if (is_executable(dirfd(d), ent->d_name))
+			add_name(dir, ent->d_name);
+		ent = readdir(d);
+	}
+	closedir(d);
+}
+
+/**
+ * @brief Reads the executables of a PATH directory again, if its mtime
+ * changed since they were last read.
+ *
+ * Adding, removing or renaming a file changes the mtime of its
+ * directory, so an unchanged directory still has the same names. A
+ * directory that cannot be stat()ed counts as empty.
+ *
+ * @param dir The directory.
+ * @return 1 if the directory was read again, 0 if it is unchanged.
+ */
+int	refresh_dir(t_path_dir *dir)
+{
+	struct stat	st;
+
+	if (stat(dir->path, &st) != 0)
+		ft_bzero(&st, sizeof(struct stat));
+	if (st.st_mtim.tv_sec == dir->mtime.tv_sec
+		&& st.st_mtim.tv_nsec == dir->mtime.tv_nsec)
+		return (0);
+	dir->mtime = st.st_mtim;
+	read_dir(dir);
+	return (1);
+}
+
+/**
+ * @brief Frees the PATH directories of a completion and their names.
+ *
+ * @param comp The completion.
+ */
+void	free_path_dirs(t_completion *comp)
+{
+	int	i;
+
+	i = 0;
+	while (i < comp->ndirs)
+	{
+		free(comp->dirs[i].path);
+		free_split(comp->dirs[i].names);
+		i++;
+	}
+	free(comp->dirs);
+	comp->dirs = NULL;
+	comp->ndirs = 0;
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion_trie.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds the child of a trie node for byte `c`, adding it in its
+ * sorted place if it is missing.
+ *
+ * @param node The parent.
+ * @param c The byte.
+ * @return The child.
+ */
+static t_trie	*trie_child(t_trie *node, unsigned char c)
+{
+	t_trie	**link;
+	t_trie	*child;
+
+	link = &node->child;
+	while (*link != NULL && (*link)->c < c)
+		link = &(*link)->sibling;
+	if (*link != NULL && (*link)->c == c)
+		return (*link);
+	child = ft_calloc(1, sizeof(t_trie));
+	if (child == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	child->c = c;
+	child->sibling = *link;
+	*link = child;
+	return (child);
+}
+
+/**
+ * @brief Adds a name to a trie.
+ *
+ * @param root The root of the trie.
+ * @param word The name.
+ * @return The node that ends the name.
+ */
+t_trie	*trie_insert(t_trie *root, const char *word)
+{
+	t_trie	*node;
+
+	node = root;
+	while (*word != '\0')
+		node = trie_child(node, (unsigned char)*word++);
+	node->terminal = 1;
+	return (node);
+}
+
+/**
+ * @brief Finds the node a prefix leads to.
+ *
+ * @param root The root of the trie.
+ * @param prefix The prefix.
+ * @return The node, or NULL if no name starts with the prefix.
+ */
+t_trie	*trie_find(t_trie *root, const char *prefix)
+{
+	t_trie	*node;
+
+	node = root;
+	while (node != NULL && *prefix != '\0')
+	{
+		node = node->child;
+		while (node != NULL && node->c < (unsigned char)*prefix)
+			node = node->sibling;
+		if (node != NULL && node->c != (unsigned char)*prefix)
+			node = NULL;
+		prefix++;
+	}
+	return (node);
+}
+
+/**
+ * @brief Frees a trie.
+ *
+ * Siblings are freed in a loop and only children recursively, so the
+ * depth of the recursion is the length of the longest name.
+ *
+ * @param node The root of the trie, or NULL.
+ */
+void	free_trie(t_trie *node)
+{
+	t_trie	*next;
+
+	while (node != NULL)
+	{
+		next = node->sibling;
+		free_trie(node->child);
+		free(node);
+		node = next;
+	}
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion_words.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Adds the name spelled in `w->buf` to the list.
+ *
+ * @param w The list.
+ * @param depth The length of the name.
+ */
+static void	push_word(t_words *w, int depth)
+{
+	char	**grown;
+
+	if (w->len + 1 >= w->cap)
+	{
+		w->cap = w->cap * 2 + 16;
+		grown = ft_calloc(w->cap, sizeof(char *));
+		if (grown == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		if (w->items != NULL)
+			ft_memcpy(grown, w->items, w->len * sizeof(char *));
+		free(w->items);
+		w->items = grown;
+	}
+	w->items[w->len] = ft_strndup(w->buf, depth);
+	if (w->items[w->len] == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	w->len++;
+	w->items[w->len] = NULL;
+}
+
+/**
+ * @brief Collects the names below a trie node, in byte order.
+ *
+ * @param node The node; `w->buf` holds the `depth` bytes leading to it.
+ * @param w The list.
+ * @param depth The length of the prefix.
+ */
+static void	collect_words(t_trie *node, t_words *w, int depth)
+{
+	if (node->terminal)
+		push_word(w, depth);
+	node = node->child;
+	while (node != NULL && depth < NAME_MAX)
+	{
+		w->buf[depth] = node->c;
+		collect_words(node, w, depth + 1);
+		node = node->sibling;
+	}
+}
+
+/**
+ * @brief Lists the names of a trie that start with `prefix`.
+ *
+ * @param root The root of the trie.
+ * @param prefix The prefix.
+ * @return The names in byte order, NULL-terminated, or NULL if there is
+ *         none.
+ */
+char	**trie_words(t_trie *root, const char *prefix)
+{
+	t_words	w;
+	t_trie	*node;
+	size_t	len;
+
+	len = ft_strlen(prefix);
+	node = trie_find(root, prefix);
+	if (node == NULL || len > NAME_MAX)
+		return (NULL);
+	ft_bzero(&w, sizeof(t_words));
+	ft_memcpy(w.buf, prefix, len);
+	collect_words(node, &w, len);
+	return (w.items);
+}
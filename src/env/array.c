@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Grows the vector of an indexed array to hold `len` slots.
+ *
+ * The capacity doubles, so filling an array one element at a time costs
+ * amortized constant time per element. New slots are unset (NULL).
+ *
+ * @param arr The indexed array.
+ * @param len The number of slots needed.
+ */
+static void	array_reserve(t_array *arr, size_t len)
+{
+	char	**items;
+	size_t	cap;
+
+	if (len <= arr->cap)
+		return ;
+	cap = arr->cap * 2;
+	if (cap < 8)
+		cap = 8;
+	while (cap < len)
+		cap *= 2;
+	items = ft_calloc(cap, sizeof(char *));
+	if (items == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (arr->len > 0)
+		ft_memcpy(items, arr->items, arr->len * sizeof(char *));
+	free(arr->items);
+	arr->items = items;
+	arr->cap = cap;
+}
+
+/**
+ * @brief Sets one element of an indexed array.
+ *
+ * A negative index counts back from the end: -1 is the last slot. The
+ * vector is not sparse, so indices are capped at ARRAY_MAX_INDEX.
+ *
+ * @param arr The indexed array.
+ * @param index The element index.
+ * @param value The new value, copied.
+ * @return 0 on success, -1 if the index is out of range.
+ */
+int	array_set(t_array *arr, long index, const char *value)
+{
+	char	*copy;
+
+	if (index < 0)
+		index += arr->len;
+	if (index < 0 || index > ARRAY_MAX_INDEX)
+		return (-1);
+	copy = ft_strdup(value);
+	if (copy == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	array_reserve(arr, (size_t)index + 1);
+	if (arr->items[index] == NULL)
+		arr->count++;
+	free(arr->items[index]);
+	arr->items[index] = copy;
+	if ((size_t)index >= arr->len)
+		arr->len = index + 1;
+	return (0);
+}
+
+/**
+ * @brief Gets one element of an indexed array.
+ *
+ * @param arr The indexed array.
+ * @param index The element index; a negative one counts from the end.
+ * @return The value, owned by the array, or NULL if the element is unset.
+ */
+const char	*array_get(t_array *arr, long index)
+{
+	if (index < 0)
+		index += arr->len;
+	if (index < 0 || (size_t)index >= arr->len)
+		return (NULL);
+	return (arr->items[index]);
+}
+
+/**
+ * @brief Unsets one element of an indexed array, as `unset 'a[i]'` does.
+ *
+ * The other elements keep their indices; trailing unset slots are
+ * dropped so that `a+=(x)` appends right after the last element set.
+ *
+ * @param arr The indexed array.
+ * @param index The element index; a negative one counts from the end.
+ */
+void	array_unset_at(t_array *arr, long index)
+{
+	if (index < 0)
+		index += arr->len;
+	if (index < 0 || (size_t)index >= arr->len || arr->items[index] == NULL)
+		return ;
+	free(arr->items[index]);
+	arr->items[index] = NULL;
+	arr->count--;
+	while (arr->len > 0 && arr->items[arr->len - 1] == NULL)
+		arr->len--;
+}
@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_assign.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Expands the elements of a compound assignment.
+ *
+ * The text between the parentheses is split into words and expanded like
+ * the arguments of a command, so `a=(x "y z" "${b[@]}")` gets x, y z and
+ * every element of b.
+ *
+ * @param word The compound assignment, as written.
+ * @param pd The process data.
+ * @return The elements, or NULL if there are none.
+ */
+static char	**compound_elements(const char *word, t_process_data *pd)
+{
+	char	*inner;
+	t_token	**tokens;
+	char	**elements;
+
+	inner = ft_strchr(word, '(') + 1;
+	inner = ft_substr(inner, 0, ft_strlen(inner) - 1);
+	if (inner == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	tokens = parse_line(inner, NULL);
+	free(inner);
+	if (tokens == NULL)
+		return (NULL);
+	elements = expand_and_split_args(tokens, pd);
+	free_tokens(tokens);
+	return (elements);
+}
+
+/**
+ * @brief Extracts the key of an element written `[key]=value`.
+ *
+ * @param element The element.
+ * @param value Receives the value: what follows `]=`, or the whole
+ *              element if it has no key.
+ * @return The key, newly allocated, or NULL if the element has none.
+ */
+static char	*element_key(char *element, char **value)
+{
+	char	*close;
+	char	*key;
+
+	*value = element;
+	if (element[0] != '[')
+		return (NULL);
+	close = ft_strnstr(element, "]=", ft_strlen(element));
+	if (close == NULL)
+		return (NULL);
+	key = ft_substr(element, 1, close - element - 1);
+	if (key == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	*value = close + 2;
+	return (key);
+}
+
+/**
+ * @brief Stores the elements of a compound assignment to an indexed
+ * array.
+ *
+ * Plain elements go to consecutive indices, starting after the last one
+ * set; `[i]=value` moves that position.
+ *
+ * @param arr The indexed array.
+ * @param elements The expanded elements (may be NULL).
+ * @param pd The process data.
+ * @return 0 on success, 1 if an index was out of range.
+ */
+static int	fill_indexed(t_array *arr, char **elements, t_process_data *pd)
+{
+	t_expand_data	data;
+	char			*sub;
+	char			*value;
+	long			next;
+	int				status;
+
+	fill_expand_data(&data, pd);
+	next = arr->len;
+	status = 0;
+	while (elements != NULL && *elements != NULL)
+	{
+		sub = element_key(*elements, &value);
+		if (sub != NULL)
+			next = array_index(sub, &data);
+		if (array_set(arr, next++, value) != 0)
+		{
+			ft_error(arr->name, "bad array subscript");
+			status = 1;
+		}
+		free(sub);
+		elements++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Stores the elements of a compound assignment to an associative
+ * array: `[key]=value` elements, or else keys and values in turn, as in
+ * `m=(k1 v1 k2 v2)`.
+ *
+ * @param arr The associative array.
+ * @param elements The expanded elements (may be NULL).
+ */
+static void	fill_assoc(t_array *arr, char **elements)
+{
+	char	*key;
+	char	*value;
+
+	while (elements != NULL && *elements != NULL)
+	{
+		key = element_key(*elements, &value);
+		if (key != NULL)
+			assoc_set(arr, key, value);
+		value = "";
+		if (key == NULL && elements[1] != NULL)
+			value = elements[1];
+		if (key == NULL)
+			assoc_set(arr, *elements, value);
+		if (key == NULL && elements[1] != NULL)
+			elements++;
+		free(key);
+		elements++;
+	}
+}
+
+/**
+ * @brief Performs a compound assignment, `NAME=(...)` or `NAME+=(...)`.
+ *
+ * The elements are expanded before the array is cleared, so that
+ * `a=("${a[@]}" x)` sees the old elements. `+=` appends instead. A name
+ * that is not an array yet becomes one, of the kind given.
+ *
+ * @param word The compound assignment, as written.
+ * @param assoc Whether a new array is associative (`declare -A`).
+ * @param pd The process data.
+ * @return 0 on success, 1 if an element could not be stored.
+ */
+int	assign_compound(const char *word, int assoc, t_process_data *pd)
+{
+	char	*name;
+	t_array	*arr;
+	char	**elements;
+	int		status;
+
+	name = ft_substr(word, 0, ft_strchr(word, '=') - word);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	status = (name[ft_strlen(name) - 1] == '+');
+	if (status)
+		name[ft_strlen(name) - 1] = '\0';
+	arr = find_array(pd->arrays, name);
+	if (arr == NULL)
+		arr = declare_array(name, assoc, pd);
+	free(name);
+	elements = compound_elements(word, pd);
+	if (!status)
+		clear_array(arr);
+	status = 0;
+	if (arr->assoc)
+		fill_assoc(arr, elements);
+	else
+		status = fill_indexed(arr, elements, pd);
+	free_split(elements);
+	return (status);
+}
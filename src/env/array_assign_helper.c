@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_assign_helper.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks if a word is a compound assignment, `NAME=(...)` or
+ * `NAME+=(...)`.
+ *
+ * @param word The word to check.
+ * @return 1 if it is, 0 otherwise.
+ */
+int	is_compound_assignment(const char *word)
+{
+	size_t	i;
+
+	if (word == NULL || !(ft_isalpha(word[0]) || word[0] == '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(word[i]) || word[i] == '_')
+		i++;
+	if (word[i] == '+')
+		i++;
+	if (word[i] != '=' || word[i + 1] != '(')
+		return (0);
+	return (word[ft_strlen(word) - 1] == ')');
+}
+
+/**
+ * @brief Stores the value of an element assignment, appending to the old
+ * value for `+=`.
+ *
+ * @param arr The array.
+ * @param sub The subscript.
+ * @param eq The `=` of the assignment word; the value follows it.
+ * @param pd The process data.
+ * @return 0 on success, 1 if the index is out of range.
+ */
+static int	put_element(t_array *arr, const char *sub, const char *eq,
+		t_process_data *pd)
+{
+	t_expand_data	data;
+	char			*old;
+	char			*value;
+	int				status;
+
+	fill_expand_data(&data, pd);
+	value = (char *)eq + 1;
+	old = NULL;
+	if (eq[-1] == '+')
+	{
+		old = array_element(arr, sub, &data);
+		if (old != NULL)
+			value = ft_strjoin(old, eq + 1);
+		if (old == NULL || value == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	}
+	status = store_element(arr, sub, value, &data);
+	if (old != NULL)
+		free(value);
+	free(old);
+	return (status != 0);
+}
+
+/**
+ * @brief Performs an element assignment, `NAME[sub]=value` or
+ * `NAME[sub]+=value`. A name that is not an array yet becomes an indexed
+ * one.
+ *
+ * @param word The assignment word, after expansion.
+ * @param eq The `=` in it.
+ * @param pd The process data.
+ * @return 0 on success, 1 if the index is out of range.
+ */
+static int	assign_element(const char *word, const char *eq,
+		t_process_data *pd)
+{
+	t_array	*arr;
+	char	*name;
+	char	*sub;
+	int		status;
+
+	name = ft_substr(word, 0, eq - word - (eq[-1] == '+'));
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	sub = ft_strchr(name, '[');
+	*sub = '\0';
+	sub++;
+	sub[ft_strlen(sub) - 1] = '\0';
+	arr = find_array(pd->arrays, name);
+	if (arr == NULL)
+		arr = declare_array(name, 0, pd);
+	status = put_element(arr, sub, eq, pd);
+	free(name);
+	return (status);
+}
+
+/**
+ * @brief Performs `NAME+=value`: appends to the value of a variable, or
+ * to element 0 of an array.
+ *
+ * @param word The assignment word, after expansion.
+ * @param eq The `=` in it.
+ * @param pd The process data.
+ * @return 0.
+ */
+static int	append_scalar(const char *word, const char *eq,
+		t_process_data *pd)
+{
+	t_expand_data	data;
+	char			*name;
+	char			*old;
+	char			*value;
+
+	name = ft_substr(word, 0, eq - word - 1);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	fill_expand_data(&data, pd);
+	old = get_var_value(name, &data);
+	value = NULL;
+	if (old != NULL)
+		value = ft_strjoin(old, eq + 1);
+	if (value == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	set_shell_var(name, value, pd);
+	free(old);
+	free(value);
+	free(name);
+	return (0);
+}
+
+/**
+ * @brief Performs an assignment word that is not a plain `NAME=value`:
+ * a compound assignment, an element assignment or an append (`+=`).
+ *
+ * @param word The assignment word, after expansion; see
+ *             is_assignment_word().
+ * @param pd The process data.
+ * @return 0 on success, 1 if a value could not be stored.
+ */
+int	run_array_assignment(const char *word, t_process_data *pd)
+{
+	char	*eq;
+	char	*bracket;
+
+	if (is_compound_assignment(word))
+		return (assign_compound(word, 0, pd));
+	eq = ft_strchr(word, '=');
+	bracket = ft_strchr(word, '[');
+	if (bracket != NULL && bracket < eq)
+		return (assign_element(word, eq, pd));
+	return (append_scalar(word, eq, pd));
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_assoc.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds a key of an associative array.
+ *
+ * @param arr The associative array.
+ * @param key The key.
+ * @return The entry, or NULL if the key is not set.
+ */
+t_assoc_entry	*assoc_find(t_array *arr, const char *key)
+{
+	t_assoc_entry	*entry;
+
+	if (arr->buckets == NULL)
+		return (NULL);
+	entry = arr->buckets[array_hash(key, arr->nbuckets)];
+	while (entry != NULL && ft_strncmp(entry->key, key, ft_strlen(key) + 1))
+		entry = entry->next;
+	return (entry);
+}
+
+/**
+ * @brief Moves every entry of an associative array into a new table of
+ * `n` chains. Entries are relinked; none is copied.
+ *
+ * @param arr The associative array.
+ * @param buckets The new, empty chains.
+ * @param n The number of new chains.
+ */
+static void	assoc_rehash(t_array *arr, t_assoc_entry **buckets, size_t n)
+{
+	t_assoc_entry	*entry;
+	unsigned int	bucket;
+	size_t			i;
+
+	i = 0;
+	while (i < arr->nbuckets)
+	{
+		while (arr->buckets[i] != NULL)
+		{
+			entry = arr->buckets[i];
+			arr->buckets[i] = entry->next;
+			bucket = array_hash(entry->key, n);
+			entry->next = buckets[bucket];
+			buckets[bucket] = entry;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Doubles the number of chains of an associative array, keeping
+ * lookups at constant time as it fills.
+ *
+ * @param arr The associative array.
+ */
+static void	assoc_grow(t_array *arr)
+{
+	t_assoc_entry	**buckets;
+	size_t			n;
+
+	n = ASSOC_MIN_BUCKETS;
+	if (arr->nbuckets > 0)
+		n = arr->nbuckets * 2;
+	buckets = ft_calloc(n, sizeof(t_assoc_entry *));
+	if (buckets == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	assoc_rehash(arr, buckets, n);
+	free(arr->buckets);
+	arr->buckets = buckets;
+	arr->nbuckets = n;
+}
+
+/**
+ * @brief Creates an unlinked entry.
+ *
+ * @param key The key, copied.
+ * @param value The value, owned by the entry from now on.
+ * @return The entry; exits the shell on allocation failure.
+ */
+static t_assoc_entry	*new_assoc_entry(const char *key, char *value)
+{
+	t_assoc_entry	*entry;
+
+	entry = malloc(sizeof(t_assoc_entry));
+	if (entry == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	entry->key = ft_strdup(key);
+	if (entry->key == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	entry->value = value;
+	entry->next = NULL;
+	return (entry);
+}
+
+/**
+ * @brief Sets one key of an associative array.
+ *
+ * The table doubles once it holds as many keys as chains.
+ *
+ * @param arr The associative array.
+ * @param key The key, copied.
+ * @param value The new value, copied.
+ */
+void	assoc_set(t_array *arr, const char *key, const char *value)
+{
+	t_assoc_entry	*entry;
+	char			*copy;
+	unsigned int	bucket;
+
+	copy = ft_strdup(value);
+	if (copy == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	entry = assoc_find(arr, key);
+	if (entry != NULL)
+	{
+		free(entry->value);
+		entry->value = copy;
+		return ;
+	}
+	if (arr->count >= arr->nbuckets)
+		assoc_grow(arr);
+	entry = new_assoc_entry(key, copy);
+	bucket = array_hash(key, arr->nbuckets);
+	entry->next = arr->buckets[bucket];
+	arr->buckets[bucket] = entry;
+	arr->count++;
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_assoc_helper.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Gets one key of an associative array.
+ *
+ * @param arr The associative array.
+ * @param key The key.
+ * @return The value, owned by the array, or NULL if the key is not set.
+ */
+const char	*assoc_get(t_array *arr, const char *key)
+{
+	t_assoc_entry	*entry;
+
+	entry = assoc_find(arr, key);
+	if (entry == NULL)
+		return (NULL);
+	return (entry->value);
+}
+
+/**
+ * @brief Unsets one key of an associative array.
+ *
+ * @param arr The associative array.
+ * @param key The key.
+ */
+void	assoc_unset(t_array *arr, const char *key)
+{
+	t_assoc_entry	**link;
+	t_assoc_entry	*entry;
+
+	if (arr->buckets == NULL)
+		return ;
+	link = &arr->buckets[array_hash(key, arr->nbuckets)];
+	while (*link != NULL && ft_strncmp((*link)->key, key,
+			ft_strlen(key) + 1) != 0)
+		link = &(*link)->next;
+	entry = *link;
+	if (entry == NULL)
+		return ;
+	*link = entry->next;
+	free(entry->key);
+	free(entry->value);
+	free(entry);
+	arr->count--;
+}
+
+/**
+ * @brief Frees every key of an associative array and its table.
+ *
+ * @param arr The associative array.
+ */
+void	free_assoc(t_array *arr)
+{
+	t_assoc_entry	*entry;
+	size_t			i;
+
+	i = 0;
+	while (arr->buckets != NULL && i < arr->nbuckets)
+	{
+		while (arr->buckets[i] != NULL)
+		{
+			entry = arr->buckets[i];
+			arr->buckets[i] = entry->next;
+			free(entry->key);
+			free(entry->value);
+			free(entry);
+		}
+		i++;
+	}
+	free(arr->buckets);
+	arr->buckets = NULL;
+	arr->nbuckets = 0;
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_element.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Evaluates the subscript of an indexed array.
+ *
+ * The subscript has had its `$` expansions done already. It is an
+ * integer, possibly negative, or the name of a variable holding one, as
+ * in `${a[i]}`; arithmetic is not supported and anything else is 0.
+ *
+ * @param sub The subscript.
+ * @param data The variables to look names up in (NULL for none).
+ * @return The index.
+ */
+long	array_index(const char *sub, t_expand_data *data)
+{
+	long long	index;
+	char		*value;
+
+	while (*sub == ' ' || *sub == '\t')
+		sub++;
+	if (ft_str_to_llong(sub, &index))
+		return ((long)index);
+	if (data == NULL || !is_valid_identifier(sub))
+		return (0);
+	value = get_var_value(sub, data);
+	if (value == NULL || !ft_str_to_llong(value, &index))
+		index = 0;
+	free(value);
+	return ((long)index);
+}
+
+/**
+ * @brief Gets one element of an array, or all of them joined by spaces
+ * for a subscript of `@` or `*`.
+ *
+ * @param arr The array.
+ * @param sub The subscript, after expansion.
+ * @param data The variables, for the index of an indexed array.
+ * @return A newly allocated string, empty if the element is not set.
+ */
+char	*array_element(t_array *arr, const char *sub, t_expand_data *data)
+{
+	const char	*value;
+	char		**list;
+	char		*joined;
+
+	if (ft_strncmp(sub, "@", 2) == 0 || ft_strncmp(sub, "*", 2) == 0)
+	{
+		list = array_list(arr, 0);
+		joined = join_words(list);
+		free_split(list);
+		return (joined);
+	}
+	if (arr->assoc)
+		value = assoc_get(arr, sub);
+	else
+		value = array_get(arr, array_index(sub, data));
+	if (value == NULL)
+		value = "";
+	return (ft_strdup(value));
+}
+
+/**
+ * @brief Sets one element of an array, by key or by index.
+ *
+ * @param arr The array.
+ * @param sub The subscript, after expansion.
+ * @param value The new value, copied.
+ * @param data The variables, for the index of an indexed array.
+ * @return 0 on success, -1 after reporting an index out of range.
+ */
+int	store_element(t_array *arr, const char *sub, const char *value,
+		t_expand_data *data)
+{
+	if (arr->assoc)
+	{
+		assoc_set(arr, sub, value);
+		return (0);
+	}
+	if (array_set(arr, array_index(sub, data), value) == 0)
+		return (0);
+	ft_error(arr->name, "bad array subscript");
+	return (-1);
+}
+
+/**
+ * @brief Unsets one element named `name[sub]` by an argument of `unset`.
+ *
+ * @param arg The argument, ending with `]`.
+ * @param bracket The `[` in it.
+ * @param pd The process data holding the arrays.
+ */
+static void	unset_element(char *arg, char *bracket, t_process_data *pd)
+{
+	t_expand_data	data;
+	t_array			*arr;
+	char			*sub;
+
+	*bracket = '\0';
+	arr = find_array(pd->arrays, arg);
+	*bracket = '[';
+	if (arr == NULL)
+		return ;
+	sub = ft_substr(bracket + 1, 0, ft_strlen(bracket + 1) - 1);
+	if (sub == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	fill_expand_data(&data, pd);
+	if (arr->assoc)
+		assoc_unset(arr, sub);
+	else
+		array_unset_at(arr, array_index(sub, &data));
+	free(sub);
+}
+
+/**
+ * @brief Unsets the arrays and array elements named by the arguments of
+ * `unset`: `name` removes the whole array, `name[sub]` one element.
+ *
+ * @param args The command and its arguments.
+ * @param pd The process data holding the arrays.
+ */
+void	unset_array_args(char **args, t_process_data *pd)
+{
+	char	*bracket;
+
+	while (*(++args) != NULL)
+	{
+		bracket = ft_strchr(*args, '[');
+		if (bracket != NULL && bracket != *args
+			&& (*args)[ft_strlen(*args) - 1] == ']')
+			unset_element(*args, bracket, pd);
+		else if (bracket == NULL)
+			unset_array(*args, pd);
+	}
+}
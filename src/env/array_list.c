@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Removes every element of an array, leaving it declared but
+ * empty, as an assignment `name=(...)` does before filling it.
+ *
+ * @param arr The array.
+ */
+void	clear_array(t_array *arr)
+{
+	size_t	i;
+
+	i = 0;
+	while (arr->items != NULL && i < arr->len)
+		free(arr->items[i++]);
+	free(arr->items);
+	arr->items = NULL;
+	arr->len = 0;
+	arr->cap = 0;
+	free_assoc(arr);
+	arr->count = 0;
+}
+
+/**
+ * @brief Exits the shell if any copy of a listing failed.
+ *
+ * @param list The listing.
+ * @param n The number of entries filled in.
+ */
+static void	check_list(char **list, size_t n)
+{
+	while (n > 0)
+	{
+		n--;
+		if (list[n] == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	}
+}
+
+/**
+ * @brief Lists the elements or the indices of an indexed array.
+ *
+ * @param arr The indexed array.
+ * @param list Receives the copies; sized for `arr->count` entries.
+ * @param keys Whether to list the indices instead of the values.
+ */
+static void	list_indexed(t_array *arr, char **list, int keys)
+{
+	size_t	n;
+	size_t	i;
+
+	n = 0;
+	i = 0;
+	while (i < arr->len)
+	{
+		if (arr->items[i] != NULL && keys)
+			list[n++] = ft_itoa(i);
+		else if (arr->items[i] != NULL)
+			list[n++] = ft_strdup(arr->items[i]);
+		i++;
+	}
+	check_list(list, n);
+}
+
+/**
+ * @brief Lists the values or the keys of an associative array.
+ *
+ * @param arr The associative array.
+ * @param list Receives the copies; sized for `arr->count` entries.
+ * @param keys Whether to list the keys instead of the values.
+ */
+static void	list_assoc(t_array *arr, char **list, int keys)
+{
+	t_assoc_entry	*entry;
+	size_t			n;
+	size_t			i;
+
+	n = 0;
+	i = 0;
+	while (i < arr->nbuckets)
+	{
+		entry = arr->buckets[i++];
+		while (entry != NULL)
+		{
+			if (keys)
+				list[n++] = ft_strdup(entry->key);
+			else
+				list[n++] = ft_strdup(entry->value);
+			entry = entry->next;
+		}
+	}
+	check_list(list, n);
+}
+
+/**
+ * @brief Lists the elements or the keys of an array, in index order for
+ * an indexed array and in table order for an associative one.
+ *
+ * This is what `"${name[@]}"` and `${!name[@]}` expand to.
+ *
+ * @param arr The array.
+ * @param keys Whether to list the keys (indices) instead of the values.
+ * @return A NULL-terminated array of copies; exits on allocation failure.
+ */
+char	**array_list(t_array *arr, int keys)
+{
+	char	**list;
+
+	list = ft_calloc(arr->count + 1, sizeof(char *));
+	if (list == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (arr->assoc)
+		list_assoc(arr, list, keys);
+	else
+		list_indexed(arr, list, keys);
+	return (list);
+}
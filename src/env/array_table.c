@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_table.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Hashes a name into one of `nbuckets` chains (djb2).
+ *
+ * Used both for the table of arrays and for the keys of an associative
+ * array.
+ *
+ * @param name The name or key.
+ * @param nbuckets The number of chains.
+ * @return The chain index, below `nbuckets`.
+ */
+unsigned int	array_hash(const char *name, size_t nbuckets)
+{
+	unsigned int	hash;
+	size_t			i;
+
+	hash = 5381;
+	i = 0;
+	while (name[i] != '\0')
+	{
+		hash = hash * 33 + (unsigned char)name[i];
+		i++;
+	}
+	return (hash % nbuckets);
+}
+
+/**
+ * @brief Looks up an array variable by name.
+ *
+ * @param table The table of arrays (NULL while no array was declared).
+ * @param name The variable name.
+ * @return The array, or NULL if `name` is not an array.
+ */
+t_array	*find_array(t_array **table, const char *name)
+{
+	t_array	*arr;
+
+	if (table == NULL || name == NULL)
+		return (NULL);
+	arr = table[array_hash(name, ARRAY_BUCKETS)];
+	while (arr != NULL && ft_strncmp(arr->name, name, ft_strlen(name) + 1))
+		arr = arr->next;
+	return (arr);
+}
+
+/**
+ * @brief Makes `name` an array, as `declare -a` or `declare -A` does.
+ *
+ * An existing array of the same kind is returned as it is. A variable
+ * of that name becomes element 0 of the new array (key "0" for an
+ * associative one), as in bash.
+ *
+ * @param name The variable name.
+ * @param assoc Whether the array is associative.
+ * @param pd The process data holding the variables.
+ * @return The array, or NULL if `name` is an array of the other kind.
+ */
+t_array	*declare_array(const char *name, int assoc, t_process_data *pd)
+{
+	t_array		*arr;
+	t_env_var	*var;
+
+	arr = find_array(pd->arrays, name);
+	if (arr != NULL && arr->assoc != assoc)
+		return (NULL);
+	if (arr != NULL)
+		return (arr);
+	if (pd->arrays == NULL)
+		pd->arrays = ft_calloc(ARRAY_BUCKETS, sizeof(t_array *));
+	arr = ft_calloc(1, sizeof(t_array));
+	if (arr == NULL || pd->arrays == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	arr->name = ft_strdup(name);
+	if (arr->name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	arr->assoc = assoc;
+	arr->next = pd->arrays[array_hash(name, ARRAY_BUCKETS)];
+	pd->arrays[array_hash(name, ARRAY_BUCKETS)] = arr;
+	var = find_shell_var(name, pd);
+	if (var != NULL && var->value != NULL)
+		store_element(arr, "0", var->value, NULL);
+	if (var != NULL)
+		unset_shell_var(name, pd);
+	return (arr);
+}
+
+/**
+ * @brief Removes an array variable, as `unset name` does.
+ *
+ * Nothing happens if `name` is not an array.
+ *
+ * @param name The variable name.
+ * @param pd The process data holding the table of arrays.
+ */
+void	unset_array(const char *name, t_process_data *pd)
+{
+	t_array	**link;
+	t_array	*arr;
+
+	if (pd->arrays == NULL)
+		return ;
+	link = &pd->arrays[array_hash(name, ARRAY_BUCKETS)];
+	while (*link != NULL && ft_strncmp((*link)->name, name,
+			ft_strlen(name) + 1) != 0)
+		link = &(*link)->next;
+	arr = *link;
+	if (arr == NULL)
+		return ;
+	*link = arr->next;
+	clear_array(arr);
+	free(arr->name);
+	free(arr);
+}
+
+/**
+ * @brief Frees every array variable and the table holding them.
+ *
+ * @param pd The process data.
+ */
+void	free_arrays(t_process_data *pd)
+{
+	t_array	*arr;
+	t_array	*next;
+	int		i;
+
+	i = 0;
+	while (pd->arrays != NULL && i < ARRAY_BUCKETS)
+	{
+		arr = pd->arrays[i];
+		while (arr != NULL)
+		{
+			next = arr->next;
+			clear_array(arr);
+			free(arr->name);
+			free(arr);
+			arr = next;
+		}
+		i++;
+	}
+	free(pd->arrays);
+	pd->arrays = NULL;
+}
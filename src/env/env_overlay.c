@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_overlay.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 11:37:08 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the exported variables as the array given to execve().
+ *
+ * The array is built from `pd->env_list` on first use and kept until the
+ * environment changes (see invalidate_envp()), so that the commands run
+ * in between, and every stage of a pipeline, share one copy. Built in the
+ * shell before forking, it is inherited by the children as is.
+ *
+ * @param pd The process data holding the environment.
+ * @return The cached array; it belongs to `pd`.
+ */
+char	**cached_envp(t_process_data *pd)
+{
+	if (pd->envp == NULL)
+	{
+		pd->envp = env_list_to_array(pd->env_list);
+		if (pd->envp == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	}
+	return (pd->envp);
+}
+
+/**
+ * @brief Drops the cached execve() array after the environment changed.
+ *
+ * @param pd The process data holding the cache.
+ */
+void	invalidate_envp(t_process_data *pd)
+{
+	if (pd->envp == NULL)
+		return ;
+	free_split(pd->envp);
+	pd->envp = NULL;
+}
+
+/**
+ * @brief Tells whether an assignment in `words` sets the variable of
+ * `entry`, a `NAME=value` string.
+ *
+ * @param entry The environment entry.
+ * @param words The assignments, NULL-terminated.
+ * @return 1 if the variable is assigned again, 0 otherwise.
+ */
+static int	is_overridden(const char *entry, char **words)
+{
+	size_t	len;
+
+	len = ft_strchr(entry, '=') - entry + 1;
+	while (*words != NULL)
+	{
+		if (ft_strncmp(*words, entry, len) == 0)
+			return (1);
+		words++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Counts the words of a NULL-terminated array, which may be NULL.
+ */
+static size_t	count_words(char **words)
+{
+	size_t	count;
+
+	count = 0;
+	while (words != NULL && words[count] != NULL)
+		count++;
+	return (count);
+}
+
+/**
+ * @brief Builds the environment of a command run with prefix assignments,
+ * such as `LC_ALL=C sort`.
+ *
+ * The result only holds pointers: to the entries of the cached array that
+ * no assignment replaces, then to the assignment words themselves, which
+ * already read `NAME=value`. When an assignment is repeated the last one
+ * wins. Only the array is to be freed, with free().
+ *
+ * @param pd The process data holding the environment.
+ * @param prefix The assignments, or NULL.
+ * @return The array for execve().
+ */
+char	**command_envp(t_process_data *pd, char **prefix)
+{
+	char	**base;
+	char	**envp;
+	size_t	count;
+
+	base = cached_envp(pd);
+	envp = malloc(sizeof(char *)
+			* (count_words(base) + count_words(prefix) + 1));
+	if (envp == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	count = 0;
+	while (*base != NULL)
+	{
+		if (prefix == NULL || !is_overridden(*base, prefix))
+			envp[count++] = *base;
+		base++;
+	}
+	while (prefix != NULL && *prefix != NULL)
+	{
+		if (!is_overridden(*prefix, prefix + 1))
+			envp[count++] = *prefix;
+		prefix++;
+	}
+	envp[count] = NULL;
+	return (envp);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_prefix.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 11:37:08 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Takes the prefix assignments off the front of a command, as in
+ * `LC_ALL=C sort` or `TZ=UTC date`.
+ *
+ * The words are moved, not copied: the remaining words are shifted down
+ * in place, so `args` starts with the command name afterwards. A command
+ * made of assignments only is left alone; see is_assignment_only().
+ * Only plain `NAME=value` words count; array assignments cannot be
+ * passed to a command.
+ *
+ * @param args The command words, after expansion and redirections.
+ * @return The assignments, or NULL if there are none.
+ */
+char	**split_env_prefix(char **args)
+{
+	char	**prefix;
+	size_t	count;
+	size_t	len;
+
+	count = 0;
+	while (is_assignment_word(args[count]) == ASSIGN_PLAIN)
+		count++;
+	if (count == 0 || args[count] == NULL)
+		return (NULL);
+	prefix = malloc(sizeof(char *) * (count + 1));
+	if (prefix == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	ft_memcpy(prefix, args, sizeof(char *) * count);
+	prefix[count] = NULL;
+	len = count;
+	while (args[len] != NULL)
+		len++;
+	ft_memmove(args, args + count, sizeof(char *) * (len - count + 1));
+	return (prefix);
+}
+
+/**
+ * @brief Records a variable before a prefix assignment replaces it.
+ *
+ * @param word The assignment, `NAME=value`.
+ * @param pd The process data holding the variables.
+ * @return The saved variable; exits the shell on allocation failure.
+ */
+static t_saved_var	*save_var(const char *word, t_process_data *pd)
+{
+	t_saved_var	*saved;
+	t_env_var	*var;
+
+	saved = ft_calloc(1, sizeof(t_saved_var));
+	if (saved == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	saved->key = ft_substr(word, 0, ft_strchr(word, '=') - word);
+	if (saved->key == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	var = find_shell_var(saved->key, pd);
+	if (var != NULL && var->value != NULL)
+	{
+		saved->value = ft_strdup(var->value);
+		if (saved->value == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	}
+	saved->exported = (var != NULL
+			&& var == find_env_var(saved->key, pd->env_list));
+	return (saved);
+}
+
+/**
+ * @brief Sets and exports the variables of prefix assignments in the
+ * shell itself.
+ *
+ * Used where the command runs in the shell process: a builtin or a
+ * function, which see the variables as exported ones. A forked stage
+ * keeps them for good; the shell undoes them with pop_env_prefix().
+ *
+ * @param prefix The assignments, or NULL.
+ * @param pd The process data holding the variables.
+ */
+void	apply_env_prefix(char **prefix, t_process_data *pd)
+{
+	char	*key;
+	char	*equal_sign;
+
+	while (prefix != NULL && *prefix != NULL)
+	{
+		equal_sign = ft_strchr(*prefix, '=');
+		key = ft_substr(*prefix, 0, equal_sign - *prefix);
+		if (key == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		set_shell_var(key, equal_sign + 1, pd);
+		export_shell_var(key, pd);
+		free(key);
+		prefix++;
+	}
+}
+
+/**
+ * @brief Applies prefix assignments for the duration of a builtin or a
+ * function call, remembering what they replace.
+ *
+ * @param prefix The assignments, or NULL.
+ * @param pd The process data holding the variables.
+ * @return The replaced variables, last one first, for pop_env_prefix().
+ */
+t_saved_var	*push_env_prefix(char **prefix, t_process_data *pd)
+{
+	t_saved_var	*saved;
+	t_saved_var	*node;
+	char		**word;
+
+	saved = NULL;
+	word = prefix;
+	while (word != NULL && *word != NULL)
+	{
+		node = save_var(*word, pd);
+		node->next = saved;
+		saved = node;
+		word++;
+	}
+	apply_env_prefix(prefix, pd);
+	return (saved);
+}
+
+/**
+ * @brief Puts back the variables replaced by push_env_prefix(), and
+ * frees the record.
+ *
+ * A variable that was exported is updated in place, so it keeps its
+ * position in the environment.
+ *
+ * @param saved The replaced variables, last one first.
+ * @param pd The process data holding the variables.
+ */
+void	pop_env_prefix(t_saved_var *saved, t_process_data *pd)
+{
+	t_saved_var	*next;
+
+	while (saved != NULL)
+	{
+		next = saved->next;
+		if (saved->value == NULL || !saved->exported)
+			unset_shell_var(saved->key, pd);
+		if (saved->value != NULL)
+			set_shell_var(saved->key, saved->value, pd);
+		if (saved->value != NULL && saved->exported)
+			export_shell_var(saved->key, pd);
+		free(saved->key);
+		free(saved->value);
+		free(saved);
+		saved = next;
+	}
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_utils_3.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 14:21:07 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Creates an unlinked variable node holding copies of key and value.
+ *
+ * @param key The variable name.
+ * @param value The variable value.
+ * @return The new node; exits the shell on allocation failure.
+ */
+static t_env_var	*new_shell_var(const char *key, const char *value)
+{
+	t_env_var	*var;
+
+	var = malloc(sizeof(t_env_var));
+	if (var == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	var->key = ft_strdup(key);
+	var->value = ft_strdup(value);
+	if (var->key == NULL || var->value == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	var->next = NULL;
+	return (var);
+}
+
+/**
+ * @brief Replaces the value of an existing variable.
+ *
+ * @param var The variable, exported or shell-local.
+ * @param value The new value.
+ * @param pd The process data, whose cached environment is dropped if the
+ *           variable is exported.
+ */
+static void	update_shell_var(t_env_var *var, const char *value,
+		t_process_data *pd)
+{
+	char	*copy;
+
+	copy = ft_strdup(value);
+	if (copy == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	free(var->value);
+	var->value = copy;
+	if (var == find_env_var(var->key, pd->env_list))
+		invalidate_envp(pd);
+}
+
+/**
+ * @brief Assigns a value to a shell variable, creating it if needed.
+ *
+ * Used for assignments such as `NAME=value` or the variable of a `for`
+ * loop. An exported variable is updated in place; any other is set in
+ * the shell-local table, so it is not passed to child processes. For an
+ * array, element 0 is set, as in bash.
+ *
+ * @param key The variable name.
+ * @param value The new value.
+ * @param pd The process data holding the variable list.
+ */
+void	set_shell_var(const char *key, const char *value, t_process_data *pd)
+{
+	t_env_var	*var;
+	t_array		*arr;
+
+	arr = find_array(pd->arrays, key);
+	if (arr != NULL)
+	{
+		store_element(arr, "0", value, NULL);
+		return ;
+	}
+	var = find_shell_var(key, pd);
+	if (var != NULL)
+	{
+		update_shell_var(var, value, pd);
+		return ;
+	}
+	if (pd->shell_vars == NULL)
+	{
+		pd->shell_vars = new_shell_var(key, value);
+		return ;
+	}
+	var = pd->shell_vars;
+	while (var->next != NULL)
+		var = var->next;
+	var->next = new_shell_var(key, value);
+}
+
+/**
+ * @brief Removes a shell variable, exported or not, as `unset` does.
+ *
+ * @param key The variable name.
+ * @param pd The process data holding the variable list.
+ */
+void	unset_shell_var(const char *key, t_process_data *pd)
+{
+	char	*args[3];
+
+	args[0] = "unset";
+	args[1] = (char *)key;
+	args[2] = NULL;
+	run_unset(&pd->env_list, args);
+	run_unset(&pd->shell_vars, args);
+	invalidate_envp(pd);
+}
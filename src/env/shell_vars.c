@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_vars.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 09:14:36 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds a variable, exported or not.
+ *
+ * The exported variables (`pd->env_list`) are searched first, then the
+ * shell-local ones (`pd->shell_vars`); a name is never in both.
+ *
+ * @param key The variable name.
+ * @param pd The process data holding both tables.
+ * @return The variable, or NULL if it is not set.
+ */
+t_env_var	*find_shell_var(const char *key, t_process_data *pd)
+{
+	t_env_var	*var;
+
+	var = find_env_var(key, pd->env_list);
+	if (var == NULL)
+		var = find_env_var(key, pd->shell_vars);
+	return (var);
+}
+
+/**
+ * @brief Moves a shell-local variable into the exported environment, as
+ * `export NAME` does.
+ *
+ * Nothing happens if `key` is not a shell-local variable.
+ *
+ * @param key The variable name.
+ * @param pd The process data holding both tables.
+ */
+void	export_shell_var(const char *key, t_process_data *pd)
+{
+	t_env_var	**link;
+	t_env_var	*var;
+
+	link = &pd->shell_vars;
+	while (*link != NULL && ft_strncmp((*link)->key, key,
+			ft_strlen(key) + 1) != 0)
+		link = &(*link)->next;
+	var = *link;
+	if (var == NULL)
+		return ;
+	*link = var->next;
+	var->next = NULL;
+	link = &pd->env_list;
+	while (*link != NULL)
+		link = &(*link)->next;
+	*link = var;
+	invalidate_envp(pd);
+}
+
+/**
+ * @brief Checks if a word is a variable assignment.
+ *
+ * @param word The word to check.
+ * @return ASSIGN_PLAIN for `NAME=value`, ASSIGN_ARRAY for `NAME[sub]=`,
+ *         `NAME+=` or `NAME=(...)` (see run_array_assignment()), and 0 if
+ *         it is not an assignment.
+ */
+int	is_assignment_word(const char *word)
+{
+	int	i;
+
+	if (word == NULL || !(ft_isalpha(word[0]) || word[0] == '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(word[i]) || word[i] == '_')
+		i++;
+	if (word[i] == '=' && !is_compound_assignment(word))
+		return (ASSIGN_PLAIN);
+	if (word[i] == '[')
+	{
+		while (word[i] != '\0' && word[i] != ']')
+			i++;
+		if (word[i] == '\0')
+			return (0);
+		i++;
+	}
+	if (word[i] == '+')
+		i++;
+	if (word[i] == '=')
+		return (ASSIGN_ARRAY);
+	return (0);
+}
+
+/**
+ * @brief Checks if a command consists of assignments only, such as
+ * `i=0` or `a=1 b=2`. An empty command counts too.
+ *
+ * @param args The command words, after expansion and redirections.
+ * @return 1 if every word is an assignment, 0 otherwise.
+ */
+int	is_assignment_only(char **args)
+{
+	while (*args != NULL)
+	{
+		if (!is_assignment_word(*args))
+			return (0);
+		args++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Performs the assignments of an assignment-only command.
+ *
+ * A variable that is already exported stays exported; any other becomes
+ * (or stays) shell-local and is not passed to child processes. Array
+ * and append assignments go to run_array_assignment().
+ *
+ * @param args The assignments, NULL-terminated.
+ * @param pd The process data holding the variables.
+ * @return 0, or 1 if an array element could not be stored.
+ */
+int	run_assignments(char **args, t_process_data *pd)
+{
+	char	*equal_sign;
+	char	*key;
+	int		status;
+
+	status = 0;
+	while (*args != NULL)
+	{
+		if (is_assignment_word(*args) == ASSIGN_ARRAY)
+		{
+			status |= run_array_assignment(*args++, pd);
+			continue ;
+		}
+		equal_sign = ft_strchr(*args, '=');
+		key = ft_substr(*args, 0, equal_sign - *args);
+		if (key == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		set_shell_var(key, equal_sign + 1, pd);
+		free(key);
+		args++;
+	}
+	return (status);
+}
@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/08/30 19:24:59 by tiyang        #+#    #+#                 */
-/*   Updated: 2025/09/08 12:51:19 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/25 18:14:37 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -67,6 +67,7 @@ static void	cleanup_and_exit(t_execute_data *data,
 		free_split(args);
 	rl_clear_history();
 	free_env(process_data->env_list);
+	free_shell_state(process_data);
 	exit(code);
 }
 
@@ -85,52 +86,67 @@ static void	cleanup_and_exit(t_execute_data *data,
 int	handle_exit_builtin(t_execute_data *data, t_process_data *process_data,
 								char **args)
 {
-	int			saved_stdin;
-	int			saved_stdout;
-	int			did_save;
 	int			exit_code;
 	long long	code;
 
-	saved_stdin = -1;
-	saved_stdout = -1;
-	did_save = 0;
-	if (setup_builtin_io(data, &saved_stdin, &saved_stdout, &did_save) != 0)
+	if (setup_builtin_io(data) != 0)
+	{
+		restore_builtin_io(data);
 		return (free_execute_data(data), process_data->last_exit_status = 1, 1);
+	}
 	ft_putstr_fd("exit\n", STDOUT_FILENO);
 	exit_code = get_exit_code(data, process_data);
 	if (data->clean_args[1] && ft_str_to_llong(data->clean_args[1], &code)
 		&& data->clean_args[2])
 	{
-		restore_builtin_io(did_save, saved_stdin, saved_stdout);
+		restore_builtin_io(data);
 		free_execute_data(data);
 		process_data->last_exit_status = 1;
 		return (1);
 	}
-	restore_builtin_io(did_save, saved_stdin, saved_stdout);
+	restore_builtin_io(data);
 	cleanup_and_exit(data, process_data, args, exit_code);
 	return (0);
 }
 
 /**
- * @brief Executes a command, determining if it's a built-in or external program.
+ * @brief Executes a command, determining if it's a function, a built-in or
+ *        an external program.
  *
  * This function acts as a dispatcher, calling the correct execution function
- * based on whether the command name is a known built-in.
+ * based on whether the command name is a defined function or a known
+ * built-in. `exit` is handled on its own, and functions are looked up
+ * first, with a single hash probe. A command made of assignments only
+ * sets shell variables. Prefix
+ * assignments hold for the duration of a function or a builtin, which run
+ * in the shell; an external command gets them in its environment only.
  *
  * @param data The execution data structure.
  * @param process_data The process data, used to set the last exit status.
- * @param env_list The environment variable list.
+ * @param args The original command arguments, freed by `exit`.
  * @return The exit status of the executed command.
  */
 static int	execute_builtin_or_external(t_execute_data *data,
-							t_process_data *process_data, t_env_var *env_list)
+							t_process_data *process_data, char **args)
 {
-	int	exit_status;
+	int			exit_status;
+	t_function	*fn;
+	t_saved_var	*saved;
 
-	if (is_builtin(data->clean_args[0]))
-		exit_status = execute_builtin_command(data, process_data);
+	if (ft_strncmp(data->clean_args[0], "exit", 5) == 0)
+		return (handle_exit_builtin(data, process_data, args));
+	if (is_assignment_only(data->clean_args))
+		return (execute_assignments(data, process_data));
+	fn = find_function(process_data, data->clean_args[0]);
+	if (fn == NULL && !is_builtin(data->clean_args))
+		return (execute_external_command(data, process_data,
+				data->env_list));
+	saved = push_env_prefix(data->env_prefix, process_data);
+	if (fn != NULL)
+		exit_status = execute_function_command(fn, data, process_data);
 	else
-		exit_status = execute_external_command(data, process_data, env_list);
+		exit_status = execute_builtin_command(data, process_data);
+	pop_env_prefix(saved, process_data);
 	return (exit_status);
 }
 
@@ -139,8 +155,9 @@ static int	execute_builtin_or_external(t_execute_data *data,
  *
  * This is the main orchestrator function. It handles argument
  * cleanup and redirection, then dispatches the command to the
- * appropriate handler (either the built-in
- * exit command or a generic built-in/external executor).
+ * appropriate handler (see execute_builtin_or_external()). The run is
+ * recorded in the per-command statistics once it is over, with every
+ * assignment-only command under the one name `(assignment)`.
  *
  * @param args The original command arguments.
  * @param env_list The environment variable list.
@@ -151,8 +168,11 @@ int	execute_single_command(char **args, t_env_var *env_list,
 								t_process_data *process_data)
 {
 	t_execute_data	data;
+	t_stats_mark	mark;
+	char			name[STATS_NAME_MAX];
 	int				exit_status;
 
+	stats_begin(process_data, &mark);
 	ft_bzero(&data, sizeof(t_execute_data));
 	data.env_list = env_list;
 	process_data->in_pipeline = 0;
@@ -161,12 +181,13 @@ int	execute_single_command(char **args, t_env_var *env_list,
 		return (handle_redirection_error(&data, process_data, args));
 	if (!data.clean_args[0])
 		return (handle_redirection_only(&data, process_data));
-	if (ft_strncmp(data.clean_args[0], "exit", 5) == 0)
-		exit_status = handle_exit_builtin(&data, process_data, args);
-	else
-		exit_status = execute_builtin_or_external(&data,
-				process_data, env_list);
+	data.env_prefix = split_env_prefix(data.clean_args);
+	ft_strlcpy(name, data.clean_args[0], STATS_NAME_MAX);
+	if (is_assignment_only(data.clean_args))
+		ft_strlcpy(name, "(assignment)", STATS_NAME_MAX);
+	exit_status = execute_builtin_or_external(&data, process_data, args);
 	process_data->last_exit_status = exit_status;
+	stats_end(process_data, &mark, name, exit_status);
 	free_execute_data(&data);
 	return (exit_status);
 }
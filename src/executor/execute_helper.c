@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/08 10:33:29 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 10:41:48 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:10:41 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,8 +15,8 @@
 /**
  * @brief Executes an external command by finding its full path and running it.
  *
- * This function retrieves the PATH directories 
- * from the environment variable list,
+ * This function retrieves the PATH directories from a `PATH=` prefix
+ * assignment of the command, or else from the environment variable list,
  * finds the full path of the command, and then executes it using the prepared
  * command execution function.
  *
@@ -31,7 +31,10 @@ int	execute_external_command(t_execute_data *data, t_process_data *process_data,
 	char	**path_dirs;
 	int		exit_status;
 
-	path_dirs = find_path_dirs(env_list);
+	trace_mark(process_data->trace, TRACE_PATH);
+	path_dirs = prefix_path_dirs(data->env_prefix);
+	if (path_dirs == NULL)
+		path_dirs = find_path_dirs(env_list);
 	data->cmd_path = find_full_cmd_path(data->clean_args[0], path_dirs);
 	if (data->cmd_path == NULL)
 	{
@@ -49,34 +52,47 @@ int	execute_external_command(t_execute_data *data, t_process_data *process_data,
 /**
  * @brief Handles cases where only redirection is specified without a command.
  *
- * This function checks if the input file can be opened for reading and
- * sets the last exit status accordingly. It frees the execute data structure
- * before returning.
+ * The redirections are applied and undone right away, as for a builtin
+ * that does nothing, so that a target left unopened by
+ * handle_redirection() (a FIFO) is opened and a bad descriptor in `>&N`
+ * is reported. The last exit status is set accordingly. It frees the
+ * execute data structure before returning.
  *
  * @param data Pointer to the execute data structure containing command info.
  * @param process_data Pointer to the global process data structure.
- * @return 0 if successful, or 1 if there was an error opening the input file.
+ * @return 0 if successful, or 1 if a redirection failed.
  */
 int	handle_redirection_only(t_execute_data *data, t_process_data *process_data)
 {
 	int	exit_status;
-	int	fd;
 
-	exit_status = 0;
-	if (data->input_file)
-	{
-		fd = open(data->input_file, O_RDONLY);
-		if (fd == -1)
-		{
-			ft_error(data->input_file, strerror(errno));
-			exit_status = 1;
-		}
-		else
-		{
-			close(fd);
-		}
-	}
+	if (fd_ops_redirect(data->fd_ops, STDIN_FILENO))
+		sync_read_buffer(process_data);
+	exit_status = setup_builtin_io(data);
+	restore_builtin_io(data);
 	process_data->last_exit_status = exit_status;
 	free_execute_data(data);
 	return (exit_status);
 }
+
+/**
+ * @brief Runs a command made of assignments only, such as `i=0`.
+ *
+ * Its redirections are applied and undone first, as for
+ * handle_redirection_only(); the assignments are made only if they
+ * succeed.
+ *
+ * @param data The execute data, with the assignments as clean_args.
+ * @param process_data Pointer to the global process data structure.
+ * @return 0 on success, or 1 if a redirection failed.
+ */
+int	execute_assignments(t_execute_data *data, t_process_data *process_data)
+{
+	int	exit_status;
+
+	exit_status = setup_builtin_io(data);
+	restore_builtin_io(data);
+	if (exit_status == 0)
+		exit_status = run_assignments(data->clean_args, process_data);
+	return (exit_status);
+}
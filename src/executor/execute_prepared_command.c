@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/30 16:54:16 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/09 12:43:15 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -52,16 +52,16 @@ static void	execute_child_process(t_execute_data *data,
 
 	signal(SIGINT, SIG_DFL);
 	get_next_line_cleanup();
-	redirect_io(data->input_file, data->output_file,
-		data->output_mode);
-	if (is_builtin(data->clean_args[0]))
+	redirect_io(data->fd_ops);
+	if (is_builtin(data->clean_args))
 	{
 		exit_code = run_builtin(data->clean_args, process_data);
 		free_execute_data(data);
 		exit(exit_code);
 	}
+	trace_exec(process_data->trace);
 	execute_cmd(data->cmd_path, data->clean_args,
-		data->path_dirs, data->env_list);
+		command_envp(process_data, data->env_prefix));
 	if (process_data->last_exit_status != 0)
 	{
 		exit_code = process_data->last_exit_status;
@@ -87,9 +87,14 @@ static void	execute_child_process(t_execute_data *data,
 static int	handle_parent_process(pid_t pid, t_execute_data *data,
 	t_process_data *process_data)
 {
-	int	exit_code;
+	struct rusage	ru;
+	int				exit_code;
 
-	exit_code = wait_for_child_and_handle_status(pid);
+	trace_mark(process_data->trace, TRACE_WAIT);
+	exit_code = wait_for_child_and_handle_status(pid, &ru);
+	if (process_data->timing != NULL && exit_code != -1)
+		record_child_usage(process_data->timing, data->clean_args,
+			exit_code, &ru);
 	free_execute_data(data);
 	setup_signal_handlers();
 	process_data->last_exit_status = exit_code;
@@ -98,7 +103,12 @@ static int	handle_parent_process(pid_t pid, t_execute_data *data,
 
 /**
  * @brief Forks a new process to execute the command.
- * Handles errors during forking and ensures proper cleanup.
+ * Handles errors during forking and ensures proper cleanup. Input read
+ * ahead by `read` is handed back first, so the child starts reading where
+ * `read` stopped. The execve() environment is built beforehand, if it is
+ * not cached already, so the next command can reuse it. The redirection
+ * targets belong to the child once it is forked, so the parent closes its
+ * copies right away.
  * @param data Pointer to the execution data.
  * @param process_data Pointer to the process data.
  * @return The exit code of the command, or -1 on fork failure.
@@ -108,6 +118,10 @@ static int	fork_and_execute(t_execute_data *data, t_process_data *process_data)
 	pid_t	pid;
 
 	signal(SIGINT, SIG_IGN);
+	sync_read_buffer(process_data);
+	cached_envp(process_data);
+	trace_mark(process_data->trace, TRACE_FORK);
+	stats_fork(process_data->stats, 1);
 	pid = fork();
 	if (pid < 0)
 	{
@@ -117,8 +131,10 @@ static int	fork_and_execute(t_execute_data *data, t_process_data *process_data)
 	}
 	else if (pid == 0)
 	{
+		trace_child(process_data->trace);
 		execute_child_process(data, process_data);
 	}
+	close_redirect_plan(data->fd_ops);
 	return (handle_parent_process(pid, data, process_data));
 }
 
@@ -132,10 +148,7 @@ static int	fork_and_execute(t_execute_data *data, t_process_data *process_data)
  */
 int	execute_prepared_command(t_execute_data *data, t_process_data *process_data)
 {
-	int	has_redirection;
-
-	has_redirection = (data->input_file || data->output_file);
-	if (is_builtin(data->clean_args[0]) && !has_redirection
+	if (is_builtin(data->clean_args) && data->fd_ops == NULL
 		&& !process_data->in_pipeline)
 		return (execute_builtin_in_parent(data, process_data));
 	return (fork_and_execute(data, process_data));
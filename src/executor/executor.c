@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/04 13:55:56 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 13:40:52 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/20 20:13:05 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -129,6 +129,7 @@ int	handle_pipeline_command(char *line, t_env_var *env_list,
 		return (handle_null_pipeline_error(process_data));
 	}
 	process_data->path_dirs = find_path_dirs(env_list);
+	optimize_pipeline(process_data);
 	status = run_command_pipeline(process_data);
 	cleanup_pipeline_resources(process_data);
 	process_data->last_exit_status = status;
@@ -152,6 +153,7 @@ int	handle_pipeline_command(char *line, t_env_var *env_list,
 int	execute_command(char *line, t_env_var *env_list,
 	t_process_data *process_data)
 {
+	trace_mark(process_data->trace, TRACE_PRECHECK);
 	if (!check_heredoc_limit(line))
 		return (2);
 	if (is_unquoted_pipe_present(line))
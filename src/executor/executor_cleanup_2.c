@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/09 12:55:21 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 13:21:07 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -41,9 +41,9 @@ static void	cleanup_command_pipeline_data(t_process_data *data)
 /**
  * @brief Cleans up shell environment data from the process data structure.
  *
- * This function frees the `path_dirs` array and the `env_list` linked list
- * associated with the shell environment. It sets the pointers to NULL after
- * freeing to avoid dangling references.
+ * This function frees the `path_dirs` array, the `env_list` linked list
+ * and the rest of the per-shell state (see free_shell_state()). It sets
+ * the pointers to NULL after freeing to avoid dangling references.
  *
  * @param data A pointer to the process data structure.
  */
@@ -59,6 +59,7 @@ static void	cleanup_shell_environment_data(t_process_data *data)
 		free_env(data->env_list);
 		data->env_list = NULL;
 	}
+	free_shell_state(data);
 }
 
 /**
@@ -81,13 +82,15 @@ void	cleanup_child_pipeline_resources(t_process_data *data)
 
 /**
  * @brief Free both args and envp if present.
+ *
+ * The entries of envp belong to the environment cache (see
+ * command_envp()); only the array is freed.
  */
 void	free_args_env(char **args, char **envp)
 {
 	if (args)
 		free_split(args);
-	if (envp)
-		free_split(envp);
+	free(envp);
 }
 
 /**
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 09:34:52 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 10:51:50 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:10:41 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -106,3 +106,32 @@ char	**find_path_dirs(t_env_var *env_list)
 	}
 	return (NULL);
 }
+
+/**
+ * @brief Retrieves the directories of a PATH given as a prefix assignment
+ * (`PATH=dir cmd`), which is the one searched for that command.
+ *
+ * @param prefix The command's prefix assignments, or NULL.
+ * @return The directories of the last `PATH=` among them, or NULL if
+ *         there is none.
+ */
+char	**prefix_path_dirs(char **prefix)
+{
+	char	**dirs;
+	int		i;
+
+	i = 0;
+	while (prefix != NULL && prefix[i] != NULL)
+		i++;
+	while (--i >= 0)
+	{
+		if (ft_strncmp(prefix[i], "PATH=", 5) == 0)
+		{
+			dirs = ft_split(prefix[i] + 5, ':');
+			if (dirs == NULL)
+				ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+			return (dirs);
+		}
+	}
+	return (NULL);
+}
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/01 19:51:29 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/08 10:50:08 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 14:20:13 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -35,7 +35,7 @@ static void	update_quote_state(char c, char *q)
  * starting at a given index.
  *
  * This function checks for single and double redirection operators ('<', '<<',
- * '<<<', '>', '>>') and returns their length.
+ * '<<<', '<>', '<&', '>', '>>', '>&') and returns their length.
  *
  * @param line The command line string.
  * @param i The index to check for a redirection operator.
@@ -47,12 +47,12 @@ static int	get_redir_op_len(const char *line, int i)
 	{
 		if (line[i + 1] == '<' && line[i + 2] == '<')
 			return (3);
-		if (line[i + 1] == '>' || line[i + 1] == '<')
+		if (line[i + 1] == '>' || line[i + 1] == '<' || line[i + 1] == '&')
 			return (2);
 	}
 	else if (line[i] == '>')
 	{
-		if (line[i + 1] == '>')
+		if (line[i + 1] == '>' || line[i + 1] == '&')
 			return (2);
 	}
 	return (1);
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/30 16:25:35 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/08 11:35:55 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/20 17:46:31 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -69,7 +69,7 @@ static int	handle_redirections(t_execute_data *data,
  */
 static int	find_command_path(t_env_var *env_list, t_execute_data *data)
 {
-	if (is_builtin(data->clean_args[0]))
+	if (is_builtin(data->clean_args))
 	{
 		data->cmd_path = NULL;
 		data->path_dirs = find_path_dirs(env_list);
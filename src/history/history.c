@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 10:14:36 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Reads a line limit such as HISTSIZE.
+ *
+ * @param pd The process data holding the variables.
+ * @param name The variable.
+ * @param fallback The limit if the variable is unset or not a number.
+ * @return The limit.
+ */
+static int	history_limit(t_process_data *pd, const char *name, int fallback)
+{
+	t_env_var	*var;
+	int			i;
+
+	var = find_shell_var(name, pd);
+	if (var == NULL || var->value == NULL || var->value[0] == '\0')
+		return (fallback);
+	i = 0;
+	while (ft_isdigit(var->value[i]))
+		i++;
+	if (var->value[i] != '\0' || i > 9)
+		return (fallback);
+	return (ft_atoi(var->value));
+}
+
+/**
+ * @brief Finds the history file: HISTFILE, or HISTORY_FILE in HOME.
+ *
+ * @param pd The process data holding the variables.
+ * @return The path, or NULL if HISTFILE is empty or there is no HOME.
+ */
+static char	*history_path(t_process_data *pd)
+{
+	t_env_var	*var;
+	char		*path;
+
+	var = find_shell_var("HISTFILE", pd);
+	if (var == NULL || var->value == NULL)
+	{
+		var = find_shell_var("HOME", pd);
+		if (var == NULL || var->value == NULL || var->value[0] == '\0')
+			return (NULL);
+		path = ft_strjoin(var->value, "/" HISTORY_FILE);
+	}
+	else if (var->value[0] == '\0')
+		return (NULL);
+	else
+		path = ft_strdup(var->value);
+	if (path == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (path);
+}
+
+/**
+ * @brief Sets up the persistent history of an interactive shell.
+ *
+ * Only the file is opened here, on a descriptor out of the script's way
+ * (see move_to_high_fd()); it is read once the first prompt is shown
+ * (see history_pre_input()). Without a file, as when HISTFILE is
+ * empty, the history is kept in memory only. Ctrl-R is bound to the
+ * indexed search of history_search_key().
+ *
+ * @param pd The process data receiving the history.
+ */
+void	history_init(t_process_data *pd)
+{
+	t_history	*hist;
+	char		*path;
+
+	path = history_path(pd);
+	hist = ft_calloc(1, sizeof(t_history));
+	if (hist == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	hist->path = path;
+	hist->owner = getpid();
+	hist->size = history_limit(pd, "HISTSIZE", HISTORY_DEFAULT_SIZE);
+	hist->file_size = history_limit(pd, "HISTFILESIZE", hist->size);
+	hist->index.limit = hist->size;
+	hist->fd = -1;
+	if (path != NULL)
+		hist->fd = move_to_high_fd(open(path, O_WRONLY | O_CREAT | O_APPEND
+					| O_CLOEXEC, 0600));
+	stifle_history(hist->size);
+	pd->history = hist;
+	*history_slot() = hist;
+	rl_pre_input_hook = history_pre_input;
+	rl_bind_keyseq("\\C-r", history_search_key);
+}
+
+/**
+ * @brief Writes the lines still queued and frees the history.
+ *
+ * Only the shell itself writes them; a forked child just drops its copy.
+ *
+ * @param pd The process data holding the history.
+ */
+void	free_history(t_process_data *pd)
+{
+	t_history	*hist;
+
+	hist = pd->history;
+	if (hist == NULL)
+		return ;
+	if (hist->owner == getpid())
+		history_flush(hist);
+	if (hist->fd >= 0)
+		close(hist->fd);
+	free(hist->path);
+	free(hist->buf);
+	free_index(&hist->index);
+	free(hist);
+	pd->history = NULL;
+	*history_slot() = NULL;
+	rl_pre_input_hook = NULL;
+}
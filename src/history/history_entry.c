@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_entry.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 17:12:50 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:12:50 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Writes a history entry as it is stored in the history file.
+ *
+ * An entry can span several lines (a compound command typed over several
+ * prompts), and the file holds one line per line of it: each line but
+ * the last ends with a backslash, which history_decode_line() removes.
+ * So that a backslash the entry itself ends a line with is not taken for
+ * that mark, every run of backslashes at the end of a line is doubled.
+ *
+ * @param dst Where to write; room for twice the entry plus one byte.
+ * @param line The entry.
+ * @return The number of bytes written, the final newline included.
+ */
+size_t	history_encode(char *dst, const char *line)
+{
+	size_t	n;
+	size_t	run;
+	size_t	count;
+
+	n = 0;
+	while (1)
+	{
+		run = 0;
+		while (line[run] == '\\')
+			run++;
+		count = run;
+		if (line[run] == '\n' || line[run] == '\0')
+			count = 2 * run;
+		ft_memset(dst + n, '\\', count);
+		n += count;
+		line += run;
+		if (*line == '\0')
+			break ;
+		if (*line == '\n')
+			dst[n++] = '\\';
+		dst[n++] = *line++;
+	}
+	dst[n++] = '\n';
+	return (n);
+}
+
+/**
+ * @brief Decodes one line of the history file; see history_encode().
+ *
+ * @param dst Where to write; room for `len` + 1 bytes.
+ * @param src The line, without its newline.
+ * @param len Its length.
+ * @param more Set if the entry goes on on the next line.
+ * @return The number of bytes written.
+ */
+size_t	history_decode_line(char *dst, const char *src, size_t len, int *more)
+{
+	size_t	run;
+
+	run = 0;
+	while (run < len && src[len - 1 - run] == '\\')
+		run++;
+	ft_memcpy(dst, src, len - run);
+	ft_memset(dst + len - run, '\\', run / 2);
+	*more = run % 2;
+	if (*more)
+		dst[len - run + run / 2] = '\n';
+	return (len - run + run / 2 + *more);
+}
+
+/**
+ * @brief Tells whether the line of the history file that ends at `end`
+ * goes on on the next line, i.e. ends with an odd run of backslashes.
+ *
+ * @param map The file contents.
+ * @param end The offset of the line's newline.
+ * @return 1 if the next line belongs to the same entry, 0 otherwise.
+ */
+int	history_continued(const char *map, size_t end)
+{
+	size_t	run;
+
+	run = 0;
+	while (run < end && map[end - 1 - run] == '\\')
+		run++;
+	return (run % 2);
+}
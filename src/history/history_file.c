@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_file.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 10:14:36 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Makes room for `n` more bytes in the queue of a history.
+ *
+ * The queue doubles when full.
+ *
+ * @param hist The history.
+ * @param n The number of bytes.
+ */
+static void	history_reserve(t_history *hist, size_t n)
+{
+	char	*grown;
+
+	if (hist->len + n <= hist->cap)
+		return ;
+	if (hist->cap == 0)
+		hist->cap = 256;
+	while (hist->len + n > hist->cap)
+		hist->cap *= 2;
+	grown = malloc(hist->cap);
+	if (grown == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (hist->buf != NULL)
+		ft_memcpy(grown, hist->buf, hist->len);
+	free(hist->buf);
+	hist->buf = grown;
+}
+
+/**
+ * @brief Adds an accepted line to the history and its index, and
+ * queues it for the history file, encoded by history_encode() so that a
+ * line holding newlines is loaded back as one entry.
+ *
+ * @param pd The process data holding the history.
+ * @param line The line, as typed.
+ */
+void	history_add(t_process_data *pd, const char *line)
+{
+	t_history	*hist;
+	size_t		n;
+
+	add_history(line);
+	hist = pd->history;
+	if (hist == NULL)
+		return ;
+	index_add(&hist->index, line);
+	if (hist->fd < 0 || hist->file_size == 0)
+		return ;
+	n = 2 * ft_strlen(line) + 1;
+	history_reserve(hist, n);
+	hist->len += history_encode(hist->buf + hist->len, line);
+}
+
+/**
+ * @brief Appends the queued lines to the history file in one write().
+ *
+ * The file is opened with O_APPEND, so lines written at the same time by
+ * another shell end up after or before these, never over them. A trim by
+ * another shell replaces the file, though (see history_trim()), so the
+ * descriptor is reopened first if it no longer refers to the file at
+ * `path`; otherwise the lines would go to the unlinked old file.
+ *
+ * @param hist The history.
+ */
+void	history_flush(t_history *hist)
+{
+	struct stat	fd_st;
+	struct stat	path_st;
+
+	if (hist->len > 0 && hist->fd >= 0 && fstat(hist->fd, &fd_st) == 0
+		&& (fd_st.st_nlink == 0 || stat(hist->path, &path_st) != 0
+			|| fd_st.st_ino != path_st.st_ino
+			|| fd_st.st_dev != path_st.st_dev))
+	{
+		close(hist->fd);
+		hist->fd = move_to_high_fd(open(hist->path, O_WRONLY | O_CREAT
+					| O_APPEND | O_CLOEXEC, 0600));
+	}
+	if (hist->len > 0 && hist->fd >= 0)
+		(void)write_all(hist->fd, hist->buf, hist->len);
+	hist->len = 0;
+}
+
+/**
+ * @brief Finds where the last entries of a history file begin.
+ *
+ * The file is searched backwards from its end, so the cost depends on
+ * the entries wanted, not on the size of the file. An entry of several
+ * lines counts once.
+ *
+ * @param map The file contents.
+ * @param len The size of the file.
+ * @param lines The number of entries wanted.
+ * @return The offset of the first of them, 0 if the file has no more.
+ */
+size_t	history_tail(const char *map, size_t len, int lines)
+{
+	const char	*nl;
+	size_t		end;
+
+	if (lines <= 0)
+		return (len);
+	end = len;
+	if (end > 0 && map[end - 1] == '\n')
+		end--;
+	while (lines > 0)
+	{
+		nl = memrchr(map, '\n', end);
+		if (nl == NULL)
+			return (0);
+		end = nl - map;
+		if (!history_continued(map, end))
+			lines--;
+	}
+	return (end + 1);
+}
+
+/**
+ * @brief Replaces the history file with its last lines.
+ *
+ * The lines are written to a temporary file that is then renamed over
+ * the history file, so an interrupted trim loses nothing. The append
+ * descriptor is reopened on the new file, and other shells reopen theirs
+ * at their next flush (see history_flush()). Lines another shell appends
+ * between the mapping of the file and the rename are lost with the old
+ * file.
+ *
+ * @param hist The history.
+ * @param map The contents of the history file.
+ * @param start The offset of the first line to keep.
+ * @param len The size of the file.
+ */
+void	history_trim(t_history *hist, const char *map, size_t start,
+			size_t len)
+{
+	char	*tmp;
+	int		fd;
+	int		ok;
+
+	tmp = ft_strjoin(hist->path, ".tmp");
+	if (tmp == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+	ok = (fd >= 0 && write_all(fd, map + start, len - start) == 0);
+	if (fd >= 0)
+		close(fd);
+	if (ok && rename(tmp, hist->path) == 0)
+	{
+		if (hist->fd >= 0)
+			close(hist->fd);
+		hist->fd = move_to_high_fd(open(hist->path, O_WRONLY | O_CREAT
+					| O_APPEND | O_CLOEXEC, 0600));
+	}
+	else
+		unlink(tmp);
+	free(tmp);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_index.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 17:26:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 11:17:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Packs the `n` bytes at `s` (1 to 3) into a gram.
+ *
+ * The length is kept in the top byte, so grams of different lengths never
+ * collide.
+ */
+unsigned int	index_gram(const char *s, int n)
+{
+	unsigned int	gram;
+	int				i;
+
+	gram = (unsigned int)n << 24;
+	i = 0;
+	while (i < n)
+	{
+		gram |= (unsigned int)(unsigned char)s[i] << (8 * (n - 1 - i));
+		i++;
+	}
+	return (gram);
+}
+
+/**
+ * @brief Finds the entries listed under a gram.
+ *
+ * @param idx The index.
+ * @param gram The gram.
+ * @return Its postings, or NULL if no entry contains it.
+ */
+t_postings	*find_postings(t_hindex *idx, unsigned int gram)
+{
+	t_postings	*p;
+
+	if (idx->buckets == NULL)
+		return (NULL);
+	p = idx->buckets[(gram * 2654435761u >> 16) % HINDEX_BUCKETS];
+	while (p != NULL && p->gram != gram)
+		p = p->next;
+	return (p);
+}
+
+/**
+ * @brief Lists entry `id` under a gram, unless it already is.
+ *
+ * Entries are added in increasing order, so a duplicate can only be the
+ * last one listed.
+ *
+ * @param idx The index.
+ * @param gram The gram.
+ * @param id The entry.
+ */
+static void	post_id(t_hindex *idx, unsigned int gram, int id)
+{
+	t_postings	*p;
+	t_postings	**bucket;
+
+	p = find_postings(idx, gram);
+	if (p == NULL)
+	{
+		p = ft_calloc(1, sizeof(t_postings));
+		if (p == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		bucket = &idx->buckets[(gram * 2654435761u >> 16) % HINDEX_BUCKETS];
+		p->gram = gram;
+		p->next = *bucket;
+		*bucket = p;
+	}
+	if (p->len > 0 && p->ids[p->len - 1] == id)
+		return ;
+	if (p->len == p->cap)
+	{
+		p->cap = p->cap * 2 + 4;
+		p->ids = realloc(p->ids, p->cap * sizeof(int));
+		if (p->ids == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	}
+	p->ids[p->len++] = id;
+}
+
+/**
+ * @brief Lists an entry under every gram of one to three bytes it
+ * contains.
+ *
+ * @param idx The index.
+ * @param id The entry, already stored in `lines`.
+ */
+static void	index_entry(t_hindex *idx, int id)
+{
+	const char	*line;
+	size_t		i;
+
+	line = idx->lines[id - idx->base];
+	i = 0;
+	while (line[i] != '\0')
+	{
+		post_id(idx, index_gram(line + i, 1), id);
+		if (line[i + 1] != '\0')
+			post_id(idx, index_gram(line + i, 2), id);
+		if (line[i + 1] != '\0' && line[i + 2] != '\0')
+			post_id(idx, index_gram(line + i, 3), id);
+		i++;
+	}
+}
+
+/**
+ * @brief Adds a history entry to the index.
+ *
+ * Called for each line given to add_history(), those of the history file
+ * included, so the index is built with the deferred load and then follows
+ * the history without ever being rebuilt.
+ *
+ * @param idx The index.
+ * @param line The entry.
+ */
+void	index_add(t_hindex *idx, const char *line)
+{
+	if (idx->limit <= 0)
+		return ;
+	if (idx->buckets == NULL)
+		idx->buckets = ft_calloc(HINDEX_BUCKETS, sizeof(t_postings *));
+	if (idx->count == idx->cap)
+	{
+		idx->cap = idx->cap * 2 + 64;
+		idx->lines = realloc(idx->lines, idx->cap * sizeof(char *));
+	}
+	if (idx->lines == NULL || idx->buckets == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	idx->lines[idx->count] = ft_strdup(line);
+	if (idx->lines[idx->count] == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	idx->count++;
+	index_entry(idx, idx->base + idx->count - 1);
+	if (idx->count >= 2 * (long)idx->limit)
+		index_trim(idx);
+}
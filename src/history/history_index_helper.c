@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_index_helper.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 17:26:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 11:17:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Frees every gram list of an index, keeping its buckets.
+ *
+ * @param idx The index.
+ */
+static void	free_postings(t_hindex *idx)
+{
+	t_postings	*p;
+	t_postings	*next;
+	int			i;
+
+	i = 0;
+	while (idx->buckets != NULL && i < HINDEX_BUCKETS)
+	{
+		p = idx->buckets[i];
+		while (p != NULL)
+		{
+			next = p->next;
+			free(p->ids);
+			free(p);
+			p = next;
+		}
+		idx->buckets[i] = NULL;
+		i++;
+	}
+}
+
+/**
+ * @brief Drops the entries before `base` from a gram list.
+ *
+ * The list is in increasing order, so they are all at its front.
+ *
+ * @param p The list.
+ * @param base The first entry kept.
+ * @return The number of entries left.
+ */
+static int	drop_postings_before(t_postings *p, int base)
+{
+	int	drop;
+
+	drop = 0;
+	while (drop < p->len && p->ids[drop] < base)
+		drop++;
+	p->len -= drop;
+	ft_memmove(p->ids, p->ids + drop, p->len * sizeof(int));
+	return (p->len);
+}
+
+/**
+ * @brief Drops the entries before `base` from every gram list, and the
+ * lists left empty.
+ *
+ * @param idx The index.
+ */
+static void	prune_postings(t_hindex *idx)
+{
+	t_postings	**link;
+	t_postings	*p;
+	int			i;
+
+	i = 0;
+	while (idx->buckets != NULL && i < HINDEX_BUCKETS)
+	{
+		link = &idx->buckets[i++];
+		while (*link != NULL)
+		{
+			p = *link;
+			if (drop_postings_before(p, idx->base) > 0)
+			{
+				link = &p->next;
+				continue ;
+			}
+			*link = p->next;
+			free(p->ids);
+			free(p);
+		}
+	}
+}
+
+/**
+ * @brief Drops all but the newest `limit` entries.
+ *
+ * Entries keep their numbers, so the gram lists only lose their front
+ * instead of being built again. This happens only after another `limit`
+ * entries have been added, so each entry costs a constant amount of
+ * pruning.
+ *
+ * @param idx The index.
+ */
+void	index_trim(t_hindex *idx)
+{
+	int	drop;
+	int	i;
+
+	drop = idx->count - idx->limit;
+	if (drop <= 0)
+		return ;
+	i = 0;
+	while (i < drop)
+		free(idx->lines[i++]);
+	ft_memmove(idx->lines, idx->lines + drop, idx->limit * sizeof(char *));
+	idx->base += drop;
+	idx->count = idx->limit;
+	prune_postings(idx);
+}
+
+/**
+ * @brief Frees the entries and the gram lists of an index.
+ *
+ * @param idx The index.
+ */
+void	free_index(t_hindex *idx)
+{
+	int	i;
+
+	free_postings(idx);
+	free(idx->buckets);
+	i = 0;
+	while (i < idx->count)
+		free(idx->lines[i++]);
+	free(idx->lines);
+	ft_bzero(idx, sizeof(t_hindex));
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_load.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 10:14:36 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:12:50 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <sys/mman.h>
+
+/**
+ * @brief Holds the history for readline's hooks, which take no argument.
+ *
+ * @return The slot, set by history_init() and cleared by free_history().
+ */
+t_history	**history_slot(void)
+{
+	static t_history	*hist;
+
+	return (&hist);
+}
+
+/**
+ * @brief Adds an entry of the history file to readline's history and to
+ * the history index; an empty one is skipped.
+ *
+ * @param hist The history.
+ * @param entry The decoded entry, `n` bytes long; terminated here.
+ * @param n Its length.
+ */
+static void	add_loaded_entry(t_history *hist, char *entry, size_t n)
+{
+	if (n == 0)
+		return ;
+	entry[n] = '\0';
+	add_history(entry);
+	index_add(&hist->index, entry);
+}
+
+/**
+ * @brief Adds the entries of a mapped history file to readline's history
+ * and to the history index.
+ *
+ * The mapping is not NUL-terminated, so each line is copied by length,
+ * decoded (see history_encode()) into one buffer that holds an entry of
+ * as many lines as it takes.
+ *
+ * @param hist The history.
+ * @param map The file contents.
+ * @param start The offset of the first line to add.
+ * @param len The size of the file.
+ */
+static void	load_lines(t_history *hist, const char *map, size_t start,
+			size_t len)
+{
+	const char	*nl;
+	char		*entry;
+	size_t		n;
+	int			more;
+
+	entry = malloc(len - start + 1);
+	if (entry == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	n = 0;
+	while (start < len)
+	{
+		nl = memchr(map + start, '\n', len - start);
+		if (nl == NULL)
+			nl = map + len;
+		n += history_decode_line(entry + n, map + start, nl - (map + start),
+				&more);
+		start = nl - map + 1;
+		if (more && start < len)
+			continue ;
+		add_loaded_entry(hist, entry, n);
+		n = 0;
+	}
+	free(entry);
+}
+
+/**
+ * @brief Loads the last HISTSIZE lines of the history file, and trims the
+ * file if it has grown to twice HISTFILESIZE lines.
+ *
+ * The file is mapped rather than read, and only its tail is looked at,
+ * so a long history costs no more to load than a short one. Readline has
+ * already set up its history position for this prompt, so it is moved to
+ * the end of the lines just loaded.
+ *
+ * @param hist The history.
+ */
+static void	load_history_file(t_history *hist)
+{
+	struct stat	st;
+	char		*map;
+	size_t		start;
+	int			fd;
+
+	if (hist->path == NULL)
+		return ;
+	fd = open(hist->path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return ;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+		return ((void)close(fd));
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return ;
+	if (hist->size > 0)
+		load_lines(hist, map, history_tail(map, st.st_size, hist->size),
+			st.st_size);
+	using_history();
+	start = history_tail(map, st.st_size, hist->file_size);
+	if (start > (size_t)st.st_size - start)
+		history_trim(hist, map, start, st.st_size);
+	munmap(map, st.st_size);
+}
+
+/**
+ * @brief Readline's pre-input hook, run each time a prompt is shown.
+ *
+ * The first time, the history file is loaded; the prompt is already on
+ * the screen by then. Every time, the lines accepted since the previous
+ * prompt are written to the file, while the user is typing.
+ *
+ * @return 0.
+ */
+int	history_pre_input(void)
+{
+	t_history	*hist;
+
+	hist = *history_slot();
+	if (hist == NULL)
+		return (0);
+	if (!hist->loaded)
+	{
+		hist->loaded = 1;
+		load_history_file(hist);
+	}
+	history_flush(hist);
+	return (0);
+}
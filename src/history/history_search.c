@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_search.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 17:26:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 11:17:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds the last entry of a gram list that comes before `before`.
+ *
+ * @param p The list.
+ * @param before The entry to search before.
+ * @return Its position in the list, or -1 if there is none.
+ */
+static int	last_before(t_postings *p, int before)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = p->len;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (p->ids[mid] < before)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo - 1);
+}
+
+/**
+ * @brief Finds the shortest of the gram lists of a pattern.
+ *
+ * The grams are the pattern's trigrams, or the pattern itself if it is
+ * shorter than three bytes.
+ *
+ * @param idx The index.
+ * @param pattern The pattern.
+ * @param len Its length, at least 1.
+ * @return The list, or NULL if one of the grams is in no entry, so that
+ *         no entry can contain the pattern.
+ */
+static t_postings	*rarest_postings(t_hindex *idx, const char *pattern,
+		size_t len)
+{
+	t_postings	*best;
+	t_postings	*p;
+	size_t		n;
+	size_t		i;
+
+	n = 3;
+	if (len < 3)
+		n = len;
+	best = NULL;
+	i = 0;
+	while (i + n <= len)
+	{
+		p = find_postings(idx, index_gram(pattern + i, n));
+		if (p == NULL)
+			return (NULL);
+		if (best == NULL || p->len < best->len)
+			best = p;
+		i++;
+	}
+	return (best);
+}
+
+/**
+ * @brief Finds the newest history entry before `before` that contains
+ * `pattern`.
+ *
+ * Only the entries listed under the rarest gram of the pattern are
+ * checked, newest first. For a pattern of up to three bytes every one of
+ * them matches, so the answer is found by a binary search.
+ *
+ * @param idx The index.
+ * @param pattern The pattern.
+ * @param before The entry to search before; INT_MAX to search them all.
+ * @return The matching entry, or -1 if there is none.
+ */
+int	index_search(t_hindex *idx, const char *pattern, int before)
+{
+	t_postings	*p;
+	int			i;
+
+	if (pattern[0] == '\0' || idx->count == 0)
+		return (-1);
+	if (before > idx->base + idx->count)
+		before = idx->base + idx->count;
+	p = rarest_postings(idx, pattern, ft_strlen(pattern));
+	if (p == NULL)
+		return (-1);
+	i = last_before(p, before);
+	while (i >= 0)
+	{
+		if (strstr(idx->lines[p->ids[i] - idx->base], pattern) != NULL)
+			return (p->ids[i]);
+		i--;
+	}
+	return (-1);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_widget.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 17:26:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/23 17:26:51 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Shows the search prompt and the entry the pattern matches.
+ *
+ * @param s The search.
+ * @param idx The history index.
+ */
+static void	show_search(t_hsearch *s, t_hindex *idx)
+{
+	rl_message("(reverse-i-search)`%s': ", s->pattern);
+	if (s->match >= 0)
+		rl_replace_line(idx->lines[s->match - idx->base], 0);
+	rl_point = rl_end;
+	rl_redisplay();
+}
+
+/**
+ * @brief Moves a search to the newest entry before `before` that matches
+ * its pattern, or rings the bell and stays put if there is none.
+ */
+static void	search_from(t_hsearch *s, t_hindex *idx, int before)
+{
+	int	id;
+
+	if (s->len == 0)
+		return ;
+	if (before < 0)
+		before = INT_MAX;
+	id = index_search(idx, s->pattern, before);
+	if (id >= 0)
+		s->match = id;
+	else
+		rl_ding();
+}
+
+/**
+ * @brief Handles one key of a search.
+ *
+ * A printable key extends the pattern, Backspace shortens it, and Ctrl-R
+ * moves to the next older match. Any other control key ends the search.
+ *
+ * @param s The search.
+ * @param idx The history index.
+ * @param c The key.
+ * @return 1 to go on searching, 0 to end the search.
+ */
+static int	search_key(t_hsearch *s, t_hindex *idx, int c)
+{
+	if (g_signal_received == SIGINT)
+		return (0);
+	if (c == CTRL('R'))
+		search_from(s, idx, s->match);
+	else if ((c == RUBOUT || c == CTRL('H')) && s->len > 0)
+	{
+		s->pattern[--s->len] = '\0';
+		s->match = -1;
+		search_from(s, idx, INT_MAX);
+	}
+	else if (c >= ' ' && c != RUBOUT && s->len < HSEARCH_MAX - 1)
+	{
+		s->pattern[s->len++] = c;
+		if (s->match < 0)
+			search_from(s, idx, INT_MAX);
+		else
+			search_from(s, idx, s->match + 1);
+	}
+	else if (c < ' ' && c != CTRL('H'))
+		return (0);
+	return (1);
+}
+
+/**
+ * @brief Ends a search on key `c`.
+ *
+ * Enter runs the line found, Ctrl-G and Ctrl-C bring back the line as it
+ * was, Escape leaves the line found to be edited, and any other key is
+ * run on it.
+ */
+static void	end_search(t_hsearch *s, int c)
+{
+	int	cancel;
+
+	cancel = (c == CTRL('G') || g_signal_received == SIGINT);
+	rl_restore_prompt();
+	rl_clear_message();
+	if (cancel)
+		rl_replace_line(s->saved, 0);
+	rl_point = rl_end;
+	if (!cancel && (c == NEWLINE || c == RETURN))
+		rl_newline(1, c);
+	else if (!cancel && c != ESC)
+		rl_execute_next(c);
+	free(s->saved);
+}
+
+/**
+ * @brief Readline command bound to Ctrl-R: incremental reverse search of
+ * the history through its n-gram index.
+ *
+ * @param count The numeric argument (unused).
+ * @param key The key that ran the command (unused).
+ * @return 0.
+ */
+int	history_search_key(int count, int key)
+{
+	t_history	*hist;
+	t_hsearch	s;
+	int			c;
+
+	(void)count;
+	(void)key;
+	hist = *history_slot();
+	if (hist == NULL)
+		return (rl_ding(), 0);
+	ft_bzero(&s, sizeof(t_hsearch));
+	s.match = -1;
+	s.saved = ft_strdup(rl_line_buffer);
+	if (s.saved == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	rl_save_prompt();
+	show_search(&s, &hist->index);
+	c = rl_read_key();
+	while (search_key(&s, &hist->index, c))
+	{
+		show_search(&s, &hist->index);
+		c = rl_read_key();
+	}
+	end_search(&s, c);
+	return (0);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARRAY_H
+# define ARRAY_H
+
+# define ARRAY_BUCKETS 64
+# define ASSOC_MIN_BUCKETS 8
+# define ARRAY_MAX_INDEX 16777215
+# define ASSIGN_PLAIN 1
+# define ASSIGN_ARRAY 2
+
+/**
+ * @brief Struct to represent one key of an associative array.
+ */
+typedef struct s_assoc_entry
+{
+	char					*key;
+	char					*value;
+	struct s_assoc_entry	*next;
+}	t_assoc_entry;
+
+/**
+ * @brief Struct to represent an array variable, indexed or associative.
+ *
+ * An indexed array keeps its elements in `items`, a vector of `cap` slots
+ * of which the first `len` are in use; a NULL slot is an element that is
+ * not set. An associative array keeps them in `buckets`, a hash table of
+ * `nbuckets` chains that doubles once it holds more keys than chains.
+ * `count` is the number of elements set, in either form. Arrays are
+ * chained in `pd->arrays`, a hash table of ARRAY_BUCKETS keyed by name.
+ */
+typedef struct s_array
+{
+	char			*name;
+	int				assoc;
+	char			**items;
+	size_t			len;
+	size_t			cap;
+	t_assoc_entry	**buckets;
+	size_t			nbuckets;
+	size_t			count;
+	struct s_array	*next;
+}	t_array;
+
+/**
+ * @brief Struct to hold the parts of a braced expansion such as
+ * `${#name[sub]}` while it is parsed.
+ */
+typedef struct s_braced
+{
+	char	op;
+	char	*name;
+	char	*sub;
+	size_t	end;
+}	t_braced;
+
+// array_table.c
+unsigned int	array_hash(const char *name, size_t nbuckets);
+t_array			*find_array(t_array **table, const char *name);
+t_array			*declare_array(const char *name, int assoc,
+					t_process_data *pd);
+void			unset_array(const char *name, t_process_data *pd);
+void			free_arrays(t_process_data *pd);
+
+// array.c
+int				array_set(t_array *arr, long index, const char *value);
+const char		*array_get(t_array *arr, long index);
+void			array_unset_at(t_array *arr, long index);
+
+// array_assoc.c
+t_assoc_entry	*assoc_find(t_array *arr, const char *key);
+void			assoc_set(t_array *arr, const char *key, const char *value);
+
+// array_assoc_helper.c
+const char		*assoc_get(t_array *arr, const char *key);
+void			assoc_unset(t_array *arr, const char *key);
+void			free_assoc(t_array *arr);
+
+// array_list.c
+void			clear_array(t_array *arr);
+char			**array_list(t_array *arr, int keys);
+
+// array_element.c
+long			array_index(const char *sub, t_expand_data *data);
+char			*array_element(t_array *arr, const char *sub,
+					t_expand_data *data);
+int				store_element(t_array *arr, const char *sub,
+					const char *value, t_expand_data *data);
+void			unset_array_args(char **args, t_process_data *pd);
+
+// array_assign.c
+int				assign_compound(const char *word, int assoc,
+					t_process_data *pd);
+
+// array_assign_helper.c
+int				is_compound_assignment(const char *word);
+int				run_array_assignment(const char *word, t_process_data *pd);
+
+// expander_array.c
+int				expand_braced_special(const char *input, size_t i,
+					char **result, t_expand_data *data);
+size_t			array_ref_len(const char *s);
+
+// expander_array_value.c
+char			*braced_value(const char *name, const char *sub, char op,
+					t_expand_data *data);
+
+// expander_array_words.c
+int				expand_array_words(t_token *token, t_process_data *pd,
+					char ***out);
+
+#endif
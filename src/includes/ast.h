@@ -0,0 +1,292 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/10 10:12:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 14:36:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AST_H
+# define AST_H
+
+# define AST_OK 0
+# define AST_INCOMPLETE 1
+# define AST_ERROR 2
+
+# define LOOP_NONE 0
+# define LOOP_BREAK 1
+# define LOOP_CONTINUE 2
+# define LOOP_RETURN 3
+
+# define FUNC_BUCKETS 64
+# define FUNC_MAX_DEPTH 1000
+
+/** @brief Enum to represent the kind of a node in a parsed script.
+ *
+ * Simple commands keep their pre-tokenized words; every other kind is a
+ * compound command whose children are executed straight from the tree.
+ */
+typedef enum e_node_type
+{
+	NODE_SIMPLE,
+	NODE_PIPELINE,
+	NODE_IF,
+	NODE_WHILE,
+	NODE_UNTIL,
+	NODE_FOR,
+	NODE_CASE,
+	NODE_GROUP,
+	NODE_FUNCDEF
+}	t_node_type;
+
+/** @brief Enum to represent how a node is joined to the next one in a list.
+ */
+typedef enum e_connector
+{
+	CONN_SEQ,
+	CONN_AND,
+	CONN_OR
+}	t_connector;
+
+/** @brief Struct to represent one `pattern) list ;;` arm of a case command.
+ */
+typedef struct s_case_item
+{
+	t_token				**patterns;
+	struct s_ast_node	*body;
+	struct s_case_item	*next;
+}	t_case_item;
+
+/** @brief Struct to represent a node of a parsed script.
+ *
+ * The text of a script is scanned and tokenized once into this tree.
+ * Expansion is deferred until the node is executed, so loop bodies can be
+ * run any number of times without going back through the lexer.
+ * - words:  tokens of a simple command, the word list of a `for`, or the
+ *           subject of a `case`.
+ * - stages: the commands of a pipeline, in order.
+ * - cond/body/alt: condition, body and else-branch of if/while/until.
+ * - name:   the variable of a `for`, or the name of a function definition.
+ * - redirs: redirections attached to a compound command (`done > file`).
+ * - negate/timed: set by a `!` or `time [-p]` prefix of the pipeline.
+ * - pipe_size: set by a `pipesize SIZE` prefix (see parse_pipe_size()).
+ * - heredocs: the bodies of the `<<` redirections of `words` or `redirs`,
+ *           in order, read with the script text (see sp_take_heredocs()).
+ * - connector/next: link to the next node of the enclosing list.
+ */
+typedef struct s_ast_node
+{
+	t_node_type			type;
+	t_token				**words;
+	char				*name;
+	struct s_ast_node	**stages;
+	int					stage_count;
+	struct s_ast_node	*cond;
+	struct s_ast_node	*body;
+	struct s_ast_node	*alt;
+	t_case_item			*items;
+	t_token				**redirs;
+	int					negate;
+	int					timed;
+	long				pipe_size;
+	char				**heredocs;
+	t_connector			connector;
+	struct s_ast_node	*next;
+}	t_ast_node;
+
+/** @brief Struct to represent the prefixes read in front of a pipeline.
+ */
+typedef struct s_pipeline_prefix
+{
+	int		negate;
+	int		timed;
+	long	pipe_size;
+}	t_pipeline_prefix;
+
+/** @brief Struct to represent one entry of the function hash table.
+ *
+ * The body is the compound command parsed with the definition; it stays
+ * owned by the script it came from (see release_script_ast()).
+ */
+typedef struct s_function
+{
+	char				*name;
+	t_ast_node			*body;
+	struct s_function	*next;
+}	t_function;
+
+/** @brief Struct to represent one active function call.
+ *
+ * argv/argc are the positional parameters ($1.., $#); `saved` holds the
+ * values that `local` shadowed, restored when the call returns (a NULL
+ * value means the variable did not exist).
+ */
+typedef struct s_call_frame
+{
+	char				**argv;
+	int					argc;
+	int					depth;
+	t_env_var			*saved;
+	struct s_call_frame	*prev;
+}	t_call_frame;
+
+/** @brief Struct to represent one file parsed by `source`.
+ *
+ * The entry is valid as long as the file at `path` still has the same
+ * device, inode, modification time and size; otherwise it is parsed again
+ * into a new entry. Stale entries lose their path but keep their tree,
+ * which function bodies may still point into. `name` is the name without
+ * a slash that was last looked up in PATH to find the file, and
+ * `path_value` the PATH it was looked up in (see find_source_name()).
+ */
+typedef struct s_source_cache
+{
+	char					*path;
+	char					*name;
+	char					*path_value;
+	dev_t					dev;
+	ino_t					ino;
+	struct timespec			mtime;
+	off_t					size;
+	t_ast_node				*ast;
+	struct s_source_cache	*next;
+}	t_source_cache;
+
+/** @brief Struct to hold the state of the script parser.
+ *
+ * The parser walks `text` with a cursor. `status` becomes AST_INCOMPLETE
+ * when the text ends in the middle of a compound command or of a heredoc
+ * body, so the caller can read a continuation line and parse again;
+ * `final` is set when no more text will come. Heredoc bodies start after
+ * the newline at `heredoc_nl`; `heredoc_next` is where the next one
+ * starts, or 0 when none is pending.
+ */
+typedef struct s_script_parser
+{
+	const char		*text;
+	size_t			pos;
+	int				status;
+	int				final;
+	size_t			heredoc_nl;
+	size_t			heredoc_next;
+	t_process_data	*pd;
+}	t_script_parser;
+
+// ast_scan.c
+void		sp_skip_blanks(t_script_parser *p);
+void		sp_skip_newlines(t_script_parser *p);
+size_t		sp_word_len(t_script_parser *p);
+int			sp_at_word(t_script_parser *p, const char *word);
+int			sp_at_op(t_script_parser *p, const char *op);
+
+// ast_scan_helper.c
+size_t		sp_command_end(t_script_parser *p);
+int			sp_at_eof(t_script_parser *p);
+int			sp_at_list_end(t_script_parser *p);
+int			sp_expect_word(t_script_parser *p, const char *word);
+
+// ast_error.c
+void		sp_unexpected(t_script_parser *p, const char *token);
+void		sp_syntax_error(t_script_parser *p);
+void		*sp_fail(t_script_parser *p);
+
+// ast_node.c
+t_ast_node	*new_ast_node(t_node_type type);
+void		free_ast(t_ast_node *node);
+t_token		**sp_parse_slice(t_script_parser *p, size_t start, size_t end);
+
+// ast_parser.c
+t_ast_node	*parse_and_or(t_script_parser *p);
+int			parse_script(const char *text, t_ast_node **out,
+				t_process_data *pd, int final);
+
+// ast_heredoc.c
+int			sp_take_heredocs(t_script_parser *p, t_ast_node *node,
+				t_token **tokens);
+
+// ast_list.c
+t_ast_node	*parse_list(t_script_parser *p);
+t_ast_node	*parse_body(t_script_parser *p);
+int			sp_take_time(t_script_parser *p);
+
+// ast_prefix.c
+int			sp_take_prefixes(t_script_parser *p, t_pipeline_prefix *pre);
+
+// ast_parser_helper_1.c
+t_ast_node	*parse_command(t_script_parser *p);
+
+// ast_parser_helper_2.c
+t_ast_node	*parse_if(t_script_parser *p);
+t_ast_node	*parse_loop(t_script_parser *p, t_node_type type);
+
+// ast_parser_helper_3.c
+t_ast_node	*parse_for(t_script_parser *p);
+
+// ast_parser_helper_4.c
+t_case_item	*parse_case_item(t_script_parser *p);
+
+// ast_parser_helper_5.c
+t_ast_node	*parse_case(t_script_parser *p);
+
+// ast_parser_helper_6.c
+int			sp_at_funcdef(t_script_parser *p);
+int			sp_at_compound(t_script_parser *p);
+t_ast_node	*parse_group(t_script_parser *p);
+t_ast_node	*parse_funcdef(t_script_parser *p);
+
+// ast_exec.c
+int			ast_interrupted(int status);
+int			execute_ast_node(t_ast_node *node, t_process_data *pd);
+int			execute_ast(t_ast_node *list, t_process_data *pd);
+
+// ast_exec_loops.c
+int			loop_should_stop(t_process_data *pd, int status);
+int			execute_if(t_ast_node *node, t_process_data *pd);
+int			execute_loop(t_ast_node *node, t_process_data *pd);
+int			execute_for(t_ast_node *node, t_process_data *pd);
+
+// ast_exec_case.c
+int			execute_case(t_ast_node *node, t_process_data *pd);
+
+// ast_exec_pipeline.c
+int			execute_pipeline_node(t_ast_node *node, t_process_data *pd);
+void		run_compound_in_child(t_command *cmd, t_process_data *data);
+
+// ast_func_table.c
+t_function	*find_function(t_process_data *pd, const char *name);
+int			define_function(t_ast_node *node, t_process_data *pd);
+void		release_script_ast(t_ast_node *ast, t_process_data *pd);
+void		free_functions(t_process_data *pd);
+
+// ast_func_call.c
+int			call_function(t_ast_node *body, char **args,
+				t_process_data *pd);
+int			execute_function_command(t_function *fn, t_execute_data *data,
+				t_process_data *pd);
+void		run_function_in_child(t_command *cmd, t_process_data *data);
+
+// ast_source_cache.c
+t_source_cache	*load_source(const char *path, t_process_data *pd,
+					int *status);
+void		free_source_cache(t_process_data *pd);
+
+// ast_source_lookup.c
+int			source_entry_current(t_source_cache *entry, struct stat *st);
+t_source_cache	*find_source_name(const char *name, t_process_data *pd);
+void		remember_source_name(t_source_cache *entry, const char *name,
+				t_process_data *pd);
+
+// ast_input.c
+int			is_compound_input(const char *line);
+int			run_script_input(char *line, int interactive,
+				t_process_data *pd);
+
+// ast_input_helper.c
+int			parse_input(char **text, int interactive, t_ast_node **ast,
+				t_process_data *pd);
+
+#endif
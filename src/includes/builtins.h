@@ -6,15 +6,137 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/28 09:01:24 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 10:05:14 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef BUILTINS_H
 # define BUILTINS_H
 
+# define READ_BUF_SIZE 4096
+# define READ_TIMEOUT -2
+# define PRINTF_CACHE_MAX 32
+# define PRINTF_BAD 1
+# define COPY_BUF_SIZE 131072
+# define COPY_CHUNK 1048576
+
+/** @brief Signature shared by every built-in command adapter.
+ */
+typedef int	(*t_builtin_fn)(char **args, t_process_data *process_data);
+
+/** @brief Signature of the check telling whether a builtin handles a
+ * given argument list.
+ */
+typedef int	(*t_builtin_check)(char **args);
+
+/** @brief Struct to represent one entry of the builtin dispatch table.
+ *
+ * `accepts` is NULL for a builtin that takes every argument list; else a
+ * call it turns down runs the external command of the same name.
+ */
+typedef struct s_builtin
+{
+	const char		*name;
+	t_builtin_fn	fn;
+	t_builtin_check	accepts;
+}	t_builtin;
+
+/** @brief Read-ahead buffer of the `read` builtin.
+ *
+ * Only a seekable descriptor is read ahead; the bytes from `start` to
+ * `end` have been read from `fd` but not used yet, and are handed back
+ * with sync_read_buffer() before anything else touches the descriptor.
+ */
+typedef struct s_read_buffer
+{
+	int		fd;
+	size_t	start;
+	size_t	end;
+	char	data[READ_BUF_SIZE];
+}	t_read_buffer;
+
+/** @brief Struct to hold the options and the line of one `read` call.
+ *
+ * nchars is -1 without `-n`, and deadline is -1 without `-t` (and the
+ * timeout itself until the read starts). script is set when standard
+ * input is the script the shell reads its commands from.
+ */
+typedef struct s_read_state
+{
+	int			raw;
+	char		delim;
+	long long	nchars;
+	long long	deadline;
+	int			script;
+	char		*line;
+	size_t		len;
+	size_t		cap;
+}	t_read_state;
+
+/** @brief One piece of a parsed `printf` format.
+ *
+ * `conv` is 0 for literal text (`len` bytes, escapes already decoded),
+ * PRINTF_BAD for an invalid conversion, or else the conversion letter,
+ * `text` then being the printf(3) spec to format its argument with.
+ */
+typedef struct s_fmt_seg
+{
+	char				conv;
+	char				*text;
+	size_t				len;
+	struct s_fmt_seg	*next;
+}	t_fmt_seg;
+
+/** @brief A parsed `printf` format, cached under its source text.
+ */
+typedef struct s_printf_format
+{
+	char					*source;
+	t_fmt_seg				*segs;
+	int						convs;
+	struct s_printf_format	*next;
+}	t_printf_format;
+
+/** @brief Struct to hold the output and arguments of one `printf` call.
+ */
+typedef struct s_printf_run
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	char	**args;
+	int		status;
+	int		stop;
+}	t_printf_run;
+
+/** @brief Struct to hold the files of one `tee` call.
+ *
+ * fds[i] is -1 for a file that could not be opened or written; `opened`
+ * counts the files that were opened.
+ */
+typedef struct s_tee
+{
+	char	**names;
+	int		*fds;
+	int		count;
+	int		opened;
+	int		append;
+	int		status;
+}	t_tee;
+
+/** @brief Struct to hold the arguments of `test` and the parse position.
+ */
+typedef struct s_test_parse
+{
+	const char	*name;
+	char		**args;
+	int			argc;
+	int			pos;
+	int			error;
+}	t_test_parse;
+
 int		run_pwd(void);
-int		is_builtin(char *cmd);
+int		is_builtin(char **args);
 void	run_env(t_env_var *env_list);
 int		is_valid_identifier(const char *str);
 int		perform_single_pass(t_env_var *start);
@@ -26,8 +148,123 @@ int		run_export(t_env_var *env_list, char **args);
 int		ft_str_to_llong(const char *str, long long *out_val);
 int		export_variable(const char *arg, t_env_var *env_list);
 int		run_builtin(char **args, t_process_data *process_data);
-int		apply_builtin_redirection(char *input_file, char *output_file,
-			int output_mode);
 int		ft_parse_digits_to_llong(const char *str,
 			int sign, long long *out_val);
+
+// builtins.c
+const t_builtin	*builtin_table(void);
+const t_builtin	*find_builtin(const char *name);
+
+// builtins_adapter_1.c
+int		builtin_echo(char **args, t_process_data *process_data);
+int		builtin_cd(char **args, t_process_data *process_data);
+int		builtin_pwd(char **args, t_process_data *process_data);
+int		builtin_exit(char **args, t_process_data *process_data);
+int		builtin_env(char **args, t_process_data *process_data);
+
+// builtins_adapter_2.c
+int		builtin_export(char **args, t_process_data *process_data);
+int		builtin_unset(char **args, t_process_data *process_data);
+int		run_true(char **args, t_process_data *process_data);
+int		run_false(char **args, t_process_data *process_data);
+
+// loop_control.c
+int		run_break(char **args, t_process_data *process_data);
+int		run_continue(char **args, t_process_data *process_data);
+
+// function_control.c
+int		run_local(char **args, t_process_data *process_data);
+int		run_return(char **args, t_process_data *process_data);
+
+// source.c
+int		run_source(char **args, t_process_data *process_data);
+
+// read.c
+int		run_read(char **args, t_process_data *process_data);
+
+// read_buffer.c
+int		wait_for_input(int fd, long long deadline);
+int		read_next_char(t_process_data *pd, int fd, t_read_state *st, char *c);
+void	sync_read_buffer(t_process_data *pd);
+void	free_read_buffer(t_process_data *pd);
+
+// read_helper_1.c
+long long	read_clock_ms(void);
+int		read_input(t_process_data *pd, t_read_state *st);
+int		read_input_ready(t_process_data *pd, int fd);
+int		read_from_script(t_process_data *pd, int fd);
+
+// read_helper_2.c
+void	assign_read_fields(char *line, char **names, t_process_data *pd);
+int		check_read_names(char **names);
+int		read_usage_error(char opt, char *message);
+
+// printf.c
+int		run_printf(char **args, t_process_data *process_data);
+// declare.c
+int		run_declare(char **args, t_process_data *process_data);
+
+// history.c
+int		run_history(char **args, t_process_data *process_data);
+
+// printf_format.c
+t_printf_format	*parse_printf_format(const char *src);
+
+// printf_helper.c
+int		printf_escape(const char *s, char *out, int in_b);
+void	printf_reserve(t_printf_run *run, size_t extra);
+char	*printf_decode_b(const char *arg, t_printf_run *run);
+long long	printf_number(const char *arg, t_printf_run *run);
+
+// printf_cache.c
+t_printf_format	*find_printf_format(const char *src, t_process_data *pd);
+void	free_printf_cache(t_process_data *pd);
+
+// cat.c
+int		cat_accepts(char **args);
+int		run_cat(char **args, t_process_data *process_data);
+
+// tee.c
+int		tee_accepts(char **args);
+int		run_tee(char **args, t_process_data *process_data);
+
+// exec.c
+int		run_exec(char **args, t_process_data *process_data);
+int		execute_exec_builtin(t_execute_data *data,
+			t_process_data *process_data);
+
+// tee_helper.c
+void	tee_stream(t_tee *tp);
+
+// copy_fd.c
+int		copy_fd(int in, int out);
+
+// copy_fd_helper.c
+ssize_t	copy_read(int fd, char *buf, size_t size);
+int		write_all(int fd, const char *buf, size_t len);
+int		copy_error(char *cmd, char *arg);
+
+// test.c
+int		test_str_eq(const char *a, const char *b);
+void	test_error(t_test_parse *tp, const char *arg, const char *message);
+int		run_test(char **args, t_process_data *process_data);
+
+// test_helper_1.c
+int		test_or(t_test_parse *tp);
+
+// test_helper_2.c
+int		is_test_unary_op(const char *op);
+int		test_unary(const char *op, const char *arg, t_test_parse *tp);
+
+// test_helper_3.c
+int		is_test_binary_op(const char *op);
+int		test_binary(const char *l, const char *op, const char *r,
+			t_test_parse *tp);
+
+// stats.c
+int		run_stats(char **args, t_process_data *process_data);
+
+// shellstat.c
+int		run_shellstat(char **args, t_process_data *process_data);
+
 #endif
\ No newline at end of file
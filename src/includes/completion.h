@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 11:05:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMPLETION_H
+# define COMPLETION_H
+
+# include <time.h>
+
+/**
+ * @brief A node of the command-name trie.
+ *
+ * The children of a node are a list linked through `sibling`, sorted by
+ * byte, so the names under a prefix come out in order. `terminal` is set
+ * when the path from the root to the node spells a whole name.
+ */
+typedef struct s_trie
+{
+	unsigned char	c;
+	int				terminal;
+	struct s_trie	*child;
+	struct s_trie	*sibling;
+}	t_trie;
+
+/**
+ * @brief A directory of PATH and the executables found in it.
+ *
+ * `mtime` is the modification time the directory had when `names` was
+ * read; the directory is read again only once it changes.
+ */
+typedef struct s_path_dir
+{
+	char			*path;
+	struct timespec	mtime;
+	char			**names;
+	int				count;
+	int				cap;
+}	t_path_dir;
+
+/**
+ * @brief Struct to hold the command-name completion of an interactive
+ * shell.
+ *
+ * `dirs` are the directories of `path_value`, the PATH they were split
+ * from by find_path_dirs(). Before each completion, PATH is compared
+ * with `path_value` and every directory is stat()ed; only a directory
+ * whose mtime changed is read again, and `root`, the trie of the
+ * builtins and the executables of every directory, is rebuilt from the
+ * names in memory. `matches` and `next` are the state of the readline
+ * generator between calls.
+ */
+typedef struct s_completion
+{
+	char		*path_value;
+	t_path_dir	*dirs;
+	int			ndirs;
+	t_trie		*root;
+	char		**matches;
+	int			next;
+}	t_completion;
+
+/**
+ * @brief The names collected under a prefix by trie_words(), and the
+ * name being spelled.
+ */
+typedef struct s_words
+{
+	char	**items;
+	int		len;
+	int		cap;
+	char	buf[NAME_MAX + 1];
+}	t_words;
+
+// completion.c
+t_process_data	**completion_slot(void);
+void			completion_init(t_process_data *pd);
+
+// completion_refresh.c
+void			completion_refresh(t_completion *comp, t_env_var *env_list);
+void			free_completion(t_process_data *pd);
+
+// completion_scan.c
+int				refresh_dir(t_path_dir *dir);
+void			free_path_dirs(t_completion *comp);
+
+// completion_trie.c
+t_trie			*trie_insert(t_trie *root, const char *word);
+t_trie			*trie_find(t_trie *root, const char *prefix);
+void			free_trie(t_trie *node);
+
+// completion_words.c
+char			**trie_words(t_trie *root, const char *prefix);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/31 11:51:13 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/03 11:26:39 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,6 +25,20 @@ typedef struct s_env_var
 	struct s_env_var	*next;
 }	t_env_var;
 
+/** @brief A variable as it was before a prefix assignment replaced it
+ * for the duration of a builtin or a function call.
+ *
+ * value is NULL if the variable was not set, and `exported` tells which
+ * table it was in.
+ */
+typedef struct s_saved_var
+{
+	char				*key;
+	char				*value;
+	int					exported;
+	struct s_saved_var	*next;
+}	t_saved_var;
+
 void		free_env(t_env_var *env);
 t_env_var	*init_env(char **environ);
 char		**env_list_to_array(t_env_var *env);
@@ -32,5 +46,26 @@ t_env_var	*duplicate_env_list(t_env_var *env_list);
 void		add_env_var(const char *key, const char *value,
 				t_env_var *env_list);
 t_env_var	*find_env_var(const char *key, t_env_var *env_list);
+void		set_shell_var(const char *key, const char *value,
+				t_process_data *pd);
+void		unset_shell_var(const char *key, t_process_data *pd);
+
+// shell_vars.c
+t_env_var	*find_shell_var(const char *key, t_process_data *pd);
+void		export_shell_var(const char *key, t_process_data *pd);
+int			is_assignment_word(const char *word);
+int			is_assignment_only(char **args);
+int			run_assignments(char **args, t_process_data *pd);
+
+// env_overlay.c
+char		**cached_envp(t_process_data *pd);
+void		invalidate_envp(t_process_data *pd);
+char		**command_envp(t_process_data *pd, char **prefix);
+
+// env_prefix.c
+char		**split_env_prefix(char **args);
+void		apply_env_prefix(char **prefix, t_process_data *pd);
+t_saved_var	*push_env_prefix(char **prefix, t_process_data *pd);
+void		pop_env_prefix(t_saved_var *saved, t_process_data *pd);
 
 #endif
\ No newline at end of file
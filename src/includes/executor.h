@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/21 09:39:33 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 13:13:24 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:10:41 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,23 +17,26 @@ typedef struct s_command	t_command;
 
 typedef struct s_env_var	t_env_var;
 
+typedef struct s_fd_op	t_fd_op;
+
 /**
  * @brief Struct to hold data for executing a single command.
  * This struct contains all necessary information for executing
  * a command, including arguments, file paths, environment,
- * and redirection details.
+ * and redirection details. fd_ops is the ordered list of redirections,
+ * with their targets opened once by handle_redirection(). env_prefix
+ * holds the assignments written before the command name, if any.
  */
 typedef struct s_execute_data
 {
 	char		**original_args;
 	char		**clean_args;
-	char		*input_file;
-	char		*output_file;
+	t_fd_op		*fd_ops;
 	char		**path_dirs;
 	char		*cmd_path;
-	int			output_mode;
 	t_env_var	*env_list;
 	char		*heredoc_file;
+	char		**env_prefix;
 }	t_execute_data;
 
 // precheck_line.c
@@ -46,17 +49,19 @@ int			check_redir_error(const char *line, int op_len, int j,
 // path.c
 char		*find_full_cmd_path(char *cmd, char **path_dirs);
 char		**find_path_dirs(t_env_var *env_list);
+char		**prefix_path_dirs(char **prefix);
 
 // executor.c
 int			perform_command_checks(char *cmd_path, char **args, char **envp);
-void		execute_cmd(char *cmd_path, char **args, char **path_dirs,
-				t_env_var *env_list);
+void		execute_cmd(char *cmd_path, char **args, char **envp);
 int			handle_pipeline_command(char *line, t_env_var *env_list,
 				t_process_data *process_data);
 int			handle_single_command(char *line, t_env_var *env_list,
 				t_process_data *process_data);
 int			execute_command(char *line, t_env_var *env_list,
 				t_process_data *process_data);
+int			execute_tokens(t_token **tokens, t_env_var *env_list,
+				t_process_data *process_data);
 
 // execute_command_types.c
 int			execute_builtin_command(t_execute_data *data,
@@ -65,6 +70,8 @@ int			execute_single_command(char **args, t_env_var *env_list,
 				t_process_data *process_data);
 
 // execute_helper.c
+int			execute_assignments(t_execute_data *data,
+				t_process_data *process_data);
 int			handle_redirection_only(t_execute_data *data,
 				t_process_data *process_data);
 int			execute_external_command(t_execute_data *data,
@@ -111,7 +118,6 @@ void		free_args_env(char **args, char **envp);
 void		handle_null_cmd_path(char **args, char **envp);
 
 // execute_builtin_command.c 
-void		restore_builtin_io(int did_save, int saved_stdin, int saved_stdout);
-int			setup_builtin_io(t_execute_data *data,
-				int *saved_stdin, int *saved_stdout, int *did_save);
+void		restore_builtin_io(t_execute_data *data);
+int			setup_builtin_io(t_execute_data *data);
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/04 12:14:24 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/05 14:01:53 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 16:48:19 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,13 +15,18 @@
 
 /** @brief Struct to hold data needed for variable expansion.
  *
- * This struct contains the environment variable list and the last
- * exit status, which are used during variable expansion.
+ * This struct contains the environment variable list, the shell-local
+ * variables, the array variables and the last exit status, which are
+ * used during variable expansion, and the innermost function call
+ * providing the positional parameters. See fill_expand_data().
  */
 typedef struct s_expand_data
 {
-	t_env_var	*env_list;
-	int			last_exit_status;
+	t_env_var		*env_list;
+	t_env_var		*shell_vars;
+	t_array			**arrays;
+	int				last_exit_status;
+	t_call_frame	*frame;
 }	t_expand_data;
 
 /** @brief Struct to hold state information during expansion processing.
@@ -42,10 +47,13 @@ int		is_export_assignment(t_token *token);
 char	**handle_whitespace_splitting(char *expanded);
 char	**expand_and_split_args(t_token **tokens,
 			t_process_data *process_data);
-char	*get_var_value(const char *var_name,
-			t_env_var *env_list, int last_exit_status);
-char	*expand_variables(char *input, t_env_var *env_list,
-			int last_exit_status, t_quote_type quote);
+char	*get_var_value(const char *var_name, t_expand_data *data);
+char	*expand_variables(char *input, t_process_data *pd,
+			t_quote_type quote);
+char	**param_list(t_call_frame *frame);
+char	*get_positional_value(const char *var_name, t_call_frame *frame);
+void	fill_expand_data(t_expand_data *data, t_process_data *pd);
+char	*join_words(char **words);
 int		expand_simple_variable(const char *input, size_t i,
 			char **result, t_expand_data *data);
 int		expand_braced_variable(const char *input, size_t i,
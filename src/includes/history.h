@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 10:14:36 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:12:50 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HISTORY_H
+# define HISTORY_H
+
+# define HISTORY_FILE ".minishell_history"
+# define HISTORY_DEFAULT_SIZE 1000
+# define HINDEX_BUCKETS 65536
+# define HSEARCH_MAX 256
+
+/**
+ * @brief The history entries that contain one gram (one to three bytes).
+ *
+ * `ids` is in increasing order and holds each entry at most once.
+ */
+typedef struct s_postings
+{
+	unsigned int		gram;
+	int					*ids;
+	int					len;
+	int					cap;
+	struct s_postings	*next;
+}	t_postings;
+
+/**
+ * @brief N-gram index of the history, for substring search.
+ *
+ * Entries are numbered in the order they were added; entry `id` is
+ * lines[id - base]. Each entry is listed under every gram of one, two
+ * and three bytes it contains, so a search for a pattern only checks the
+ * entries listed under its rarest gram instead of every line. The lists
+ * are filled as entries are added: the history file's lines while it is
+ * loaded after the first prompt, and then each accepted line. Once the
+ * index holds twice `limit` entries (HISTSIZE), it is cut back to the
+ * newest `limit`, so old entries cost nothing to drop.
+ */
+typedef struct s_hindex
+{
+	char		**lines;
+	int			base;
+	int			count;
+	int			cap;
+	int			limit;
+	t_postings	**buckets;
+}	t_hindex;
+
+/**
+ * @brief State of a Ctrl-R search: the pattern typed so far, the entry
+ * it matched (-1 if none), and the line as it was before the search.
+ */
+typedef struct s_hsearch
+{
+	char	pattern[HSEARCH_MAX];
+	int		len;
+	int		match;
+	char	*saved;
+}	t_hsearch;
+
+/**
+ * @brief Struct to hold the persistent history of an interactive shell.
+ *
+ * `path` is the history file: HISTFILE, or HISTORY_FILE in the home
+ * directory, or NULL if HISTFILE is empty. It is not read at startup:
+ * the first prompt is shown at once, and the file is mapped and its last
+ * `size` lines (HISTSIZE) are loaded just before the first line is read;
+ * see history_pre_input().
+ *
+ * Accepted lines are queued in `buf` and written to `fd`, opened with
+ * O_APPEND, in one write() when the next prompt is shown, so running a
+ * command never waits on the file and concurrent shells do not clobber
+ * each other's lines; `fd` follows the file when another shell's trim
+ * replaces it. The file is cut back to its last `file_size` lines
+ * (HISTFILESIZE) only once it has grown to twice that, so it is not
+ * rewritten at every exit. An entry of several lines takes several lines
+ * of the file (see history_encode()), and counts as one. `owner` is the
+ * shell process: a forked child frees the queue without writing it.
+ * `index` holds the entries for Ctrl-R and `history -s`.
+ */
+typedef struct s_history
+{
+	char		*path;
+	int			fd;
+	int			loaded;
+	pid_t		owner;
+	int			size;
+	int			file_size;
+	char		*buf;
+	size_t		len;
+	size_t		cap;
+	t_hindex	index;
+}	t_history;
+
+// history.c
+void			history_init(t_process_data *pd);
+void			free_history(t_process_data *pd);
+
+// history_file.c
+void			history_add(t_process_data *pd, const char *line);
+void			history_flush(t_history *hist);
+size_t			history_tail(const char *map, size_t len, int lines);
+void			history_trim(t_history *hist, const char *map, size_t start,
+				size_t len);
+
+// history_load.c
+t_history		**history_slot(void);
+int				history_pre_input(void);
+
+// history_entry.c
+size_t			history_encode(char *dst, const char *line);
+size_t			history_decode_line(char *dst, const char *src, size_t len,
+					int *more);
+int				history_continued(const char *map, size_t end);
+
+// history_index.c
+unsigned int	index_gram(const char *s, int n);
+t_postings		*find_postings(t_hindex *idx, unsigned int gram);
+void			index_add(t_hindex *idx, const char *line);
+
+// history_index_helper.c
+void			index_trim(t_hindex *idx);
+void			free_index(t_hindex *idx);
+
+// history_search.c
+int				index_search(t_hindex *idx, const char *pattern, int before);
+
+// history_widget.c
+int				history_search_key(int count, int key);
+
+#endif
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instrument.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INSTRUMENT_H
+# define INSTRUMENT_H
+
+/* Set by `make instrument`, which also links with `ld --wrap`. */
+# ifndef INSTRUMENT
+#  define INSTRUMENT 0
+# endif
+
+# define INSTR_PHASES 10
+# define INSTR_CALLS 10
+# define INSTR_LINE_MAX 160
+
+/** @brief Syscalls counted by an instrumented build, one per wrapper.
+ */
+typedef enum e_instr_call
+{
+	INSTR_ACCESS,
+	INSTR_STAT,
+	INSTR_OPEN,
+	INSTR_CLOSE,
+	INSTR_DUP,
+	INSTR_DUP2,
+	INSTR_PIPE,
+	INSTR_FORK,
+	INSTR_READ,
+	INSTR_WRITE
+}	t_instr_call;
+
+/** @brief Allocations and syscalls counted over some stretch of work.
+ */
+typedef struct s_instr_counts
+{
+	long long	allocs;
+	long long	frees;
+	long long	bytes;
+	long long	calls[INSTR_CALLS];
+}	t_instr_counts;
+
+/**
+ * @brief Struct to hold the counters of an instrumented build.
+ *
+ * The wrappers around malloc() and the syscalls have no process data to
+ * hand, so the counters live in a single static instance; see
+ * instr_state(). Every count goes to the phase running (as last passed
+ * to trace_mark()) and to the command line running. The line counters
+ * move to `last_line` when the shell goes idle again.
+ */
+typedef struct s_instr
+{
+	t_trace_phase	phase;
+	t_instr_counts	phases[INSTR_PHASES];
+	t_instr_counts	line;
+	t_instr_counts	last_line;
+}	t_instr;
+
+// instr.c
+t_instr		*instr_state(void);
+void		instr_phase(t_trace_phase phase);
+void		instr_count_alloc(size_t size);
+void		instr_count_free(void *ptr);
+void		instr_count_call(t_instr_call call);
+
+// instr_wrap_1.c
+void		*__real_malloc(size_t size);
+void		*__real_realloc(void *ptr, size_t size);
+void		__real_free(void *ptr);
+int			__real_access(const char *path, int mode);
+int			__real_stat(const char *path, struct stat *buf);
+
+// instr_wrap_2.c
+int			__real_open(const char *path, int flags, ...);
+int			__real_close(int fd);
+int			__real_dup(int fd);
+int			__real_dup2(int fd, int fd2);
+
+// instr_wrap_3.c
+int			__real_pipe(int fds[2]);
+pid_t		__real_fork(void);
+ssize_t		__real_read(int fd, void *buf, size_t n);
+ssize_t		__real_write(int fd, const void *buf, size_t n);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/04 13:10:15 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 13:02:31 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,6 +27,7 @@
 # include <string.h>
 # include <sys/wait.h>
 # include <sys/stat.h>
+# include <sys/resource.h>
 # include <readline/history.h>
 # include <readline/readline.h>
 
@@ -40,6 +41,16 @@
 # include "./lexer.h"
 # include "./env.h"
 # include "./expander.h"
+# include "./array.h"
+# include "./ast.h"
+# include "./trace.h"
+# include "./timing.h"
+# include "./stats.h"
+# include "./instrument.h"
+# include "./record.h"
+# include "./history.h"
+# include "./completion.h"
+# include "./pipe_profile.h"
 
 extern volatile sig_atomic_t	g_signal_received;
 
@@ -50,6 +61,7 @@ void	ft_error(char *command, char *message);
 void	free_execute_data(t_execute_data *data);
 void	bootstrap_env_if_empty(t_env_var **env_list);
 void	shutdown_shell(t_process_data *process_data);
+void	free_shell_state(t_process_data *process_data);
 void	ft_error_with_arg(char *command, char *arg, char *message);
 void	error_with_backticked_arg(const char *cmd, const char *arg,
 			const char *msg);
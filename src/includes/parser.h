@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/26 10:54:01 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 11:39:16 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -46,7 +46,9 @@ typedef struct s_token
 }	t_token;
 
 int			is_redirect(const char *s);
+int			redirect_op_len(const char *s);
 int			count_tokens(const char *s);
+size_t		compound_assign_len(const char *s);
 void		free_command(t_command *cmd);
 int			count_heredocs(const char *line);
 char		**append_split_to_final(char **final_args,
@@ -58,6 +60,7 @@ t_token		**parse_line(char *line, t_process_data *pd);
 char		**process_token(t_token *token, char *expanded);
 t_command	*create_command(char **tokens, char **path_dirs,
 				t_process_data *process_data);
+t_command	*create_empty_command(void);
 int			cleanup_and_return_error(t_execute_data exec_data);
 t_token		*create_token(char *value, t_quote_type quote_type);
 int			quotes_are_closed(const char *line, t_process_data *pd);
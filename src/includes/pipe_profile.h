@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_profile.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 11:05:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 15:22:10 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PIPE_PROFILE_H
+# define PIPE_PROFILE_H
+
+# define PROFILE_ENV "MINISHELL_PIPE_PROFILE"
+# define PROFILE_STAT_MAX 512
+# define PROFILE_LINE_MAX 160
+# define PIPE_SIZE_ENV "MINISHELL_PIPE_SIZE"
+# define PIPE_SIZE_ADAPTIVE -1
+# define PIPE_ADAPT_MS 10
+# define PIPE_ADAPT_STREAK 2
+# define PIPE_ADAPT_GROWTH 4
+
+/**
+ * @brief What the profiler saw of one pipeline stage.
+ *
+ * `empty_us` is the time the stage spent asleep with nothing in its input
+ * pipe, and `full_us` the time it spent asleep with its output pipe full
+ * (`out_cap` bytes; `out_peak` is the highest fill level seen). Both are
+ * summed over samples, so they are only as fine as the interval.
+ * `end_us` is 0 while the stage is running. `full_streak` counts the
+ * samples in a row that found the output pipe full, for adaptive sizing.
+ */
+typedef struct s_stage_profile
+{
+	long long	cpu_ticks;
+	long long	empty_us;
+	long long	full_us;
+	long long	end_us;
+	int			out_cap;
+	int			out_peak;
+	int			full_streak;
+}	t_stage_profile;
+
+/**
+ * @brief Struct to hold the state of one monitored pipeline run.
+ *
+ * Profiling is enabled by setting MINISHELL_PIPE_PROFILE to the sampling
+ * interval in milliseconds; `adaptive` is set when the pipe size is
+ * `adaptive`. `tick_ms` is how often the monitor wakes up, and `alive`
+ * counts the stages that have not exited yet.
+ */
+typedef struct s_pipe_profile
+{
+	int				interval_ms;
+	int				adaptive;
+	int				tick_ms;
+	int				alive;
+	int				samples;
+	long long		start_us;
+	long long		last_us;
+	t_stage_profile	*stages;
+}	t_pipe_profile;
+
+// pipe_profile.c
+void	monitor_pipeline(t_process_data *data);
+
+// pipe_profile_sample.c
+void	profile_sample(t_process_data *data, t_pipe_profile *prof);
+
+// pipe_profile_report.c
+void	report_pipe_profile(t_process_data *data, t_pipe_profile *prof);
+
+// pipe_size.c
+long	parse_pipe_size(const char *str);
+long	pipeline_pipe_size(t_process_data *data);
+int		set_pipe_size(int fd, long size);
+void	adapt_pipe_sizes(t_process_data *data, t_pipe_profile *prof);
+
+#endif
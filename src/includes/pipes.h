@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/07/22 11:30:32 by makhudon      #+#    #+#                 */
-/*   Updated: 2025/09/09 13:17:28 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/26 16:04:37 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,21 +14,42 @@
 # define PIPES_H
 
 typedef struct s_env_var	t_env_var;
+typedef struct s_ast_node	t_ast_node;
+typedef struct s_function	t_function;
+typedef struct s_call_frame	t_call_frame;
+typedef struct s_source_cache	t_source_cache;
+typedef struct s_read_buffer	t_read_buffer;
+typedef struct s_printf_format	t_printf_format;
+typedef struct s_trace	t_trace;
+typedef struct s_timing	t_timing;
+typedef struct s_stats	t_stats;
+typedef struct s_recorder	t_recorder;
+typedef struct s_fd_op	t_fd_op;
+typedef struct s_array	t_array;
+typedef struct s_history	t_history;
+typedef struct s_completion	t_completion;
 
 /** @brief Struct to represent a command with its arguments and redirections.
  *
  * This struct holds all necessary information for executing a command,
- * including the command path, arguments, input/output redirection files,
- * output mode (append or truncate), and heredoc file if applicable.
+ * including the command path, arguments, the ordered list of its
+ * redirections (see t_fd_op), and heredoc file if applicable.
+ * A pipeline stage that is a compound command (e.g. `while ...; done | cat`)
+ * carries its parsed node instead; the node is owned by the script's AST.
+ * `prelude` is the builtin stage fused in front of this one by
+ * optimize_pipeline(), run first in the same child (it may have its own).
+ * env_prefix holds the assignments written before the command name, as
+ * in `LC_ALL=C sort`; see split_env_prefix().
  */
 typedef struct s_command
 {
-	char	*cmd_path;
-	char	**args;
-	char	*input_file;
-	char	*output_file;
-	int		output_mode;
-	char	*heredoc_file;
+	char				*cmd_path;
+	char				**args;
+	t_fd_op				*fd_ops;
+	char				*heredoc_file;
+	t_ast_node			*node;
+	struct s_command	*prelude;
+	char				**env_prefix;
 }	t_command;
 
 /**
@@ -37,19 +58,74 @@ typedef struct s_command
  * This struct contains information about the commands to execute,
  * pipe file descriptors, environment variables, process IDs, and
  * execution state such as the last exit status and syntax error flag.
+ * env_list holds the exported variables, the ones passed to every child,
+ * and shell_vars the shell-local ones set by plain `NAME=value`. envp
+ * caches env_list as the array given to execve(); see cached_envp().
+ * `arrays` is the hash table of array variables (see array.h); a name is
+ * either an array or a variable of the other two tables.
+ * loop_depth counts the loops being run; loop_ctl and loop_levels hold a
+ * pending `break`/`continue`/`return` and how many loops it still has to
+ * unwind. `functions` is the hash table of defined functions, `frame` the
+ * innermost function call, and `kept_scripts` the scripts whose nodes are
+ * still referenced as function bodies. `heredocs` is the next heredoc
+ * body of the script node being run (see sp_take_heredocs()), or NULL
+ * when bodies are read from the input. `sources` caches the parsed files
+ * of `source`, and source_depth counts the files being sourced. read_buf
+ * is the read-ahead buffer of the `read` builtin, script_st the file the
+ * commands are read from when not at a terminal (zero otherwise), and
+ * printf_formats the cache of parsed `printf` formats. `trace` is the
+ * phase tracer, or NULL when MINISHELL_TRACE is not set, `timing` the
+ * innermost pipeline being run under `time`, or NULL, `stats` the
+ * per-command table shown by the `stats` builtin, and `recorder` the
+ * session log of MINISHELL_RECORD, or NULL. `history` is the persistent
+ * history of an interactive shell (see history.h), or NULL, and
+ * `completion` its command-name completion (see completion.h), or NULL.
+ * pipe_size is the capacity given to the pipes of the pipeline being set
+ * up (0 for the kernel default), and pipe_size_hint the one asked for by
+ * an enclosing `pipesize` prefix. inline_stage is the stage the shell runs
+ * itself instead of forking it (-1 if none), and inline_status its exit
+ * status. tail_elided is set when
+ * optimize_pipeline() dropped a trailing `| cat`.
  */
 typedef struct s_process_data
 {
-	t_command	**cmds;
-	int			**pipes;
-	char		**path_dirs;
-	pid_t		*pids;
-	int			cmd_count;
-	t_env_var	*env_list;
-	int			last_exit_status;
-	int			in_pipeline;
-	int			syntax_error;
-	char		**parts;
+	t_command		**cmds;
+	int				**pipes;
+	char			**path_dirs;
+	pid_t			*pids;
+	int				cmd_count;
+	t_env_var		*env_list;
+	t_env_var		*shell_vars;
+	char			**envp;
+	t_array			**arrays;
+	int				last_exit_status;
+	int				in_pipeline;
+	int				syntax_error;
+	char			**parts;
+	int				loop_depth;
+	int				loop_ctl;
+	int				loop_levels;
+	t_function		**functions;
+	t_call_frame	*frame;
+	t_ast_node		*kept_scripts;
+	int				keep_script;
+	char			**heredocs;
+	t_source_cache	*sources;
+	int				source_depth;
+	t_read_buffer	*read_buf;
+	struct stat		script_st;
+	t_printf_format	*printf_formats;
+	t_trace			*trace;
+	t_timing		*timing;
+	t_stats			*stats;
+	t_recorder		*recorder;
+	t_history		*history;
+	t_completion	*completion;
+	long			pipe_size;
+	long			pipe_size_hint;
+	int				inline_stage;
+	int				inline_status;
+	int				tail_elided;
 }	t_process_data;
 
 /**
@@ -61,6 +137,7 @@ typedef struct s_process_data
 typedef struct s_wait_info
 {
 	int	last_status;
+	int	last_signal;
 	int	signal_printed;
 }	t_wait_info;
 
@@ -81,4 +158,20 @@ void	handle_access_error_child(char *cmd_name, char **envp,
 void	handle_execve_error_child(char *cmd_name, char **envp,
 			t_process_data *data, int error_code);
 
+// pipe_inline.c
+int		find_inline_stage(t_process_data *data);
+void	run_inline_stage(t_process_data *data);
+pid_t	wait_stage(t_process_data *data, int i, int *status, struct rusage *ru);
+
+// pipe_optimize.c
+int			is_plain_stage(t_command *cmd, t_process_data *pd);
+t_command	*unlink_stage(t_process_data *pd, int i);
+void		optimize_pipeline(t_process_data *pd);
+
+// pipe_optimize_helper.c
+void		note_rewrite(t_process_data *pd, const char *rule, t_command *a,
+				t_command *b);
+void		fuse_builtin_stages(t_process_data *pd);
+void		run_prelude(t_command *cmd, t_process_data *pd);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   record.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RECORD_H
+# define RECORD_H
+
+# define RECORD_ENV "MINISHELL_RECORD"
+# define RECORD_MAGIC "MSHREC01"
+# define RECORD_MAGIC_LEN 8
+# define RECORD_CMD 'C'
+# define RECORD_SET 'E'
+# define RECORD_UNSET 'U'
+
+/**
+ * @brief Struct to hold the session recorder of the shell.
+ *
+ * The log starts with RECORD_MAGIC and a RECORD_SET entry for every
+ * variable of the starting environment. Each accepted command line then
+ * adds a RECORD_CMD entry, followed by RECORD_SET and RECORD_UNSET
+ * entries for whatever the line changed in the environment. An entry is
+ * its tag byte and its fields; numbers are LEB128 varints and strings a
+ * varint length and the bytes:
+ *
+ *   RECORD_CMD    start (us since the log began), duration (us),
+ *                 exit status, line
+ *   RECORD_SET    key, value
+ *   RECORD_UNSET  key
+ *
+ * `env` is the environment as of the last entry, to diff against. The
+ * entries of a line are built in `buf` and written with one write().
+ */
+typedef struct s_recorder
+{
+	int			fd;
+	long long	origin_us;
+	long long	start_us;
+	t_env_var	*env;
+	char		*buf;
+	size_t		len;
+	size_t		cap;
+}	t_recorder;
+
+// record.c
+void	record_init(t_process_data *pd);
+void	record_begin(t_process_data *pd);
+void	record_end(t_process_data *pd, const char *line);
+void	free_record(t_process_data *pd);
+
+// record_env.c
+void	record_env_diff(t_recorder *rec, t_env_var *env_list);
+
+// record_encode.c
+void	record_put_byte(t_recorder *rec, unsigned char byte);
+void	record_put_varint(t_recorder *rec, unsigned long long value);
+void	record_put_string(t_recorder *rec, const char *str);
+void	record_flush(t_recorder *rec);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 11:11:42 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/04 09:57:24 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,50 +14,129 @@
 # define REDIRECTION_H
 
 # define MAX_HEREDOCS 16
+# define REDIR_FD_BASE 10
+# define FD_UNSAVED -2
 # include "expander.h"
 
+/** @brief The redirection operators, as told apart by redirect_kind().
+ */
+typedef enum e_redir_kind
+{
+	REDIR_NONE,
+	REDIR_IN,
+	REDIR_OUT,
+	REDIR_APPEND,
+	REDIR_HEREDOC,
+	REDIR_RDWR,
+	REDIR_DUP_IN,
+	REDIR_DUP_OUT,
+	REDIR_HERESTRING
+}	t_redir_kind;
+
+/** @brief What one step of a redirection list does to its descriptor.
+ */
+typedef enum e_fd_op_type
+{
+	FD_OPEN,
+	FD_DUP,
+	FD_CLOSE
+}	t_fd_op_type;
+
+/** @brief One step of a command's redirections, applied in order.
+ *
+ * `fd` is the descriptor being redirected and `name` the word written
+ * after the operator. An FD_OPEN step moves `src`, the target opened
+ * once by handle_redirection() with `flags`, onto `fd`; if `src` is -1,
+ * the target is opened by name when the step is applied, and O_NONBLOCK
+ * in `flags` marks a FIFO held open for reading (see
+ * open_redirect_target()). An FD_DUP step
+ * makes `fd` a copy of descriptor `src`, and an FD_CLOSE step closes it.
+ * `saved` holds the original `fd` while a builtin runs with the
+ * redirection, -1 if it was closed, or FD_UNSAVED.
+ */
+typedef struct s_fd_op
+{
+	t_fd_op_type	type;
+	int				fd;
+	int				src;
+	int				flags;
+	int				saved;
+	char			*name;
+	struct s_fd_op	*next;
+}	t_fd_op;
+
 /** @brief Context structure for handling heredoc input.
  *
  * This structure holds all necessary information for processing
  * a heredoc, including the file descriptor, whether to expand
- * variables, the actual delimiter, and the temporary filename.
+ * variables, the actual delimiter, and the temporary filename. The
+ * body is gathered in `body` (`len` bytes used out of `cap`) and written
+ * out once the delimiter is read. `interactive` is set when the body is
+ * read from a terminal with readline(). `replay` is the rest of a body
+ * read with the script (see sp_take_heredocs()), or NULL.
  */
 typedef struct s_heredoc_context
 {
 	int				fd;
 	int				expand_content;
+	int				interactive;
+	const char		*replay;
 	t_expand_data	*data;
 	char			*actual_delimiter;
 	char			*tmp_filename;
+	char			*body;
+	size_t			len;
+	size_t			cap;
 }	t_heredoc_context;
 
 // heredoc_utils.c
 char	*generate_unique_heredoc_file(int *out_fd);
 void	handle_eof_warning(const char *actual_delimiter);
-char	*expand_heredoc_line(char *line, t_expand_data *data);
-char	*process_variable(char *line, size_t *i, char *result,
-			t_expand_data *data);
-void	cleanup_heredoc(char *line, int fd, char *tmp_filename,
-			char *actual_delimiter);
+void	cleanup_heredoc(char *line, t_heredoc_context *ctx);
+char	*finish_heredoc(t_heredoc_context *ctx);
+
+// heredoc_body.c
+void	heredoc_append(t_heredoc_context *ctx, const char *s, size_t n);
+void	expand_heredoc_line(char *line, t_heredoc_context *ctx);
+char	*read_heredoc_line(t_heredoc_context *ctx);
 
 // heredoc.c
 int		check_heredoc_limit(char *line);
-char	*handle_heredoc(const char *delimiter, t_env_var *env_list,
-			int last_exit_status);
+char	*handle_heredoc(const char *delimiter, t_process_data *pd);
+
+// herestring.c
+int		handle_herestring_redirection(char **args, int i,
+			t_execute_data *exec_data);
 
 // redirection_helper.c 
 int		process_redirection_token(char **args, int i,
 			t_process_data *process_data, t_execute_data *exec_data);
 
 // redirection_utils.c 
-int		is_redirection(const char *token);
-void	open_and_redirect_input(char *input_file);
-int		process_output_file(char *output_file, int is_append);
-void	open_and_redirect_output(char *output_file, int output_mode);
+t_redir_kind	redirect_kind(const char *token, int *fd);
+int				is_redirection(const char *token);
+int				is_fd_number(const char *word);
+int				redirect_open_flags(t_redir_kind kind);
+int				move_to_high_fd(int fd);
+
+// redirection_open.c
+int		open_redirect_target(t_fd_op *op);
+int		ready_redirect_target(t_fd_op *op);
+
+// redirection_plan.c
+t_fd_op	*add_fd_op(t_fd_op **ops, t_fd_op_type type, int fd, char *name);
+void	close_redirect_plan(t_fd_op *ops);
+void	free_fd_ops(t_fd_op **ops);
+int		fd_ops_redirect(t_fd_op *ops, int fd);
+
+// redirection_apply.c
+int		apply_fd_ops(t_fd_op *ops, int save);
+void	restore_fd_ops(t_fd_op *ops);
+void	relocate_plan_fds(t_fd_op *ops);
 
 // redirection.c
 char	**handle_redirection(char **args, t_process_data *process_data,
 			t_execute_data *exec_data);
-void	redirect_io(char *input_file, char *output_file, int output_mode);
+void	redirect_io(t_fd_op *ops);
 
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 14:31:47 by tiyang            #+#    #+#             */
-/*   Updated: 2025/08/30 14:26:00 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,10 @@
 int		signal_event_hook(void);
 void	setup_signal_handlers(void);
 void	handle_parent_sigint(int signum);
+void	handle_stage_sigint(int signum);
 void	print_signal_message(int status);
 void	reset_child_signal_handlers(void);
-int		wait_for_child_and_handle_status(pid_t pid);
+int		get_exit_status(int status);
+int		wait_for_child_and_handle_status(pid_t pid, struct rusage *ru);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATS_H
+# define STATS_H
+
+# define STATS_ENV "MINISHELL_STATS"
+# define STATS_BUCKETS 64
+# define STATS_NAME_MAX 64
+# define STATS_SUB_BITS 4
+# define STATS_SUB 16
+# define STATS_HIST_SIZE 592
+# define STATS_LINE_MAX 256
+
+/**
+ * @brief Struct to hold the statistics of one command name.
+ *
+ * `hist` is an HDR-style latency histogram in microseconds: values below
+ * STATS_SUB get a bucket each, and every power of two above that is split
+ * into STATS_SUB buckets, so any value is known to within about 6%.
+ */
+typedef struct s_cmd_stats
+{
+	char				name[STATS_NAME_MAX];
+	unsigned long		calls;
+	unsigned long		forks;
+	unsigned long		failures;
+	unsigned long long	total_us;
+	unsigned long long	max_us;
+	unsigned int		hist[STATS_HIST_SIZE];
+	struct s_cmd_stats	*next;
+}	t_cmd_stats;
+
+/**
+ * @brief Struct to hold the per-command statistics of the shell.
+ *
+ * `table` is a hash table of `count` entries keyed by command name.
+ * `forks` counts every fork() made by this process; a command's share is
+ * the difference across its run. `dump_path` is MINISHELL_STATS, the file
+ * the shell with pid `owner` writes the table to on exit.
+ */
+typedef struct s_stats
+{
+	t_cmd_stats		*table[STATS_BUCKETS];
+	int				count;
+	unsigned long	forks;
+	pid_t			owner;
+	char			*dump_path;
+}	t_stats;
+
+/**
+ * @brief Struct to hold the state of the stats at the start of a command.
+ */
+typedef struct s_stats_mark
+{
+	long long		start_us;
+	unsigned long	forks;
+}	t_stats_mark;
+
+// stats_table.c
+void				stats_init(t_process_data *pd);
+void				stats_record(t_stats *stats, const char *name,
+						t_stats_mark *mark, int status);
+void				stats_reset(t_stats *stats);
+
+// stats_mark.c
+void				stats_begin(t_process_data *pd, t_stats_mark *mark);
+void				stats_fork(t_stats *stats, int count);
+void				stats_end(t_process_data *pd, t_stats_mark *mark,
+						const char *name, int status);
+void				stats_end_pipeline(t_process_data *pd,
+						t_stats_mark *mark, int status);
+void				free_stats(t_process_data *pd);
+
+// stats_hist.c
+void				stats_hist_add(t_cmd_stats *entry, unsigned long long us);
+unsigned long long	stats_percentile(t_cmd_stats *entry, int permille);
+
+// stats_prometheus.c
+void				write_stats_prometheus(t_stats *stats, int fd);
+
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:03:48 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TIMING_H
+# define TIMING_H
+
+# include <sys/resource.h>
+
+# define TIME_DEFAULT 1
+# define TIME_POSIX 2
+# define TIME_STAGES_MAX 64
+# define TIME_NAME_MAX 32
+# define TIME_OUT_MAX 8192
+# define TIME_FORMAT_DEFAULT "\nreal\t%3lR\nuser\t%3lU\nsys\t%3lS\n\
+rss\t%MkB\nctxsw\t%C\nfaults\t%F"
+# define TIME_FORMAT_POSIX "real %2R\nuser %2U\nsys %2S"
+
+/**
+ * @brief Struct to hold the resource usage reported by `time`.
+ *
+ * Times are in microseconds, max_rss in kilobytes; ctx_switches and
+ * page_faults count both the voluntary and involuntary switches and both
+ * the minor and major faults.
+ */
+typedef struct s_usage
+{
+	long long	user_us;
+	long long	sys_us;
+	long		max_rss;
+	long		ctx_switches;
+	long		page_faults;
+}	t_usage;
+
+/**
+ * @brief Struct to hold the usage of one child reaped by wait4().
+ */
+typedef struct s_stage_usage
+{
+	char	name[TIME_NAME_MAX];
+	int		status;
+	t_usage	usage;
+}	t_stage_usage;
+
+/**
+ * @brief Struct to hold the measurements of one `time`d pipeline.
+ *
+ * While the pipeline runs, pd->timing points here and every child the
+ * shell reaps adds its rusage to `children` and, for the first
+ * TIME_STAGES_MAX of them, to `stages`. The shell's own usage (builtins,
+ * functions) is taken from getrusage() at both ends. `prev` is the
+ * enclosing `time`, if any, which gets the children's usage too.
+ */
+typedef struct s_timing
+{
+	int				mode;
+	int				is_pipeline;
+	long long		start_us;
+	long long		real_us;
+	struct rusage	self_start;
+	t_usage			children;
+	t_usage			total;
+	int				stage_count;
+	t_stage_usage	stages[TIME_STAGES_MAX];
+	struct s_timing	*prev;
+}	t_timing;
+
+/**
+ * @brief Struct to hold the text of a `time` report being built.
+ */
+typedef struct s_time_out
+{
+	char	data[TIME_OUT_MAX];
+	size_t	len;
+}	t_time_out;
+
+// timing.c
+t_timing	*start_timing(t_ast_node *node, t_process_data *pd);
+void		record_child_usage(t_timing *timing, char **args, int status,
+				struct rusage *ru);
+void		finish_timing(t_timing *timing, t_process_data *pd);
+void		free_timing(t_process_data *pd);
+
+// timing_usage.c
+long long	timing_clock_us(void);
+void		usage_from_rusage(t_usage *usage, struct rusage *ru);
+void		add_usage(t_usage *dst, t_usage *src);
+void		usage_since(t_usage *usage, struct rusage *start);
+
+// timing_format.c
+void		time_append(t_time_out *out, const char *str, size_t len);
+void		format_timing(t_time_out *out, const char *fmt, t_timing *t);
+
+// timing_report.c
+long long	timing_field(t_timing *t, char c);
+void		report_timing(t_timing *timing, t_process_data *pd);
+
+#endif
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 09:26:40 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 20:13:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TRACE_H
+# define TRACE_H
+
+# define TRACE_ENV "MINISHELL_TRACE"
+# define TRACE_EVENTS 1024
+# define TRACE_LINE_MAX 192
+# define TRACE_NOTE_MAX 96
+
+/** @brief Phases of running a command line, as recorded by trace_mark().
+ *
+ * TRACE_IDLE marks the time between command lines (or after the last
+ * phase of a process) and is not written out.
+ */
+typedef enum e_trace_phase
+{
+	TRACE_IDLE,
+	TRACE_PRECHECK,
+	TRACE_PARSE,
+	TRACE_EXPAND,
+	TRACE_REDIRECT,
+	TRACE_PATH,
+	TRACE_BUILTIN,
+	TRACE_FORK,
+	TRACE_EXEC,
+	TRACE_WAIT
+}	t_trace_phase;
+
+/** @brief Struct to represent the start of a phase.
+ */
+typedef struct s_trace_mark
+{
+	t_trace_phase	phase;
+	long long		ns;
+}	t_trace_mark;
+
+/**
+ * @brief Struct to hold the phase tracer of one shell process.
+ *
+ * Each mark starts a phase and ends the one before, so recording a phase
+ * costs one clock_gettime() and no allocation. The marks are kept in a
+ * buffer allocated once and written out as Chrome trace events (which
+ * Perfetto reads too) whenever it fills up and at exit. `out` is the
+ * preallocated text of one such flush. Only the shell that opened the
+ * file (`is_root`) closes the JSON array; forked children append to it.
+ */
+typedef struct s_trace
+{
+	int				fd;
+	pid_t			pid;
+	int				is_root;
+	int				count;
+	t_trace_mark	marks[TRACE_EVENTS];
+	char			out[TRACE_EVENTS * TRACE_LINE_MAX];
+}	t_trace;
+
+// trace.c
+void			trace_init(t_process_data *pd);
+void			trace_mark(t_trace *trace, t_trace_phase phase);
+void			trace_child(t_trace *trace);
+void			free_trace(t_process_data *pd);
+
+// trace_flush.c
+const char	*trace_phase_name(t_trace_phase phase);
+void			trace_flush(t_trace *trace);
+void			trace_exec(t_trace *trace);
+
+// trace_note.c
+void			trace_note(t_trace *trace, const char *name,
+					const char *detail);
+
+#endif
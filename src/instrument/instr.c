@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instr.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the counters of an instrumented build.
+ *
+ * @return The single, zero-initialised instance.
+ */
+t_instr	*instr_state(void)
+{
+	static t_instr	state;
+
+	return (&state);
+}
+
+/**
+ * @brief Switches the phase that counts are charged to.
+ *
+ * Going idle ends a command line: its counters become the ones
+ * `shellstat` reports for the last line, and a new line starts from
+ * zero.
+ *
+ * @param phase The phase starting now.
+ */
+void	instr_phase(t_trace_phase phase)
+{
+	t_instr	*state;
+
+	if (!INSTRUMENT)
+		return ;
+	state = instr_state();
+	state->phase = phase;
+	if (phase != TRACE_IDLE)
+		return ;
+	state->last_line = state->line;
+	ft_bzero(&state->line, sizeof(t_instr_counts));
+}
+
+/**
+ * @brief Counts an allocation of `size` bytes.
+ */
+void	instr_count_alloc(size_t size)
+{
+	t_instr	*state;
+
+	state = instr_state();
+	state->phases[state->phase].allocs++;
+	state->phases[state->phase].bytes += size;
+	state->line.allocs++;
+	state->line.bytes += size;
+}
+
+/**
+ * @brief Counts a free(), unless it is given NULL.
+ */
+void	instr_count_free(void *ptr)
+{
+	t_instr	*state;
+
+	if (ptr == NULL)
+		return ;
+	state = instr_state();
+	state->phases[state->phase].frees++;
+	state->line.frees++;
+}
+
+/**
+ * @brief Counts a call to one of the wrapped syscalls.
+ */
+void	instr_count_call(t_instr_call call)
+{
+	t_instr	*state;
+
+	state = instr_state();
+	state->phases[state->phase].calls[call]++;
+	state->line.calls[call]++;
+}
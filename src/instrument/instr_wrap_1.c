@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instr_wrap_1.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Counts a malloc() and forwards it.
+ *
+ * Only linked into `make instrument` builds, where `ld --wrap` sends
+ * every call the shell and libft make to a wrapped function here first;
+ * the __real_ name reaches libc.
+ */
+void	*__wrap_malloc(size_t size)
+{
+	instr_count_alloc(size);
+	return (__real_malloc(size));
+}
+
+/**
+ * @brief Counts a realloc() as a free and an allocation, and forwards it.
+ */
+void	*__wrap_realloc(void *ptr, size_t size)
+{
+	instr_count_free(ptr);
+	instr_count_alloc(size);
+	return (__real_realloc(ptr, size));
+}
+
+/**
+ * @brief Counts a free() and forwards it.
+ */
+void	__wrap_free(void *ptr)
+{
+	instr_count_free(ptr);
+	__real_free(ptr);
+}
+
+/**
+ * @brief Counts an access() and forwards it.
+ */
+int	__wrap_access(const char *path, int mode)
+{
+	instr_count_call(INSTR_ACCESS);
+	return (__real_access(path, mode));
+}
+
+/**
+ * @brief Counts a stat() and forwards it.
+ */
+int	__wrap_stat(const char *path, struct stat *buf)
+{
+	instr_count_call(INSTR_STAT);
+	return (__real_stat(path, buf));
+}
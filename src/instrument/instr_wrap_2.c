@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instr_wrap_2.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <stdarg.h>
+
+/**
+ * @brief Counts an open() and forwards it.
+ */
+int	__wrap_open(const char *path, int flags, ...)
+{
+	va_list	ap;
+	int		mode;
+
+	instr_count_call(INSTR_OPEN);
+	mode = 0;
+	if (flags & O_CREAT)
+	{
+		va_start(ap, flags);
+		mode = va_arg(ap, int);
+		va_end(ap);
+	}
+	return (__real_open(path, flags, mode));
+}
+
+/**
+ * @brief Counts a close() and forwards it.
+ */
+int	__wrap_close(int fd)
+{
+	instr_count_call(INSTR_CLOSE);
+	return (__real_close(fd));
+}
+
+/**
+ * @brief Counts a dup() and forwards it.
+ */
+int	__wrap_dup(int fd)
+{
+	instr_count_call(INSTR_DUP);
+	return (__real_dup(fd));
+}
+
+/**
+ * @brief Counts a dup2() and forwards it.
+ */
+int	__wrap_dup2(int fd, int fd2)
+{
+	instr_count_call(INSTR_DUP2);
+	return (__real_dup2(fd, fd2));
+}
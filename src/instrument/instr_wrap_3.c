@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instr_wrap_3.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:37 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Counts a pipe() and forwards it.
+ */
+int	__wrap_pipe(int fds[2])
+{
+	instr_count_call(INSTR_PIPE);
+	return (__real_pipe(fds));
+}
+
+/**
+ * @brief Counts a fork() and forwards it.
+ */
+pid_t	__wrap_fork(void)
+{
+	instr_count_call(INSTR_FORK);
+	return (__real_fork());
+}
+
+/**
+ * @brief Counts a read() and forwards it.
+ */
+ssize_t	__wrap_read(int fd, void *buf, size_t n)
+{
+	instr_count_call(INSTR_READ);
+	return (__real_read(fd, buf, n));
+}
+
+/**
+ * @brief Counts a write() and forwards it.
+ */
+ssize_t	__wrap_write(int fd, const void *buf, size_t n)
+{
+	instr_count_call(INSTR_WRITE);
+	return (__real_write(fd, buf, n));
+}
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/04 13:09:59 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 11:32:40 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 16:04:37 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,12 @@ volatile sig_atomic_t	g_signal_received = 0;
 
 /**
  * @brief Runs the shell in non-interactive mode, reading from stdin.
- *        Each line is executed as a command until EOF.
+ *        Each line is executed as a command until EOF; a line opening a
+ *        compound command pulls in the lines that complete it. What
+ *        `read` took from the script is not read again: it comes out of
+ *        the reader's read-ahead first (see read_next_char()), and what
+ *        it read past that is handed back to the file before the next
+ *        line is read.
  * Frees each line after processing.
  * Sets last_exit_status in process_data.
  * @param process_data Pointer to the process data structure.
@@ -27,15 +32,24 @@ static void	run_non_interactive_shell(t_process_data *process_data)
 	char	*line;
 	char	*nl;
 
+	fstat(STDIN_FILENO, &process_data->script_st);
 	line = get_next_line(STDIN_FILENO);
 	while (line != NULL)
 	{
 		nl = ft_strchr(line, '\n');
 		if (nl)
 			*nl = '\0';
-		if (*line)
+		record_begin(process_data);
+		if (*line && is_compound_input(line))
+			(void)run_script_input(line, 0, process_data);
+		else if (*line)
 			(void)execute_command(line, process_data->env_list, process_data);
+		if (*line)
+			record_end(process_data, line);
+		trace_mark(process_data->trace, TRACE_IDLE);
 		free(line);
+		sync_read_buffer(process_data);
+		line = get_next_line(STDIN_FILENO);
 	}
 }
 
@@ -75,9 +89,12 @@ static int	process_shell_input(char *input, t_process_data *process_data)
 	skip_spaces(&line_ptr);
 	if (*line_ptr == '\0')
 		return (0);
+	if (is_compound_input(input))
+		return (run_script_input(input, 1, process_data), 1);
+	trace_mark(process_data->trace, TRACE_PRECHECK);
 	if (!precheck_redir_syntax(input, process_data))
 		return (0);
-	add_history(input);
+	history_add(process_data, input);
 	if (execute_command(input, process_data->env_list, process_data) == -1)
 	{
 		ft_error("execute_command", "failed to execute command");
@@ -89,6 +106,7 @@ static int	process_shell_input(char *input, t_process_data *process_data)
 /**
  * @brief Runs the shell in interactive mode with a prompt.
  *        Handles SIGINT to interrupt input and reset the prompt.
+ *        Accepted lines go to the session log, if one is being kept.
  *
  * @param process_data Pointer to the process data structure.
  * @return The last exit status of the shell session.
@@ -110,8 +128,11 @@ static int	run_interactive_shell(t_process_data *process_data)
 		}
 		if (handle_signal_interrupt(process_data, input))
 			continue ;
-		if (*input && g_signal_received != SIGINT)
-			(void)process_shell_input(input, process_data);
+		record_begin(process_data);
+		if (*input && g_signal_received != SIGINT
+			&& process_shell_input(input, process_data))
+			record_end(process_data, input);
+		trace_mark(process_data->trace, TRACE_IDLE);
 		free(input);
 	}
 	return (process_data->last_exit_status);
@@ -133,12 +154,20 @@ int	main(int argc, char **argv, char **envp)
 
 	(void)argc;
 	(void)argv;
+	ft_bzero(&process_data, sizeof(t_process_data));
 	process_data.env_list = init_env(envp);
 	bootstrap_env_if_empty(&process_data.env_list);
+	trace_init(&process_data);
+	stats_init(&process_data);
+	record_init(&process_data);
 	process_data.last_exit_status = 0;
 	setup_signal_handlers();
 	if (isatty(STDIN_FILENO))
+	{
+		history_init(&process_data);
+		completion_init(&process_data);
 		process_data.last_exit_status = run_interactive_shell(&process_data);
+	}
 	else
 		run_non_interactive_shell(&process_data);
 	get_next_line_cleanup();
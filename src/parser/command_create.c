@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/26 10:49:56 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 09:58:01 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:10:41 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,8 @@
  * @brief Searches for the command in the PATH directories.
  * 
  * This function attempts to find the full path of the command specified
- * in `cmd->args[0]` by searching through the provided `path_dirs`.
+ * in `cmd->args[0]` by searching through the provided `path_dirs`, or
+ * through the command's own `PATH=` prefix assignment if it has one.
  * If found, it sets `cmd->cmd_path` to the full path; otherwise, it
  * leaves it as NULL.
  * @param cmd       Pointer to the command structure to update.
@@ -26,7 +27,13 @@
  */
 static int	search_command_in_path(t_command *cmd, char **path_dirs)
 {
+	char	**own_dirs;
+
+	own_dirs = prefix_path_dirs(cmd->env_prefix);
+	if (own_dirs != NULL)
+		path_dirs = own_dirs;
 	cmd->cmd_path = find_full_cmd_path(cmd->args[0], path_dirs);
+	free_split(own_dirs);
 	if (cmd->cmd_path == NULL)
 		return (-1);
 	return (0);
@@ -96,17 +103,13 @@ static int	parse_args_and_redirection(t_command *cmd, char **tokens,
 	original_args = duplicate_split(tokens);
 	if (original_args == NULL)
 		return (-1);
-	exec_data.input_file = NULL;
-	exec_data.output_file = NULL;
+	exec_data.fd_ops = NULL;
 	exec_data.heredoc_file = NULL;
-	exec_data.output_mode = 0;
 	cmd->args = handle_redirection(original_args, process_data, &exec_data);
 	free_split(original_args);
 	if (cmd->args == NULL)
 		return (cleanup_and_return_error(exec_data));
-	cmd->input_file = exec_data.input_file;
-	cmd->output_file = exec_data.output_file;
-	cmd->output_mode = exec_data.output_mode;
+	cmd->fd_ops = exec_data.fd_ops;
 	cmd->heredoc_file = exec_data.heredoc_file;
 	if (cmd->args[0] == NULL)
 		return (1);
@@ -121,7 +124,7 @@ static int	parse_args_and_redirection(t_command *cmd, char **tokens,
  * @return A pointer to the newly created `t_command` structure,
  *         or NULL on memory allocation failure.
  */
-static t_command	*create_empty_command(void)
+t_command	*create_empty_command(void)
 {
 	t_command	*cmd;
 
@@ -130,10 +133,11 @@ static t_command	*create_empty_command(void)
 		return (NULL);
 	cmd->args = NULL;
 	cmd->cmd_path = NULL;
-	cmd->input_file = NULL;
-	cmd->output_file = NULL;
-	cmd->output_mode = 0;
+	cmd->fd_ops = NULL;
 	cmd->heredoc_file = NULL;
+	cmd->node = NULL;
+	cmd->prelude = NULL;
+	cmd->env_prefix = NULL;
 	return (cmd);
 }
 
@@ -142,7 +146,7 @@ static t_command	*create_empty_command(void)
  * 
  * This function creates a `t_command` structure, parses the provided
  * tokens to separate command arguments and redirections, and searches
- * for the command in the PATH if it's not a built-in.
+ * for the command in the PATH if it's not a function or a built-in.
  * @param tokens       Array of strings representing the command and its
  *                     arguments, including redirection operators.
  * @param path_dirs    NULL-terminated array of directories from the PATH
@@ -171,7 +175,10 @@ t_command	*create_command(char **tokens, char **path_dirs,
 	}
 	if (redir_parse_result == 1)
 		return (cmd);
-	if (!is_builtin(cmd->args[0]))
+	cmd->env_prefix = split_env_prefix(cmd->args);
+	trace_mark(process_data->trace, TRACE_PATH);
+	if (!find_function(process_data, cmd->args[0])
+		&& !is_builtin(cmd->args))
 		search_command_in_path(cmd, path_dirs);
 	return (cmd);
 }
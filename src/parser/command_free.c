@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/26 11:22:23 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 09:57:02 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 11:37:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,12 +25,11 @@ void	free_command(t_command *cmd)
 	if (cmd == NULL)
 		return ;
 	free_split(cmd->args);
+	free_split(cmd->env_prefix);
+	free_command(cmd->prelude);
+	free_fd_ops(&cmd->fd_ops);
 	if (cmd->cmd_path != NULL)
 		free(cmd->cmd_path);
-	if (cmd->input_file != NULL)
-		free(cmd->input_file);
-	if (cmd->output_file != NULL)
-		free(cmd->output_file);
 	if (cmd->heredoc_file != NULL)
 	{
 		unlink(cmd->heredoc_file);
@@ -43,16 +42,15 @@ void	free_command(t_command *cmd)
  * @brief Frees allocated resources and returns an error code.
  *
  * This function centralizes the cleanup for redirection parsing failures.
- * It frees allocated memory for input, output, and heredoc files, and
- * unlinks the heredoc file from the filesystem.
+ * It frees the redirection list and the heredoc file name, and unlinks
+ * the heredoc file from the filesystem.
  *
  * @param exec_data The structure containing the file paths to free.
  * @return Returns -1 to signal a failure to the calling function.
  */
 int	cleanup_and_return_error(t_execute_data exec_data)
 {
-	free(exec_data.input_file);
-	free(exec_data.output_file);
+	free_fd_ops(&exec_data.fd_ops);
 	if (exec_data.heredoc_file)
 	{
 		unlink(exec_data.heredoc_file);
@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/08/04 12:13:56 by makhudon      #+#    #+#                 */
-/*   Updated: 2025/09/08 12:46:09 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 15:42:17 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -37,7 +37,7 @@ static size_t	process_next_segment(const char *input, size_t i, char **result,
 		if (next_char == '\'' || next_char == '"')
 			return (i + 1);
 		if (ft_isalnum(next_char) || next_char == '_'
-			|| next_char == '?' || next_char == '{')
+			|| ft_strchr("?{#@*", next_char))
 		{
 			return (handle_variable_expansion(input, i, result,
 					data->exp_data));
@@ -64,13 +64,13 @@ static size_t	process_next_segment(const char *input, size_t i, char **result,
  * allocated string with all expansions applied.
  * 
  * @param input The input string containing potential variables to expand.
- * @param env_list The linked list of environment variables for expansion.
- * @param last_exit_status The last exit status for special variable expansion.
+ * @param pd The process data: variables, last exit status and the current
+ *           function call for positional parameters.
  * @param quote The quote type context (not used in current implementation).
  * @return A newly allocated string with expanded variables, or NULL on failure.
  */
-char	*expand_variables(char *input, t_env_var *env_list,
-							int last_exit_status, t_quote_type quote)
+char	*expand_variables(char *input, t_process_data *pd,
+							t_quote_type quote)
 {
 	char			*result;
 	size_t			i;
@@ -78,8 +78,7 @@ char	*expand_variables(char *input, t_env_var *env_list,
 	t_exp_proc_data	proc_data;
 
 	(void)quote;
-	expand_data.env_list = env_list;
-	expand_data.last_exit_status = last_exit_status;
+	fill_expand_data(&expand_data, pd);
 	proc_data.exp_data = &expand_data;
 	result = ft_strdup("");
 	if (result == NULL)
@@ -215,6 +214,7 @@ char	**expand_and_split_args(t_token **tokens, t_process_data *pdata)
 	t_append_info	arg_info;
 	int				i;
 
+	trace_mark(pdata->trace, TRACE_EXPAND);
 	arg_info.array = NULL;
 	arg_info.count = 0;
 	i = 0;
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_array.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:48:19 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Expands the subscript of `${name[sub]}`: its `$` expansions are
+ * done and its quotes removed, so `${m["$k"]}` looks up the value of k.
+ *
+ * @param raw The subscript as written.
+ * @param len Its length.
+ * @param data The expansion data.
+ * @return The subscript, newly allocated; exits on allocation failure.
+ */
+static char	*expand_subscript(const char *raw, size_t len,
+		t_expand_data *data)
+{
+	char	*text;
+	char	*out;
+	char	*sub;
+	size_t	i;
+
+	text = ft_substr(raw, 0, len);
+	out = ft_strdup("");
+	i = 0;
+	while (text != NULL && out != NULL && text[i] != '\0')
+	{
+		if (text[i] == '$' && text[i + 1] != '\0')
+			i = handle_variable_expansion(text, i, &out, data);
+		else
+			out = append_char(out, text[i++]);
+	}
+	sub = NULL;
+	if (out != NULL)
+		sub = remove_quotes_and_join(out);
+	free(text);
+	free(out);
+	if (sub == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (sub);
+}
+
+/**
+ * @brief Parses the `[subscript]` of a braced expansion.
+ *
+ * @param input The string being expanded.
+ * @param pos The index of the `[`; moved past the `]`.
+ * @param b Receives the expanded subscript.
+ * @param data The expansion data.
+ * @return 1 on success, 0 if the `]` is missing.
+ */
+static int	parse_subscript(const char *input, size_t *pos, t_braced *b,
+		t_expand_data *data)
+{
+	size_t	start;
+	size_t	close;
+
+	start = *pos + 1;
+	close = start;
+	while (input[close] != '\0' && input[close] != ']')
+		close++;
+	if (input[close] != ']')
+		return (0);
+	b->sub = expand_subscript(input + start, close - start, data);
+	*pos = close + 1;
+	return (1);
+}
+
+/**
+ * @brief Parses a braced expansion: an optional `#` or `!`, a name (or
+ * one of the special parameters) and an optional `[subscript]`.
+ *
+ * @param input The string being expanded.
+ * @param i The index of the `$`.
+ * @param b Receives the parts; the caller frees `name` and `sub`.
+ * @param data The expansion data, for the subscript.
+ * @return 1 if the expansion is well formed, 0 otherwise.
+ */
+static int	parse_braced(const char *input, size_t i, t_braced *b,
+		t_expand_data *data)
+{
+	size_t	p;
+	size_t	close;
+
+	ft_bzero(b, sizeof(t_braced));
+	p = i + 2;
+	if ((input[p] == '#' || input[p] == '!') && input[p + 1] != '}')
+		b->op = input[p++];
+	close = p;
+	while (ft_isalnum(input[close]) || input[close] == '_')
+		close++;
+	if (close == p && input[p] != '\0' && ft_strchr("?#@*", input[p]))
+		close++;
+	b->name = ft_substr(input, p, close - p);
+	if (close == p || b->name == NULL)
+		return (0);
+	if (input[close] == '[' && !parse_subscript(input, &close, b, data))
+		return (0);
+	b->end = close + 1;
+	return (input[close] == '}');
+}
+
+/**
+ * @brief Measures a reference `${name[@]}`, or one to the positional
+ * parameters (`$@` or `${@}`), at the start of `s`.
+ *
+ * @param s The text.
+ * @return Its length, or 0 if `s` does not start with one.
+ */
+size_t	array_ref_len(const char *s)
+{
+	size_t	i;
+
+	if (ft_strncmp(s, "$@", 2) == 0)
+		return (2);
+	if (ft_strncmp(s, "${@}", 4) == 0)
+		return (4);
+	if (ft_strncmp(s, "${", 2) != 0 || !(ft_isalpha(s[2]) || s[2] == '_'))
+		return (0);
+	i = 3;
+	while (ft_isalnum(s[i]) || s[i] == '_')
+		i++;
+	if (ft_strncmp(s + i, "[@]}", 4) != 0)
+		return (0);
+	return (i + 4);
+}
+
+/**
+ * @brief Expands a braced expansion that expand_braced_variable() does
+ * not handle itself; see braced_value().
+ *
+ * A malformed one is kept as it is written.
+ *
+ * @param input The string being expanded.
+ * @param i The index of the `$`.
+ * @param result Pointer to the result string being built.
+ * @param data The expansion data.
+ * @return The index in the input string after the expansion.
+ */
+int	expand_braced_special(const char *input, size_t i, char **result,
+		t_expand_data *data)
+{
+	t_braced	b;
+	char		*value;
+	char		*tmp;
+
+	if (!parse_braced(input, i, &b, data))
+	{
+		free(b.name);
+		free(b.sub);
+		*result = append_char(*result, input[i]);
+		return (i + 1);
+	}
+	value = braced_value(b.name, b.sub, b.op, data);
+	free(b.name);
+	free(b.sub);
+	if (value == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	tmp = ft_strjoin(*result, value);
+	free(*result);
+	free(value);
+	*result = tmp;
+	return (b.end);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_array_value.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Gets `${name[sub]}`, or `${name}` when `sub` is NULL.
+ *
+ * A variable that is not an array acts as an array holding its value at
+ * index 0, as in bash.
+ *
+ * @param name The variable name.
+ * @param sub The expanded subscript, or NULL.
+ * @param data The expansion data.
+ * @return A newly allocated string, empty if the element is not set.
+ */
+static char	*element_value(const char *name, const char *sub,
+		t_expand_data *data)
+{
+	t_array	*arr;
+
+	arr = find_array(data->arrays, name);
+	if (sub == NULL)
+		return (get_var_value(name, data));
+	if (arr != NULL)
+		return (array_element(arr, sub, data));
+	if (ft_strchr("@*", sub[0]) && sub[1] == '\0')
+		return (get_var_value(name, data));
+	if (array_index(sub, data) == 0)
+		return (get_var_value(name, data));
+	return (ft_strdup(""));
+}
+
+/**
+ * @brief Applies the operator of `${#...}` or `${!...}` to a value.
+ *
+ * @param value The value of the variable or element; freed here.
+ * @param op '#' or '!'.
+ * @param all Whether the subscript was `@` or `*`.
+ * @param data The expansion data.
+ * @return A newly allocated string.
+ */
+static char	*apply_operator(char *value, char op, int all,
+		t_expand_data *data)
+{
+	char	*result;
+
+	if (op == '#' && all)
+		result = ft_itoa(value[0] != '\0');
+	else if (op == '#')
+		result = ft_itoa(ft_strlen(value));
+	else if (is_valid_identifier(value))
+		result = element_value(value, NULL, data);
+	else
+		result = ft_strdup("");
+	free(value);
+	return (result);
+}
+
+/**
+ * @brief Computes a braced expansion that is not a plain `${name}`:
+ * `${name[sub]}`, `${#name}` (the length), `${#name[@]}` (the number of
+ * elements), `${!name[@]}` (the keys) or `${!name}` (the variable named
+ * by the value of name).
+ *
+ * @param name The variable name.
+ * @param sub The expanded subscript, or NULL.
+ * @param op '#', '!' or 0 for none.
+ * @param data The expansion data.
+ * @return A newly allocated string, or NULL on allocation failure.
+ */
+char	*braced_value(const char *name, const char *sub, char op,
+		t_expand_data *data)
+{
+	t_array	*arr;
+	char	**list;
+	char	*value;
+	int		all;
+
+	arr = find_array(data->arrays, name);
+	all = (sub != NULL && ft_strchr("@*", sub[0]) && sub[1] == '\0');
+	if (op == '#' && all && arr != NULL)
+		return (ft_itoa(arr->count));
+	if (op == '!' && all)
+	{
+		if (arr == NULL)
+			return (ft_strdup(""));
+		list = array_list(arr, 1);
+		value = join_words(list);
+		free_split(list);
+		return (value);
+	}
+	value = element_value(name, sub, data);
+	if (value == NULL || op == 0)
+		return (value);
+	return (apply_operator(value, op, all, data));
+}
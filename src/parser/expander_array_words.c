@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_array_words.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 15:42:17 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:48:19 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Finds a `${name[@]}` (or `$@`) inside double quotes in a word.
+ *
+ * @param word The word, as written.
+ * @param start Receives the index of the `$`.
+ * @param end Receives the index after the `}`.
+ * @return 1 if one was found, 0 otherwise.
+ */
+static int	find_quoted_ref(const char *word, size_t *start, size_t *end)
+{
+	size_t	i;
+	char	quote;
+
+	quote = 0;
+	i = 0;
+	while (word[i] != '\0')
+	{
+		if (quote == 0 && (word[i] == '\'' || word[i] == '"'))
+			quote = word[i];
+		else if (word[i] == quote)
+			quote = 0;
+		else if (quote == '"' && array_ref_len(word + i) > 0)
+		{
+			*start = i;
+			*end = i + array_ref_len(word + i);
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Expands the part of a word before or after `"${name[@]}"`.
+ *
+ * The part is cut inside the double quotes, so the quote is closed (or
+ * reopened) first.
+ *
+ * @param part The part, as written.
+ * @param len Its length.
+ * @param after Whether the part follows the reference.
+ * @param pd The process data.
+ * @return The expanded part, newly allocated; exits on allocation failure.
+ */
+static char	*expand_fragment(const char *part, size_t len, int after,
+		t_process_data *pd)
+{
+	char	*raw;
+	char	*cut;
+	char	*expanded;
+	char	*word;
+
+	cut = ft_substr(part, 0, len);
+	raw = NULL;
+	if (cut != NULL && after)
+		raw = ft_strjoin("\"", cut);
+	else if (cut != NULL)
+		raw = ft_strjoin(cut, "\"");
+	expanded = NULL;
+	if (raw != NULL)
+		expanded = expand_variables(raw, pd, DOUBLE_QUOTE);
+	word = NULL;
+	if (expanded != NULL)
+		word = remove_quotes_and_join(expanded);
+	free(cut);
+	free(raw);
+	free(expanded);
+	if (word == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (word);
+}
+
+/**
+ * @brief Attaches the text around `"${name[@]}"` to the first and the
+ * last element.
+ *
+ * @param list The elements; updated in place.
+ * @param pre The text before; freed here.
+ * @param suf The text after; freed here.
+ * @return The words, NULL-terminated; exits on allocation failure.
+ */
+static char	**attach_fragments(char **list, char *pre, char *suf)
+{
+	size_t	n;
+	char	*tmp;
+
+	n = 0;
+	while (list[n] != NULL)
+		n++;
+	if (n == 0)
+		return (free(pre), free(suf), list);
+	tmp = list[0];
+	list[0] = ft_strjoin(pre, tmp);
+	free(tmp);
+	tmp = list[n - 1];
+	list[n - 1] = ft_strjoin(tmp, suf);
+	free(tmp);
+	if (list[0] == NULL || list[n - 1] == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	free(pre);
+	free(suf);
+	return (list);
+}
+
+/**
+ * @brief Lists what `"${name[@]}"` expands to: the elements of an array,
+ * or the value of a variable that is set, or nothing. `"$@"` expands to
+ * the positional parameters.
+ *
+ * @param token The word holding the reference.
+ * @param start The index of the `$`.
+ * @param end The index after the `}`.
+ * @param pd The process data.
+ * @return The elements, NULL-terminated; exits on allocation failure.
+ */
+static char	**ref_elements(t_token *token, size_t start, size_t end,
+		t_process_data *pd)
+{
+	char		*name;
+	t_array		*arr;
+	t_env_var	*var;
+	char		**list;
+
+	if (token->value[start + 1] == '@' || token->value[start + 2] == '@')
+		return (param_list(pd->frame));
+	name = ft_substr(token->value, start + 2, end - start - 6);
+	if (name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	arr = find_array(pd->arrays, name);
+	var = find_shell_var(name, pd);
+	free(name);
+	if (arr != NULL)
+		return (array_list(arr, 0));
+	list = ft_calloc(2, sizeof(char *));
+	if (list == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	if (var != NULL && var->value != NULL)
+		list[0] = ft_strdup(var->value);
+	if (var != NULL && var->value != NULL && list[0] == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	return (list);
+}
+
+/**
+ * @brief Expands a word holding `"${name[@]}"` into one word per element,
+ * without splitting the elements, as bash does; `"$@"` likewise gives one
+ * word per positional parameter.
+ *
+ * Only the first such reference of a word is expanded this way; the text
+ * around it sticks to the first and the last element. With no elements
+ * the word disappears, unless there is text around it: that is left to
+ * the usual expansion.
+ *
+ * @param token The word.
+ * @param pd The process data.
+ * @param out Receives the words.
+ * @return 1 if the word was expanded here, 0 if it must be expanded the
+ *         usual way.
+ */
+int	expand_array_words(t_token *token, t_process_data *pd, char ***out)
+{
+	size_t	start;
+	size_t	end;
+	char	*pre;
+	char	*suf;
+	char	**list;
+
+	if (!find_quoted_ref(token->value, &start, &end))
+		return (0);
+	list = ref_elements(token, start, end, pd);
+	pre = expand_fragment(token->value, start, 0, pd);
+	suf = expand_fragment(token->value + end, ft_strlen(token->value + end),
+			1, pd);
+	if (list[0] == NULL && (pre[0] != '\0' || suf[0] != '\0'))
+	{
+		free(list);
+		free(pre);
+		free(suf);
+		return (0);
+	}
+	*out = attach_fragments(list, pre, suf);
+	return (1);
+}
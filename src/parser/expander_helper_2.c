@@ -6,14 +6,14 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/05 10:39:19 by makhudon          #+#    #+#             */
-/*   Updated: 2025/08/30 14:41:01 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Handles special variable cases like $?, $$, and $0.
+ * @brief Handles one-character variables like $?, $0, $1 and $#.
  * 
  * This function processes special variables and appends their values
  * to the result string.
@@ -32,7 +32,7 @@ static int	handle_special_var(const char *input, size_t start,
 	char	*tmp;
 
 	var_name = ft_strndup(&input[start], 1);
-	value = get_var_value(var_name, data->env_list, data->last_exit_status);
+	value = get_var_value(var_name, data);
 	tmp = ft_strjoin(*result, value);
 	free(*result);
 	*result = tmp;
@@ -59,7 +59,7 @@ int	expand_simple_variable(const char *input, size_t i,
 	size_t	start;
 
 	start = i + 1;
-	if (input[start] == '?' || input[start] == '$' || input[start] == '0')
+	if (ft_isdigit(input[start]) || ft_strchr("?$#@*", input[start]))
 		return (handle_special_var(input, start, result, data));
 	else if ((input[start] >= 'A' && input[start] <= 'Z')
 		|| (input[start] >= 'a' && input[start] <= 'z') || input[start] == '_')
@@ -69,48 +69,54 @@ int	expand_simple_variable(const char *input, size_t i,
 }
 
 /**
- * @brief Retrieves the value of a special variable like $?, $$, or $0.
+ * @brief Retrieves the value of a special variable like $?, $0 or $1.
  * 
  * This function checks for special variable names and returns their
  * corresponding values. If the variable is not special, it returns NULL.
- * @param var_name The name of the variable (e.g., "?", "$", "0").
- * @param last_exit_status The last exit status to use for $?.
+ * @param var_name The name of the variable (e.g., "?", "0", "1", "#").
+ * @param data The expansion data with the last exit status and the
+ * current function call.
  * @return A newly allocated string with the variable's value,
  * or NULL if the variable is not special.
  */
-static char	*get_special_var_value(const char *var_name, int last_exit_status)
+static char	*get_special_var_value(const char *var_name, t_expand_data *data)
 {
 	if (ft_strncmp(var_name, "?", 2) == 0)
-		return (ft_itoa(last_exit_status));
+		return (ft_itoa(data->last_exit_status));
 	if (ft_strncmp(var_name, "0", 2) == 0)
 		return (ft_strdup("minishell"));
-	return (NULL);
+	return (get_positional_value(var_name, data->frame));
 }
 
 /**
  * @brief Retrieves the value of an environment variable.
  * 
  * This function first checks for special variables like $?, $$, and $0.
- * If not special, it looks up the variable in the provided environment
- * list. If found, it returns its value; otherwise, it returns an empty
- * string.
+ * If not special, it looks up the variable among the arrays (whose
+ * element 0 it gives), the exported, then the shell-local variables. If
+ * found, it returns its value; otherwise, it returns an empty string.
  * @param var_name The name of the variable to look up.
- * @param env_list The linked list of environment variables.
- * @param last_exit_status The last exit status for $?.
+ * @param data The expansion data with the variables, the last exit status
+ * and the current function call.
  * @return A newly allocated string with the variable's value,
  * or an empty string if not found.
  */
-char	*get_var_value(const char *var_name,
-								t_env_var *env_list, int last_exit_status)
+char	*get_var_value(const char *var_name, t_expand_data *data)
 {
 	t_env_var	*env_var;
+	t_array		*arr;
 	char		*value;
 
-	value = get_special_var_value(var_name, last_exit_status);
+	value = get_special_var_value(var_name, data);
 	if (value != NULL)
 		return (value);
-	env_var = find_env_var(var_name, env_list);
-	if (env_var != NULL)
+	arr = find_array(data->arrays, var_name);
+	if (arr != NULL)
+		return (array_element(arr, "0", data));
+	env_var = find_env_var(var_name, data->env_list);
+	if (env_var == NULL)
+		env_var = find_env_var(var_name, data->shell_vars);
+	if (env_var != NULL && env_var->value != NULL)
 		return (ft_strdup(env_var->value));
 	return (ft_strdup(""));
 }
@@ -119,7 +125,9 @@ char	*get_var_value(const char *var_name,
  * @brief Expands a braced variable (e.g., ${VAR}) in the input string.
  * 
  * This function extracts the variable name from within braces, retrieves
- * its value, and appends it to the result string.
+ * its value, and appends it to the result string. Anything else inside
+ * the braces, such as `${a[1]}` or `${#name}`, goes to
+ * expand_braced_special().
  * @param input The original input string.
  * @param i The index of the '$' character in the input.
  * @param result Pointer to the result string being built.
@@ -143,7 +151,7 @@ int	expand_braced_variable(const char *input, size_t i,
 	if (input[end] == '}')
 	{
 		var_name = ft_strndup(&input[start], end - start);
-		value = get_var_value(var_name, data->env_list, data->last_exit_status);
+		value = get_var_value(var_name, data);
 		tmp = ft_strjoin(*result, value);
 		free(*result);
 		*result = tmp;
@@ -151,5 +159,5 @@ int	expand_braced_variable(const char *input, size_t i,
 		free(value);
 		return (end + 1);
 	}
-	return (i);
+	return (expand_braced_special(input, i, result, data));
 }
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/05 10:39:19 by makhudon          #+#    #+#             */
-/*   Updated: 2025/08/30 14:47:19 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/11 12:48:21 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -135,7 +135,7 @@ int	handle_standard_var(const char *input, size_t start,
 	while (input[start] && (ft_isalnum(input[start]) || input[start] == '_'))
 		start++;
 	var_name = ft_strndup(&input[var_start], start - var_start);
-	value = get_var_value(var_name, data->env_list, data->last_exit_status);
+	value = get_var_value(var_name, data);
 	tmp = ft_strjoin(*result, value);
 	free(*result);
 	*result = tmp;
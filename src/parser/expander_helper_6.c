@@ -6,46 +6,68 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/09/04 13:16:52 by tiyang        #+#    #+#                 */
-/*   Updated: 2025/09/04 14:10:39 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 15:42:17 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Creates a split array for heredoc tokens.
+ * @brief Creates a split array holding a single word.
  * 
- * This function creates a new array containing the token's value
- * as the only element, followed by a NULL terminator. This is used
- * specifically for heredoc delimiters which should not be split.
+ * This is used for words which should not be split: heredoc
+ * delimiters and herestrings.
  * 
- * @param token The token representing the heredoc delimiter.
- * @return A newly allocated array with the token's value and NULL,
- *         or NULL on allocation failure.
+ * @param word The word; owned by the array from now on (may be NULL).
+ * @return A newly allocated array with the word and NULL, or NULL on
+ *         allocation failure.
  */
-static char	**make_heredoc_split(t_token *token)
+static char	**make_single_split(char *word)
 {
 	char	**split;
 
+	if (word == NULL)
+		return (NULL);
 	split = malloc(sizeof(char *) * 2);
 	if (split == NULL)
-		return (NULL);
-	split[0] = ft_strdup(token->value);
-	if (split[0] == NULL)
 	{
-		free(split);
+		free(word);
 		return (NULL);
 	}
+	split[0] = word;
 	split[1] = NULL;
 	return (split);
 }
 
+/**
+ * @brief Finishes a word that is expanded but never split: the word of
+ * a herestring (`<<< word`) or an assignment (`NAME=value`,
+ * `NAME[sub]=value` or `NAME+=value`).
+ *
+ * @param token The word.
+ * @param expanded The word after variable expansion; freed here.
+ * @return The single-word split array, or NULL on failure.
+ */
+static char	**make_unsplit_word(t_token *token, char *expanded)
+{
+	char	*word;
+
+	if (!ft_strchr(token->value, '\'') && !ft_strchr(token->value, '"'))
+		return (make_single_split(expanded));
+	word = remove_quotes_and_join(expanded);
+	free(expanded);
+	return (make_single_split(word));
+}
+
 /**
  * @brief Processes a token after variable expansion.
  * 
  * This function handles the token based on its quote type and whether
  * it is an export assignment. It may split the expanded string based
- * on whitespace or remove quotes as needed.
+ * on whitespace or remove quotes as needed. A compound assignment
+ * `NAME=(...)` is passed on as written, its elements being expanded
+ * when it is performed (see assign_compound()), and `"${name[@]}"`
+ * gives one word per element (see expand_array_words()).
  * 
  * @param token The original token before expansion.
  * @param expanded The expanded string after variable expansion.
@@ -55,26 +77,27 @@ static char	**make_heredoc_split(t_token *token)
 char	**process_token_for_expansion(t_token *token,
 		const char *prev_token_val, t_process_data *pdata)
 {
-	char	*expanded;
-	char	**split;
+	t_redir_kind	kind;
+	char			*expanded;
+	char			**split;
+	int				assign;
 
-	if (prev_token_val && ft_strncmp(prev_token_val, "<<", 3) == 0)
-		return (make_heredoc_split(token));
-	else
-	{
-		expanded = expand_variables(token->value, pdata->env_list,
-				pdata->last_exit_status, token->quote);
-		if (expanded == NULL)
-			return (NULL);
-		if (prev_token_val && is_redirection((char *)prev_token_val)
-			&& ft_strncmp(prev_token_val, "<<", 3) != 0)
-		{
-			if (is_ambiguous_redirect(expanded, token->value, pdata))
-				return (free(expanded), expanded = NULL, NULL);
-		}
-		split = process_token(token, expanded);
-		if (split == NULL)
-			return (NULL);
-	}
-	return (split);
+	kind = redirect_kind(prev_token_val, NULL);
+	if (kind == REDIR_HEREDOC
+		|| (kind == REDIR_NONE && is_compound_assignment(token->value)))
+		return (make_single_split(ft_strdup(token->value)));
+	assign = (kind == REDIR_NONE && (is_export_assignment(token)
+				|| is_assignment_word(token->value)));
+	if (kind == REDIR_NONE && !assign
+		&& expand_array_words(token, pdata, &split))
+		return (split);
+	expanded = expand_variables(token->value, pdata, token->quote);
+	if (expanded == NULL)
+		return (NULL);
+	if (kind == REDIR_HERESTRING || assign)
+		return (make_unsplit_word(token, expanded));
+	if (kind != REDIR_NONE
+		&& is_ambiguous_redirect(expanded, token->value, pdata))
+		return (free(expanded), NULL);
+	return (process_token(token, expanded));
 }
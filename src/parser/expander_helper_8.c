@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_helper_8.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/11 10:04:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 16:48:19 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Checks whether a variable name is a positional parameter index.
+ *
+ * @param name The variable name.
+ * @return 1 if the name only holds digits and is not "0", 0 otherwise.
+ */
+static int	is_param_index(const char *name)
+{
+	int	i;
+
+	if (name[0] == '\0' || (name[0] == '0' && name[1] == '\0'))
+		return (0);
+	i = 0;
+	while (name[i] != '\0')
+	{
+		if (!ft_isdigit(name[i]))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Lists the positional parameters, the words `"$@"` expands to.
+ *
+ * @param frame The current function call, or NULL at the top level.
+ * @return A newly allocated NULL-terminated copy, empty when there are no
+ *         parameters; exits on allocation failure.
+ */
+char	**param_list(t_call_frame *frame)
+{
+	char	**list;
+	int		count;
+	int		i;
+
+	count = 0;
+	if (frame != NULL)
+		count = frame->argc;
+	list = ft_calloc(count + 1, sizeof(char *));
+	if (list == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	i = 0;
+	while (i < count)
+	{
+		list[i] = ft_strdup(frame->argv[i]);
+		if (list[i] == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		i++;
+	}
+	return (list);
+}
+
+/**
+ * @brief Retrieves the value of a positional parameter or of $#, $@, $*.
+ *
+ * Positional parameters are the arguments of the innermost function call;
+ * outside of a function there are none, so they expand to nothing. $@
+ * and $* give them joined with single spaces; a quoted "$@" keeps them
+ * apart instead (see expand_array_words()).
+ *
+ * @param var_name The variable name, e.g. "1", "12", "#" or "@".
+ * @param frame The current function call, or NULL at the top level.
+ * @return A newly allocated string with the value, or NULL if `var_name`
+ * is not a positional parameter.
+ */
+char	*get_positional_value(const char *var_name, t_call_frame *frame)
+{
+	char	**list;
+	char	*value;
+	int		index;
+
+	if (ft_strncmp(var_name, "#", 2) == 0)
+	{
+		if (frame == NULL)
+			return (ft_strdup("0"));
+		return (ft_itoa(frame->argc));
+	}
+	if (ft_strncmp(var_name, "@", 2) == 0 || ft_strncmp(var_name, "*", 2) == 0)
+	{
+		list = param_list(frame);
+		value = join_words(list);
+		free_split(list);
+		return (value);
+	}
+	if (!is_param_index(var_name))
+		return (NULL);
+	if (frame == NULL || ft_strlen(var_name) > 9)
+		return (ft_strdup(""));
+	index = ft_atoi(var_name);
+	if (index > frame->argc)
+		return (ft_strdup(""));
+	return (ft_strdup(frame->argv[index - 1]));
+}
+
+/**
+ * @brief Fills the expansion data from the current state of the shell.
+ *
+ * @param data The expansion data to fill.
+ * @param pd The process data.
+ */
+void	fill_expand_data(t_expand_data *data, t_process_data *pd)
+{
+	data->env_list = pd->env_list;
+	data->shell_vars = pd->shell_vars;
+	data->arrays = pd->arrays;
+	data->last_exit_status = pd->last_exit_status;
+	data->frame = pd->frame;
+}
+
+/**
+ * @brief Joins words with single spaces, as for `${name[*]}`.
+ *
+ * The length is measured first, so the words are copied once.
+ *
+ * @param words The words, NULL-terminated.
+ * @return A newly allocated string, or NULL on allocation failure.
+ */
+char	*join_words(char **words)
+{
+	char	*result;
+	size_t	len;
+	size_t	n;
+	size_t	i;
+
+	len = 0;
+	i = 0;
+	while (words[i] != NULL)
+		len += ft_strlen(words[i++]) + 1;
+	result = malloc(len + 1);
+	if (result == NULL)
+		return (NULL);
+	len = 0;
+	i = 0;
+	while (words[i] != NULL)
+	{
+		if (i > 0)
+			result[len++] = ' ';
+		n = ft_strlen(words[i]);
+		ft_memcpy(result + len, words[i++], n);
+		len += n;
+	}
+	result[len] = '\0';
+	return (result);
+}
@@ -6,30 +6,28 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/21 11:05:27 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 11:37:30 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Checks if a string is a redirection operator.
- * 
- * This function checks if the given string matches any of the
- * redirection operators: ">", ">>", "<", or "<<".
- * 
- * @param s The string to check.
- * @return 1 if the string is a redirection operator, 0 otherwise.
+ * @brief Parses a redirection operator token from the input string.
+ *
+ * The operator is measured by redirect_op_len(), so a leading descriptor
+ * number and the two-character forms (`>>`, `<<`, `<>`, `<&`, `>&`) stay
+ * in one token.
+ *
+ * @param s A pointer to the input string pointer, moved past the operator.
+ * @return A pointer to the created token, or NULL on failure.
  */
 static t_token	*parse_redirection_token(const char **s)
 {
 	const char	*start;
 
 	start = *s;
-	if ((**s == '>' && *(*s + 1) == '>') || (**s == '<' && *(*s + 1) == '<'))
-		(*s) += 2;
-	else
-		(*s)++;
+	(*s) += redirect_op_len(*s);
 	return (create_token(substr_dup(start, *s - start), NO_QUOTE));
 }
 
@@ -38,8 +36,9 @@ static t_token	*parse_redirection_token(const char **s)
  * 
  * This function reads characters from the input string until it
  * encounters whitespace or a redirection operator, taking into account
- * quoted substrings. It creates a token with the parsed value and
- * appropriate quote type.
+ * quoted substrings. A compound assignment `NAME=(...)` is one word, blanks
+ * included. It creates a token with the parsed value and appropriate
+ * quote type.
  * 
  * @param s A pointer to the input string pointer. This will be updated
  *          to point to the character after the parsed token.
@@ -58,6 +57,7 @@ static t_token	*parse_word_token(const char **s)
 		token_quote_type = SINGLE_QUOTE;
 	else if (**s == '"')
 		token_quote_type = DOUBLE_QUOTE;
+	*s += compound_assign_len(*s);
 	while (**s)
 	{
 		if (**s == quote_char)
@@ -89,7 +89,7 @@ static t_token	*get_next_token(const char **s)
 		(*s)++;
 	if (**s == '\0')
 		return (NULL);
-	if (**s == '<' || **s == '>')
+	if (redirect_op_len(*s) > 0)
 		return (parse_redirection_token(s));
 	else
 		return (parse_word_token(s));
@@ -144,6 +144,8 @@ t_token	**parse_line(char *line, t_process_data *pd)
 
 	if (line == NULL || *line == '\0')
 		return (NULL);
+	if (pd != NULL)
+		trace_mark(pd->trace, TRACE_PARSE);
 	if (!quotes_are_closed(line, pd))
 	{
 		if (pd)
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/21 11:05:27 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/08 11:09:50 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 18:03:52 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -51,7 +51,7 @@ int	quotes_are_closed(const char *line, t_process_data *pd)
  * This function iterates through the input line, counting occurrences
  * of the heredoc operator (<<) that are not within quotes. It properly
  * handles both single and double quotes to avoid counting operators
- * inside quoted sections.
+ * inside quoted sections. Herestrings (<<<) are not counted.
  *
  * @param line The input line to analyze.
  * @return The number of heredoc operators found in the line.
@@ -69,7 +69,9 @@ int	count_heredocs(const char *line)
 			quote_char = *line;
 		else if (*line == quote_char)
 			quote_char = 0;
-		if (quote_char == 0 && *line == '<' && *(line + 1) == '<')
+		if (quote_char == 0 && ft_strncmp(line, "<<<", 3) == 0)
+			line += 2;
+		else if (quote_char == 0 && *line == '<' && *(line + 1) == '<')
 		{
 			count++;
 			line++;
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/03 11:04:10 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/03 11:15:20 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/22 15:42:17 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,13 +43,53 @@ char	*substr_dup(const char *start, size_t len)
 	return (result);
 }
 
+/**
+ * @brief Measures a compound assignment, `NAME=(...)` or `NAME+=(...)`,
+ * at the start of `s`.
+ *
+ * The parentheses may hold blanks and quotes, so the word runs to the
+ * matching unquoted `)`.
+ *
+ * @param s The input string.
+ * @return The length up to and including the `)`, or 0 if `s` does not
+ *         start with a compound assignment.
+ */
+size_t	compound_assign_len(const char *s)
+{
+	size_t	i;
+	char	quote;
+
+	if (!(ft_isalpha(s[0]) || s[0] == '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(s[i]) || s[i] == '_')
+		i++;
+	if (s[i] == '+')
+		i++;
+	if (s[i] != '=' || s[i + 1] != '(')
+		return (0);
+	i += 2;
+	quote = 0;
+	while (s[i] != '\0' && (quote != 0 || s[i] != ')'))
+	{
+		if (quote == 0 && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (s[i] == quote)
+			quote = 0;
+		i++;
+	}
+	if (s[i] != ')')
+		return (0);
+	return (i + 1);
+}
+
 /**
  * @brief Skips over a token in the input string.
  *
  * This function advances the pointer past a token, which can be
  * a redirection operator or a sequence of non-whitespace characters.
  * It properly handles quoted sections to avoid splitting tokens
- * within quotes.
+ * within quotes, and keeps a compound assignment in one token.
  *
  * @param s Pointer to the current position in the input string.
  * @return Pointer advanced past the current token.
@@ -59,12 +99,9 @@ static const char	*skip_token(const char *s)
 	char	quote;
 
 	quote = 0;
-	if (*s == '<' || *s == '>')
-	{
-		if ((*s == '<' && *(s + 1) == '<') || (*s == '>' && *(s + 1) == '>'))
-			return (s + 2);
-		return (s + 1);
-	}
+	if (redirect_op_len(s) > 0)
+		return (s + redirect_op_len(s));
+	s += compound_assign_len(s);
 	while (*s != '\0')
 	{
 		if (quote == 0 && (*s == '\'' || *s == '\"'))
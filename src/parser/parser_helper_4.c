@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/03 11:04:03 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/03 11:15:36 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 18:03:52 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -65,23 +65,41 @@ static int	is_valid_redirect(t_token **tokens, int i)
 /**
  * @brief Checks if a string is a redirection operator.
  *
- * This function checks if the given string matches any of the
- * standard redirection operators: ">", "<", ">>", or "<<".
+ * Any operator redirect_kind() knows counts, including `2>&` and `<>`.
  *
  * @param s The string to check.
  * @return 1 if the string is a redirection operator, 0 otherwise.
  */
 int	is_redirect(const char *s)
 {
-	if (ft_strncmp(s, ">>", 3) == 0)
-		return (1);
-	if (ft_strncmp(s, "<<", 3) == 0)
-		return (1);
-	if (ft_strncmp(s, ">", 2) == 0)
-		return (1);
-	if (ft_strncmp(s, "<", 2) == 0)
-		return (1);
-	return (0);
+	return (is_redirection(s));
+}
+
+/**
+ * @brief Measures the redirection operator at the start of `s`.
+ *
+ * The operator may be preceded by a descriptor number, as in `2>&1`,
+ * which then belongs to the operator and not to a word. `<<<` is the
+ * only three-character operator.
+ *
+ * @param s The input at the current position.
+ * @return The length of the operator, or 0 if `s` does not start with one.
+ */
+int	redirect_op_len(const char *s)
+{
+	int	n;
+
+	n = 0;
+	while (ft_isdigit(s[n]))
+		n++;
+	if (s[n] != '<' && s[n] != '>')
+		return (0);
+	if (s[n] == '<' && s[n + 1] == '<' && s[n + 2] == '<')
+		return (n + 3);
+	if (s[n + 1] != '\0' && ((s[n] == '<' && ft_strchr("<>&", s[n + 1]))
+			|| (s[n] == '>' && ft_strchr(">&", s[n + 1]))))
+		return (n + 2);
+	return (n + 1);
 }
 
 /**
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_inline.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 17:46:31 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether a stage can run inside the shell instead of in a
+ * child of its own.
+ *
+ * Only the data movers `cat` and `tee` qualify, when they are the
+ * builtins (not functions, not refused options), have no redirections of
+ * their own, and do not read the terminal: with SIGINT ignored while the
+ * pipeline runs, the shell could not be interrupted out of that read.
+ */
+static int	is_inline_stage(t_process_data *data, int i)
+{
+	t_command	*cmd;
+
+	cmd = data->cmds[i];
+	if (cmd->node != NULL || cmd->args == NULL || cmd->args[0] == NULL
+		|| cmd->fd_ops != NULL || cmd->heredoc_file != NULL
+		|| cmd->env_prefix != NULL)
+		return (0);
+	if (ft_strncmp(cmd->args[0], "cat", 4) != 0
+		&& ft_strncmp(cmd->args[0], "tee", 4) != 0)
+		return (0);
+	if (find_function(data, cmd->args[0]) != NULL || !is_builtin(cmd->args))
+		return (0);
+	if (i == 0 && isatty(STDIN_FILENO)
+		&& (cmd->args[0][0] == 't' || cmd->args[1] == NULL))
+		return (0);
+	return (1);
+}
+
+/**
+ * @brief Picks the stage of a pipeline the shell runs itself, if any.
+ *
+ * Only one stage can run in the shell, after every other stage has been
+ * forked. Nothing runs inline while the pipeline monitor needs the pipes
+ * (MINISHELL_PIPE_PROFILE or an adaptive pipe size).
+ *
+ * @param data The process data of the pipeline.
+ * @return The index of the stage, or -1 if every stage is forked.
+ */
+int	find_inline_stage(t_process_data *data)
+{
+	t_env_var	*var;
+	int			i;
+
+	if (data->cmd_count < 2 || data->pipe_size == PIPE_SIZE_ADAPTIVE)
+		return (-1);
+	var = find_env_var(PROFILE_ENV, data->env_list);
+	if (var != NULL && var->value != NULL && var->value[0] != '\0')
+		return (-1);
+	i = 0;
+	while (i < data->cmd_count && !is_inline_stage(data, i))
+		i++;
+	if (i == data->cmd_count)
+		return (-1);
+	return (i);
+}
+
+/**
+ * @brief Moves the inline stage's pipe ends onto standard input and
+ * output, and closes every pipe end the shell holds, so the neighbours
+ * of the stage see end of file and SIGPIPE as usual. The shell's own
+ * standard input and output are saved first.
+ *
+ * @param data The process data of the pipeline.
+ * @param i The index of the inline stage.
+ * @param saved Receives the saved standard input and output.
+ */
+static void	attach_stage_ends(t_process_data *data, int i, int *saved)
+{
+	int	p;
+
+	saved[0] = dup(STDIN_FILENO);
+	saved[1] = dup(STDOUT_FILENO);
+	if (saved[0] == -1 || saved[1] == -1)
+		ft_error_and_exit("dup", strerror(errno), EXIT_FAILURE);
+	p = 0;
+	while (p < data->cmd_count - 1)
+	{
+		if (p == i - 1 && dup2(data->pipes[p][0], STDIN_FILENO) == -1)
+			ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+		if (p == i && dup2(data->pipes[p][1], STDOUT_FILENO) == -1)
+			ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+		close(data->pipes[p][0]);
+		close(data->pipes[p][1]);
+		data->pipes[p][0] = -1;
+		data->pipes[p][1] = -1;
+		p++;
+	}
+}
+
+/**
+ * @brief Runs the inline stage of a pipeline in the shell, if it has one.
+ *
+ * The stage's pipe ends are moved onto standard input and output for the
+ * duration of the builtin, with SIGPIPE ignored so a reader that exits
+ * early ends the builtin with EPIPE rather than killing the shell; the
+ * shell's own disposition is put back afterwards. SIGINT, ignored by the
+ * shell while the pipeline runs, is caught instead, without SA_RESTART:
+ * Ctrl-C stops the builtin as it kills the other stages. Its exit status
+ * is kept for wait_stage().
+ *
+ * @param data The process data of the pipeline, after forking.
+ */
+void	run_inline_stage(t_process_data *data)
+{
+	struct sigaction	sa_pipe;
+	struct sigaction	old_pipe;
+	int					saved[2];
+	int					i;
+
+	i = data->inline_stage;
+	if (i < 0)
+		return ;
+	attach_stage_ends(data, i, saved);
+	trace_mark(data->trace, TRACE_BUILTIN);
+	sa_pipe.sa_handler = SIG_IGN;
+	sigemptyset(&sa_pipe.sa_mask);
+	sa_pipe.sa_flags = 0;
+	sigaction(SIGPIPE, &sa_pipe, &old_pipe);
+	sa_pipe.sa_handler = handle_stage_sigint;
+	sigaction(SIGINT, &sa_pipe, NULL);
+	data->inline_status = run_builtin(data->cmds[i]->args, data);
+	signal(SIGINT, SIG_IGN);
+	sigaction(SIGPIPE, &old_pipe, NULL);
+	if (dup2(saved[0], STDIN_FILENO) == -1
+		|| dup2(saved[1], STDOUT_FILENO) == -1)
+		ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+	close(saved[0]);
+	close(saved[1]);
+}
+
+/**
+ * @brief Waits for one stage of a pipeline.
+ *
+ * The inline stage has no process (its pid is 0); its status is the one
+ * run_inline_stage() kept, with no resource usage of its own. After
+ * Ctrl-C it is that of SIGINT, like the stages it killed, even if the
+ * builtin saw the end of its input first.
+ *
+ * @return The wait4() result: the pid, or -1 on error.
+ */
+pid_t	wait_stage(t_process_data *data, int i, int *status, struct rusage *ru)
+{
+	if (data->pids[i] != 0)
+		return (wait4(data->pids[i], status, 0, ru));
+	ft_bzero(ru, sizeof(struct rusage));
+	*status = W_EXITCODE(data->inline_status, 0);
+	if (g_signal_received == SIGINT)
+		*status = W_EXITCODE(128 + SIGINT, 0);
+	return (0);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_optimize.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 20:13:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 19:26:13 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether a stage is a plain `name [args]` command: no
+ * redirections, no compound node, and `name` not shadowed by a function.
+ */
+int	is_plain_stage(t_command *cmd, t_process_data *pd)
+{
+	return (cmd->node == NULL && cmd->args != NULL && cmd->args[0] != NULL
+		&& cmd->fd_ops == NULL && cmd->heredoc_file == NULL
+		&& cmd->env_prefix == NULL
+		&& find_function(pd, cmd->args[0]) == NULL);
+}
+
+/**
+ * @brief Removes stage `i` from the pipeline without freeing it.
+ *
+ * @return The stage removed.
+ */
+t_command	*unlink_stage(t_process_data *pd, int i)
+{
+	t_command	*cmd;
+
+	cmd = pd->cmds[i];
+	while (i < pd->cmd_count)
+	{
+		pd->cmds[i] = pd->cmds[i + 1];
+		i++;
+	}
+	pd->cmd_count--;
+	return (cmd);
+}
+
+/**
+ * @brief Rewrites a leading `cat FILE | cmd` into `cmd < FILE`.
+ *
+ * Only done when FILE is a readable regular file and `cmd` has no input
+ * redirection of its own, so that neither the error messages nor the
+ * data `cmd` sees change. FILE is opened here and put first in the
+ * redirection list of `cmd`, where the pipe would have been.
+ */
+static void	elide_leading_cat(t_process_data *pd)
+{
+	t_command	*cat;
+	t_fd_op		*rest;
+	t_fd_op		*op;
+	struct stat	st;
+	int			fd;
+
+	cat = pd->cmds[0];
+	if (pd->cmd_count < 2 || !is_plain_stage(cat, pd)
+		|| ft_strncmp(cat->args[0], "cat", 4) != 0 || cat->args[1] == NULL
+		|| cat->args[2] != NULL || cat->args[1][0] == '-'
+		|| fd_ops_redirect(pd->cmds[1]->fd_ops, STDIN_FILENO)
+		|| pd->cmds[1]->heredoc_file != NULL
+		|| stat(cat->args[1], &st) == -1 || !S_ISREG(st.st_mode))
+		return ;
+	fd = open(cat->args[1], O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return ;
+	rest = pd->cmds[1]->fd_ops;
+	pd->cmds[1]->fd_ops = NULL;
+	op = add_fd_op(&pd->cmds[1]->fd_ops, FD_OPEN, STDIN_FILENO, cat->args[1]);
+	op->src = fd;
+	op->flags = O_RDONLY | O_CLOEXEC;
+	op->next = rest;
+	note_rewrite(pd, "elide-leading-cat", cat, pd->cmds[1]);
+	free_command(unlink_stage(pd, 0));
+}
+
+/**
+ * @brief Drops a trailing `| cat` when standard output is not a terminal.
+ *
+ * On a terminal the cat stage matters: the command before it sees a pipe
+ * rather than a terminal, and many programs format their output
+ * differently. The pipeline status stays that of cat; see tail_elided.
+ */
+static void	elide_trailing_cat(t_process_data *pd)
+{
+	t_command	*cat;
+
+	cat = pd->cmds[pd->cmd_count - 1];
+	if (pd->cmd_count < 2 || !is_plain_stage(cat, pd)
+		|| ft_strncmp(cat->args[0], "cat", 4) != 0 || cat->args[1] != NULL
+		|| isatty(STDOUT_FILENO))
+		return ;
+	note_rewrite(pd, "elide-trailing-cat", pd->cmds[pd->cmd_count - 2], cat);
+	free_command(unlink_stage(pd, pd->cmd_count - 1));
+	pd->tail_elided = 1;
+}
+
+/**
+ * @brief Rewrites the stages of a pipeline about to run into cheaper ones
+ * with the same output.
+ *
+ * Adjacent side-effect-free builtins are fused into one process, a
+ * leading `cat FILE |` becomes an input redirection, and a trailing
+ * `| cat` is dropped when standard output is not a terminal. Each
+ * rewrite is reported as a trace event.
+ *
+ * @param pd The process data, with cmds and cmd_count filled in.
+ */
+void	optimize_pipeline(t_process_data *pd)
+{
+	pd->tail_elided = 0;
+	if (pd->cmds == NULL || pd->cmd_count < 2)
+		return ;
+	fuse_builtin_stages(pd);
+	elide_leading_cat(pd);
+	elide_trailing_cat(pd);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_optimize_helper.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 20:13:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 20:13:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Tells whether a stage is a builtin that neither reads standard
+ * input nor changes anything the rest of the pipeline could see, so it
+ * can share a process with the stage after it.
+ */
+static int	is_fusable_stage(t_command *cmd, t_process_data *pd)
+{
+	static const char	*names[] = {"echo", "printf", "true", "false", ":",
+		"pwd", "env", "test", "[", NULL};
+	int					i;
+
+	if (!is_plain_stage(cmd, pd) || !is_builtin(cmd->args))
+		return (0);
+	i = 0;
+	while (names[i] != NULL
+		&& ft_strncmp(cmd->args[0], names[i], ft_strlen(names[i]) + 1) != 0)
+		i++;
+	return (names[i] != NULL);
+}
+
+/**
+ * @brief Reports a rewrite of two stages as a trace event, with their
+ * words as the detail (`cat notes.txt | grep todo`).
+ *
+ * @param pd The process data holding the tracer.
+ * @param rule The name of the rewrite.
+ * @param a The first stage involved.
+ * @param b The second stage involved.
+ */
+void	note_rewrite(t_process_data *pd, const char *rule, t_command *a,
+		t_command *b)
+{
+	char	detail[TRACE_NOTE_MAX];
+	char	**word;
+
+	if (pd->trace == NULL)
+		return ;
+	detail[0] = '\0';
+	word = a->args;
+	while (*word != NULL)
+	{
+		ft_strlcat(detail, *word++, sizeof(detail));
+		ft_strlcat(detail, " ", sizeof(detail));
+	}
+	ft_strlcat(detail, "|", sizeof(detail));
+	word = b->args;
+	while (*word != NULL)
+	{
+		ft_strlcat(detail, " ", sizeof(detail));
+		ft_strlcat(detail, *word++, sizeof(detail));
+	}
+	trace_note(pd->trace, rule, detail);
+}
+
+/**
+ * @brief Fuses every run of adjacent fusable builtins into their last
+ * stage, which runs the others first as its prelude.
+ *
+ * The output of a stage followed by one that does not read it is thrown
+ * away anyway, so `echo a | true` needs one process, not two.
+ *
+ * @param pd The process data of the pipeline.
+ */
+void	fuse_builtin_stages(t_process_data *pd)
+{
+	int	i;
+
+	i = 0;
+	while (i + 1 < pd->cmd_count)
+	{
+		if (is_fusable_stage(pd->cmds[i], pd)
+			&& is_fusable_stage(pd->cmds[i + 1], pd))
+		{
+			note_rewrite(pd, "fuse-builtins", pd->cmds[i], pd->cmds[i + 1]);
+			pd->cmds[i + 1]->prelude = unlink_stage(pd, i);
+		}
+		else
+			i++;
+	}
+}
+
+/**
+ * @brief Runs the stages fused in front of a command, oldest first.
+ *
+ * @param cmd The first stage to run.
+ * @param pd The process data.
+ */
+static void	run_fused(t_command *cmd, t_process_data *pd)
+{
+	if (cmd->prelude != NULL)
+		run_fused(cmd->prelude, pd);
+	run_builtin(cmd->args, pd);
+}
+
+/**
+ * @brief Runs the prelude of a fused stage in its child, with standard
+ * output sent to /dev/null as the pipe it replaced would have been.
+ *
+ * @param cmd The stage; nothing happens without a prelude.
+ * @param pd The process data of the child.
+ */
+void	run_prelude(t_command *cmd, t_process_data *pd)
+{
+	int	saved;
+	int	null_fd;
+
+	if (cmd->prelude == NULL)
+		return ;
+	saved = dup(STDOUT_FILENO);
+	null_fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	if (saved == -1 || null_fd == -1 || dup2(null_fd, STDOUT_FILENO) == -1)
+		ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+	close(null_fd);
+	run_fused(cmd->prelude, pd);
+	if (dup2(saved, STDOUT_FILENO) == -1)
+		ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+	close(saved);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_profile.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 11:05:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 15:22:10 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the sampling interval asked for with
+ * MINISHELL_PIPE_PROFILE, looked up on every pipeline so it can be set
+ * and unset between them.
+ *
+ * @param data The process data holding the environment.
+ * @return The interval in milliseconds, or 0 if profiling is off.
+ */
+static int	profile_interval(t_process_data *data)
+{
+	t_env_var	*var;
+	int			ms;
+
+	var = find_env_var(PROFILE_ENV, data->env_list);
+	if (var == NULL || var->value == NULL || var->value[0] == '\0')
+		return (0);
+	ms = ft_atoi(var->value);
+	if (ms < 1)
+		ms = 1;
+	return (ms);
+}
+
+/**
+ * @brief Closes the write end of every pipe in the parent and notes the
+ * capacity of each.
+ *
+ * The read ends stay open so the profiler can look at fill levels; see
+ * note_exits() for why that is safe.
+ */
+static void	keep_read_ends(t_process_data *data, t_pipe_profile *prof)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->cmd_count - 1)
+	{
+		close(data->pipes[i][1]);
+		data->pipes[i][1] = -1;
+		prof->stages[i].out_cap = fcntl(data->pipes[i][0], F_GETPIPE_SZ);
+		i++;
+	}
+}
+
+/**
+ * @brief Notes the stages that have exited, without reaping them.
+ *
+ * wait_all_children() still reaps every stage afterwards, with its exit
+ * status and resource usage. Once a stage is gone the parent closes its
+ * input pipe, so the stage writing into it gets SIGPIPE exactly as it
+ * would without the profiler holding the read end.
+ */
+static void	note_exits(t_process_data *data, t_pipe_profile *prof)
+{
+	siginfo_t	info;
+	int			i;
+
+	i = 0;
+	while (i < data->cmd_count)
+	{
+		info.si_pid = 0;
+		if (prof->stages[i].end_us == 0
+			&& waitid(P_PID, data->pids[i], &info,
+				WEXITED | WNOHANG | WNOWAIT) != -1 && info.si_pid != 0)
+		{
+			prof->stages[i].end_us = prof->last_us;
+			prof->alive--;
+			if (i > 0)
+			{
+				close(data->pipes[i - 1][0]);
+				data->pipes[i - 1][0] = -1;
+			}
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Sets up the monitor: closes the parent's write ends and picks
+ * how often to wake up.
+ *
+ * @return 1 on success, 0 if the stage table cannot be allocated.
+ */
+static int	start_monitor(t_process_data *data, t_pipe_profile *prof)
+{
+	prof->stages = ft_calloc(data->cmd_count, sizeof(t_stage_profile));
+	if (prof->stages == NULL)
+		return (0);
+	keep_read_ends(data, prof);
+	prof->alive = data->cmd_count;
+	prof->start_us = timing_clock_us();
+	prof->last_us = prof->start_us;
+	prof->tick_ms = prof->interval_ms;
+	if (prof->adaptive
+		&& (prof->tick_ms == 0 || prof->tick_ms > PIPE_ADAPT_MS))
+		prof->tick_ms = PIPE_ADAPT_MS;
+	return (1);
+}
+
+/**
+ * @brief Watches a running pipeline until every stage has exited.
+ *
+ * With MINISHELL_PIPE_PROFILE set, samples every stage and prints the
+ * per-stage report to stderr at the end. With an adaptive pipe size,
+ * grows the pipes that keep filling up. Does nothing otherwise. Called
+ * by the parent after forking, in place of simply closing its pipe ends.
+ *
+ * @param data The process data of the pipeline.
+ */
+void	monitor_pipeline(t_process_data *data)
+{
+	t_pipe_profile	prof;
+
+	ft_bzero(&prof, sizeof(t_pipe_profile));
+	prof.interval_ms = profile_interval(data);
+	prof.adaptive = (data->pipe_size == PIPE_SIZE_ADAPTIVE);
+	if ((prof.interval_ms == 0 && !prof.adaptive)
+		|| !start_monitor(data, &prof))
+		return ;
+	while (prof.alive > 0)
+	{
+		if (prof.interval_ms > 0)
+			profile_sample(data, &prof);
+		else
+			prof.last_us = timing_clock_us();
+		if (prof.adaptive)
+			adapt_pipe_sizes(data, &prof);
+		note_exits(data, &prof);
+		if (prof.alive > 0)
+			usleep(prof.tick_ms * 1000);
+	}
+	if (prof.interval_ms > 0)
+		report_pipe_profile(data, &prof);
+	free(prof.stages);
+}
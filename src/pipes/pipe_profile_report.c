@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_profile_report.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 11:05:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 11:05:51 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the CPU time of a stage in milliseconds.
+ */
+static double	stage_cpu_ms(t_stage_profile *st)
+{
+	return (st->cpu_ticks * 1000.0 / sysconf(_SC_CLK_TCK));
+}
+
+/**
+ * @brief Finds the stage that kept the CPU busiest for its lifetime: the
+ * one the others were waiting for.
+ *
+ * @return Its index, or -1 if no stage was busy half of its time.
+ */
+static int	find_bottleneck(t_process_data *data, t_pipe_profile *prof)
+{
+	double	share;
+	double	best;
+	int		found;
+	int		i;
+
+	best = 0.5;
+	found = -1;
+	i = 0;
+	while (i < data->cmd_count)
+	{
+		share = stage_cpu_ms(&prof->stages[i]) * 1000.0
+			/ (prof->stages[i].end_us - prof->start_us + 1);
+		if (share >= best)
+		{
+			best = share;
+			found = i;
+		}
+		i++;
+	}
+	return (found);
+}
+
+/**
+ * @brief Returns the name a stage is reported under.
+ */
+static const char	*stage_name(t_command *cmd)
+{
+	if (cmd->node != NULL || cmd->args == NULL || cmd->args[0] == NULL)
+		return ("{...}");
+	return (cmd->args[0]);
+}
+
+/**
+ * @brief Prints the report line of one stage.
+ *
+ * @param data The process data of the pipeline.
+ * @param prof The profile.
+ * @param i The index of the stage.
+ * @param mark Whether this is the bottleneck.
+ */
+static void	report_stage(t_process_data *data, t_pipe_profile *prof, int i,
+		int mark)
+{
+	t_stage_profile	*st;
+	char			out[32];
+	char			line[PROFILE_LINE_MAX];
+	long long		wall_us;
+	const char		*tag;
+
+	st = &prof->stages[i];
+	wall_us = st->end_us - prof->start_us;
+	ft_strlcpy(out, "-", sizeof(out));
+	if (i < data->cmd_count - 1)
+		snprintf(out, sizeof(out), "%d/%d", st->out_peak, st->out_cap);
+	tag = "";
+	if (mark)
+		tag = "  <- bottleneck";
+	snprintf(line, sizeof(line), "%5d %9.1f %9.1f %4.0f%% %9.1f %9.1f "
+		"%13s  %s%s\n", i + 1, wall_us / 1000.0, stage_cpu_ms(st),
+		stage_cpu_ms(st) * 100000.0 / (wall_us + 1), st->empty_us / 1000.0,
+		st->full_us / 1000.0, out, stage_name(data->cmds[i]), tag);
+	ft_putstr_fd(line, STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the per-stage report of a profiled pipeline to stderr.
+ *
+ * For each stage: its wall time, its CPU time and their ratio, the time
+ * it slept on an empty input pipe or a full output pipe, and the peak
+ * fill level of its output pipe against the pipe's capacity.
+ *
+ * @param data The process data of the pipeline.
+ * @param prof The finished profile.
+ */
+void	report_pipe_profile(t_process_data *data, t_pipe_profile *prof)
+{
+	char	line[PROFILE_LINE_MAX];
+	int		bottleneck;
+	int		i;
+
+	snprintf(line, sizeof(line), "pipe profile: %d stages, %.1f ms, "
+		"%d samples every %d ms\n", data->cmd_count,
+		(prof->last_us - prof->start_us) / 1000.0, prof->samples,
+		prof->interval_ms);
+	ft_putstr_fd(line, STDERR_FILENO);
+	ft_putstr_fd("stage   wall_ms    cpu_ms  cpu%  empty_ms   full_ms"
+		"  out_peak/cap  command\n", STDERR_FILENO);
+	bottleneck = find_bottleneck(data, prof);
+	i = 0;
+	while (i < data->cmd_count)
+	{
+		report_stage(data, prof, i, i == bottleneck);
+		i++;
+	}
+}
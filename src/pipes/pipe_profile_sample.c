@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_profile_sample.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 11:05:51 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 11:05:51 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <sys/ioctl.h>
+
+/**
+ * @brief Sums utime and stime, fields 14 and 15 of /proc/<pid>/stat.
+ *
+ * @param p The ')' that ends field 2, the command name.
+ * @return The CPU time in clock ticks.
+ */
+static long long	parse_cpu_ticks(const char *p)
+{
+	long long	ticks[2];
+	int			field;
+	int			k;
+
+	field = 2;
+	while (*p != '\0' && field < 14)
+	{
+		if (*p == ' ')
+			field++;
+		p++;
+	}
+	k = 0;
+	while (k < 2)
+	{
+		ticks[k] = 0;
+		while (ft_isdigit(*p))
+			ticks[k] = ticks[k] * 10 + (*p++ - '0');
+		if (*p == ' ')
+			p++;
+		k++;
+	}
+	return (ticks[0] + ticks[1]);
+}
+
+/**
+ * @brief Reads the state and CPU time of a process from /proc/<pid>/stat.
+ *
+ * The command name in field 2 may hold spaces and parentheses, so the
+ * fields are counted from the last ')'.
+ *
+ * @param pid The process.
+ * @param state Receives the state letter ('R', 'S', 'D', 'Z', ...).
+ * @param ticks Receives utime + stime in clock ticks.
+ * @return 1 on success, 0 if the process is gone or the file is odd.
+ */
+static int	read_proc_stat(pid_t pid, char *state, long long *ticks)
+{
+	char	buf[PROFILE_STAT_MAX];
+	char	*p;
+	ssize_t	n;
+	int		fd;
+
+	snprintf(buf, sizeof(buf), "/proc/%d/stat", (int)pid);
+	fd = open(buf, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (0);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n <= 0)
+		return (0);
+	buf[n] = '\0';
+	p = ft_strrchr(buf, ')');
+	if (p == NULL || p[1] != ' ' || p[2] == '\0')
+		return (0);
+	*state = p[2];
+	*ticks = parse_cpu_ticks(p);
+	return (1);
+}
+
+/**
+ * @brief Returns the number of bytes waiting in a pipe, or -1 if it is
+ * closed.
+ */
+static int	pipe_level(int fd)
+{
+	int	bytes;
+
+	if (fd < 0 || ioctl(fd, FIONREAD, &bytes) == -1)
+		return (-1);
+	return (bytes);
+}
+
+/**
+ * @brief Charges the time since the last sample to a sleeping stage that
+ * waits on an empty input pipe or a full output pipe.
+ *
+ * @param data The process data of the pipeline.
+ * @param prof The profile.
+ * @param i The index of the stage.
+ * @param dt The time since the last sample, in microseconds.
+ */
+static void	classify_stage(t_process_data *data, t_pipe_profile *prof, int i,
+		long long dt)
+{
+	t_stage_profile	*st;
+	int				level;
+
+	st = &prof->stages[i];
+	if (i < data->cmd_count - 1)
+	{
+		level = pipe_level(data->pipes[i][0]);
+		if (level > st->out_peak)
+			st->out_peak = level;
+		if (st->out_cap > 0 && level >= st->out_cap)
+		{
+			st->full_us += dt;
+			return ;
+		}
+	}
+	if (i > 0 && pipe_level(data->pipes[i - 1][0]) == 0)
+		st->empty_us += dt;
+}
+
+/**
+ * @brief Takes one sample of every running stage: its CPU time so far
+ * and, if it is asleep, which pipe it is waiting on.
+ *
+ * @param data The process data of the pipeline.
+ * @param prof The profile.
+ */
+void	profile_sample(t_process_data *data, t_pipe_profile *prof)
+{
+	long long	now;
+	long long	ticks;
+	char		state;
+	int			i;
+
+	now = timing_clock_us();
+	i = 0;
+	while (i < data->cmd_count)
+	{
+		if (prof->stages[i].end_us == 0
+			&& read_proc_stat(data->pids[i], &state, &ticks))
+		{
+			prof->stages[i].cpu_ticks = ticks;
+			if (state == 'S')
+				classify_stage(data, prof, i, now - prof->last_us);
+		}
+		i++;
+	}
+	prof->last_us = now;
+	prof->samples++;
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 15:22:10 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 15:22:10 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <sys/ioctl.h>
+
+/**
+ * @brief Parses a pipe capacity: a byte count with an optional K or M
+ * suffix, or `adaptive`.
+ *
+ * @param str The text to parse.
+ * @return The capacity in bytes, PIPE_SIZE_ADAPTIVE, or 0 if `str` is
+ *         not a valid capacity.
+ */
+long	parse_pipe_size(const char *str)
+{
+	long	size;
+
+	if (ft_strncmp(str, "adaptive", 9) == 0)
+		return (PIPE_SIZE_ADAPTIVE);
+	size = 0;
+	while (ft_isdigit(*str) && size <= INT_MAX)
+		size = size * 10 + (*str++ - '0');
+	if (*str == 'K' || *str == 'k')
+	{
+		size *= 1024;
+		str++;
+	}
+	else if (*str == 'M' || *str == 'm')
+	{
+		size *= 1024 * 1024;
+		str++;
+	}
+	if (*str != '\0' || size <= 0 || size > INT_MAX)
+		return (0);
+	return (size);
+}
+
+/**
+ * @brief Picks the pipe capacity of the pipeline about to run: its
+ * `pipesize` prefix if it has one, else MINISHELL_PIPE_SIZE.
+ *
+ * @param data The process data.
+ * @return The capacity, PIPE_SIZE_ADAPTIVE, or 0 for the default.
+ */
+long	pipeline_pipe_size(t_process_data *data)
+{
+	t_env_var	*var;
+
+	if (data->pipe_size_hint != 0)
+		return (data->pipe_size_hint);
+	var = find_env_var(PIPE_SIZE_ENV, data->env_list);
+	if (var == NULL || var->value == NULL)
+		return (0);
+	return (parse_pipe_size(var->value));
+}
+
+/**
+ * @brief Returns the largest capacity an unprivileged process may give a
+ * pipe, from /proc/sys/fs/pipe-max-size (1 MiB if it cannot be read).
+ */
+static int	pipe_max_size(void)
+{
+	char	buf[32];
+	ssize_t	n;
+	int		fd;
+
+	fd = open("/proc/sys/fs/pipe-max-size", O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (1024 * 1024);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n <= 0)
+		return (1024 * 1024);
+	buf[n] = '\0';
+	return (ft_atoi(buf));
+}
+
+/**
+ * @brief Sets the capacity of a pipe, clamped to pipe-max-size.
+ *
+ * /proc is only read when the kernel refuses the size asked for.
+ *
+ * @param fd Either end of the pipe.
+ * @param size The capacity wanted.
+ * @return The capacity the pipe ended up with, or -1 on error.
+ */
+int	set_pipe_size(int fd, long size)
+{
+	int	done;
+	int	max;
+
+	done = fcntl(fd, F_SETPIPE_SZ, (int)size);
+	if (done == -1 && errno == EPERM)
+	{
+		max = pipe_max_size();
+		if (size > max)
+			done = fcntl(fd, F_SETPIPE_SZ, max);
+	}
+	if (done == -1)
+		done = fcntl(fd, F_GETPIPE_SZ);
+	return (done);
+}
+
+/**
+ * @brief Grows every pipe the parent has seen full for PIPE_ADAPT_STREAK
+ * samples in a row, PIPE_ADAPT_GROWTH times over.
+ *
+ * @param data The process data of the pipeline.
+ * @param prof The monitor state; out_cap is kept up to date.
+ */
+void	adapt_pipe_sizes(t_process_data *data, t_pipe_profile *prof)
+{
+	t_stage_profile	*st;
+	int				level;
+	int				i;
+
+	i = 0;
+	while (i < data->cmd_count - 1)
+	{
+		st = &prof->stages[i];
+		if (data->pipes[i][0] >= 0
+			&& ioctl(data->pipes[i][0], FIONREAD, &level) != -1
+			&& st->out_cap > 0 && level >= st->out_cap)
+			st->full_streak++;
+		else
+			st->full_streak = 0;
+		if (st->full_streak >= PIPE_ADAPT_STREAK)
+		{
+			st->out_cap = set_pipe_size(data->pipes[i][0],
+					(long)st->out_cap * PIPE_ADAPT_GROWTH);
+			st->full_streak = 0;
+		}
+		i++;
+	}
+}
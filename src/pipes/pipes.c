@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/07/22 10:08:55 by makhudon      #+#    #+#                 */
-/*   Updated: 2025/09/09 13:16:51 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 11:37:08 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,11 +54,22 @@ static int	**create_pipe_fds_between_commands(int cmd_count)
 }
 
 /**
- * @brief Thin wrapper to build pipe FDs array.
+ * @brief Builds the pipe FDs array and gives each pipe the capacity asked
+ * for with `pipesize` or MINISHELL_PIPE_SIZE.
  */
-static int	**prepare_pipe_fds(int cmd_count)
+static int	**prepare_pipe_fds(t_process_data *data)
 {
-	return (create_pipe_fds_between_commands(cmd_count));
+	int	**pipes;
+	int	i;
+
+	pipes = create_pipe_fds_between_commands(data->cmd_count);
+	i = 0;
+	while (pipes != NULL && data->pipe_size > 0 && i < data->cmd_count - 1)
+	{
+		set_pipe_size(pipes[i][0], data->pipe_size);
+		i++;
+	}
+	return (pipes);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -69,7 +80,9 @@ static int	**prepare_pipe_fds(int cmd_count)
  * @brief Sets up and forks all processes for a command pipeline.
  *
  * Ensures that on any failure path we do not leave allocated memory or
- * open FDs behind (caller also does best-effort cleanup).
+ * open FDs behind (caller also does best-effort cleanup). The execve()
+ * environment is built before forking, if it is not cached already, so
+ * that every stage inherits it instead of building its own.
  *
  * @param data Process data containing commands and counts.
  * @return 1 on success, 0 if nothing to run, -1 on fatal error.
@@ -80,17 +93,19 @@ static int	setup_and_fork_pipeline(t_process_data *data)
 		return (0);
 	data->pipes = NULL;
 	data->pids = NULL;
+	data->pipe_size = pipeline_pipe_size(data);
+	data->inline_stage = find_inline_stage(data);
 	if (data->cmd_count > 1)
 	{
-		data->pipes = prepare_pipe_fds(data->cmd_count);
+		data->pipes = prepare_pipe_fds(data);
 		if (data->pipes == NULL)
 			return (-1);
 	}
 	data->pids = create_child_processes(data->cmd_count, data->pipes);
 	if (data->pids == NULL)
-	{
 		return (-1);
-	}
+	cached_envp(data);
+	stats_fork(data->stats, data->cmd_count - (data->inline_stage >= 0));
 	if (fork_all_processes_recursive(data, 0) == -1)
 		return (-1);
 	return (1);
@@ -113,18 +128,22 @@ static int	setup_and_execute_pipeline(t_process_data *data)
  *
  * Sets SIGINT/SIGQUIT to ignore in the parent during forking, then restores
  * handlers afterward. On any failure, frees pids and closes all pipes to
- * avoid "still reachable" reports.
+ * avoid "still reachable" reports. A pipeline that ran is recorded in the
+ * per-command statistics under the names of its stages.
  *
  * @param data Process data with cmds/cmd_count/path_dirs/env_list filled in.
  * @return Exit status of the last command, or -1 on failure.
  */
 int	run_command_pipeline(t_process_data *data)
 {
-	int	fork_status;
-	int	exit_status;
+	t_stats_mark	mark;
+	int				fork_status;
+	int				exit_status;
 
+	stats_begin(data, &mark);
 	data->last_exit_status = 0;
 	data->in_pipeline = 1;
+	sync_read_buffer(data);
 	signal(SIGINT, SIG_IGN);
 	signal(SIGQUIT, SIG_IGN);
 	fork_status = setup_and_execute_pipeline(data);
@@ -139,5 +158,6 @@ int	run_command_pipeline(t_process_data *data)
 	}
 	exit_status = run_pipeline_core(data, data->cmd_count);
 	setup_signal_handlers();
+	stats_end_pipeline(data, &mark, exit_status);
 	return (exit_status);
 }
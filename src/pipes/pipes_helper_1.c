@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 10:20:17 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 13:23:38 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 14:20:13 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -45,8 +45,7 @@ static void	setup_child_io(t_process_data *data, int i)
 			ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
 	}
 	close_free_pipes_recursively(data->pipes, 0, max_pipes);
-	redirect_io(data->cmds[i]->input_file, data->cmds[i]->output_file,
-		data->cmds[i]->output_mode);
+	redirect_io(data->cmds[i]->fd_ops);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -58,7 +57,10 @@ static void	setup_child_io(t_process_data *data, int i)
  *
  * For each command, fork a child, reset child signals, set up I/O, and
  * execute the command. On fork error, closes all pipes and frees parent
- * resources before exiting to avoid "still reachable" leaks.
+ * resources before exiting to avoid "still reachable" leaks. The inline
+ * stage is skipped with a pid of 0; see run_inline_stage(). Once a stage
+ * is forked, the parent closes its copies of the stage's redirection
+ * targets.
  *
  * @param data A pointer to the process data structure.
  * @param i The current index of the command to process.
@@ -68,25 +70,28 @@ int	fork_all_processes_recursive(t_process_data *data, int i)
 {
 	if (i >= data->cmd_count)
 		return (0);
-	data->pids[i] = fork();
+	trace_mark(data->trace, TRACE_FORK);
+	data->pids[i] = 0;
+	if (i != data->inline_stage)
+		data->pids[i] = fork();
 	if (data->pids[i] == -1)
 	{
 		close_free_pipes_recursively(data->pipes, 0, data->cmd_count - 1);
 		cleanup_pipeline_resources(data);
 		ft_error_and_exit("fork", strerror(errno), EXIT_FAILURE);
-		return (-1);
 	}
-	if (data->pids[i] == 0)
+	if (data->pids[i] == 0 && i != data->inline_stage)
 	{
+		trace_child(data->trace);
 		get_next_line_cleanup();
 		reset_child_signal_handlers();
 		setup_child_io(data, i);
 		execute_child_command(data->cmds[i], data);
-		if (data->last_exit_status != 0)
-			exit(data->last_exit_status);
-		else
-			exit(127);
+		if (data->last_exit_status == 0)
+			data->last_exit_status = 127;
+		exit(data->last_exit_status);
 	}
+	close_redirect_plan(data->cmds[i]->fd_ops);
 	return (fork_all_processes_recursive(data, i + 1));
 }
 
@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/09/03 12:01:47 by makhudon      #+#    #+#                 */
-/*   Updated: 2025/09/09 13:16:23 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 11:37:08 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,7 +43,7 @@ static void	validate_command_path(char *cmd_path, char *cmd_name,
 	}
 	if (S_ISDIR(st.st_mode))
 	{
-		free_split(envp);
+		free(envp);
 		cleanup_child_pipeline_resources(data);
 		ft_error_and_exit(cmd_name, "Is a directory", 126);
 	}
@@ -60,20 +60,24 @@ void	execute_child_command(t_command *cmd, t_process_data *data)
 	char	**envp;
 	int		e;
 
-	if (cmd->args == NULL || cmd->args[0] == NULL)
+	if (cmd->node != NULL)
+		run_compound_in_child(cmd, data);
+	if (cmd->args == NULL || is_assignment_only(cmd->args))
 	{
 		get_next_line_cleanup();
 		cleanup_child_pipeline_resources(data);
 		exit(0);
 	}
-	if (is_builtin(cmd->args[0]))
+	run_function_in_child(cmd, data);
+	if (is_builtin(cmd->args))
 		handle_builtin_command(cmd, data);
 	get_next_line_cleanup();
 	ft_strlcpy(namebuf, cmd->args[0], sizeof(namebuf));
-	envp = env_list_to_array(data->env_list);
+	envp = command_envp(data, cmd->env_prefix);
 	if (cmd->cmd_path == NULL)
 		handle_path_resolution_error(namebuf, envp, data);
 	validate_command_path(cmd->cmd_path, namebuf, envp, data);
+	trace_exec(data->trace);
 	execve(cmd->cmd_path, cmd->args, envp);
 	e = errno;
 	handle_execve_error_child(namebuf, envp, data, e);
@@ -107,13 +111,17 @@ static void	process_child_status(int status, t_wait_info *info,
 			info->signal_printed = 1;
 		}
 		if (is_last_child)
+		{
 			info->last_status = 128 + sig;
+			info->last_signal = sig;
+		}
 	}
 }
 
 /**
- * @brief Recursively waits for all children. On waitpid error, frees pids
- *        and exits with an error to avoid still-reachable memory.
+ * @brief Recursively waits for all children. On wait4 error, frees pids
+ *        and exits with an error to avoid still-reachable memory. Under
+ *        `time`, each child's resource usage is recorded as a stage.
  *
  * @param data  Process data (to free pids on fatal error).
  * @param index Current index in the pids array.
@@ -124,19 +132,23 @@ static void	process_child_status(int status, t_wait_info *info,
 static int	wait_all_children(t_process_data *data, int index, int max,
 									t_wait_info *info)
 {
-	int	status;
-	int	is_last_child;
-	int	saved;
+	struct rusage	ru;
+	int				status;
+	int				is_last_child;
+	int				saved;
 
 	if (index >= max)
 		return (info->last_status);
-	if (waitpid(data->pids[index], &status, 0) == -1)
+	if (wait_stage(data, index, &status, &ru) == -1)
 	{
 		saved = errno;
 		free(data->pids);
 		data->pids = NULL;
-		ft_error_and_exit("waitpid", strerror(saved), EXIT_FAILURE);
+		ft_error_and_exit("wait4", strerror(saved), EXIT_FAILURE);
 	}
+	if (data->timing != NULL)
+		record_child_usage(data->timing, data->cmds[index]->args,
+			get_exit_status(status), &ru);
 	is_last_child = (index == max - 1);
 	process_child_status(status, info, is_last_child);
 	return (wait_all_children(data, index + 1, max, info));
@@ -148,7 +160,12 @@ static int	wait_all_children(t_process_data *data, int index, int max,
 /**
  * @brief Executes the core logic of a command pipeline (parent side).
  *
- * Closes all pipes, waits for children, updates last status, and frees pids.
+ * Runs the inline stage if there is one, closes all pipes, waits for
+ * children, updates last status, and frees pids.
+ * Under MINISHELL_PIPE_PROFILE or an adaptive pipe size the children are
+ * watched until they exit before they are waited for. When a trailing
+ * `| cat` was optimized away, the status is the 0 cat would have exited
+ * with, unless the last stage died of a signal cat would have got too.
  */
 int	run_pipeline_core(t_process_data *data, int cmd_count)
 {
@@ -156,9 +173,17 @@ int	run_pipeline_core(t_process_data *data, int cmd_count)
 	t_wait_info	wait_state;
 
 	wait_state.last_status = 0;
+	wait_state.last_signal = 0;
 	wait_state.signal_printed = 0;
+	run_inline_stage(data);
+	trace_mark(data->trace, TRACE_WAIT);
+	monitor_pipeline(data);
 	close_free_pipes_recursively(data->pipes, 0, cmd_count - 1);
 	exit_status = wait_all_children(data, 0, cmd_count, &wait_state);
+	if (data->tail_elided && wait_state.last_signal != SIGINT
+		&& wait_state.last_signal != SIGQUIT
+		&& wait_state.last_signal != SIGPIPE)
+		exit_status = 0;
 	data->last_exit_status = exit_status;
 	free(data->pids);
 	data->pids = NULL;
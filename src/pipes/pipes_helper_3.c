@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/09/09 13:00:11 by tiyang        #+#    #+#                 */
-/*   Updated: 2025/09/09 13:05:14 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 11:37:08 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,9 +15,10 @@
 /**
  * @brief Handles the execution of a builtin command in a child process.
  *
- * This function runs the specified builtin command and ensures that
- * all child-owned pipeline resources are cleaned up before exiting
- * with the command's exit status.
+ * This function runs the specified builtin command (after the stages
+ * fused in front of it, if any) and ensures that all child-owned
+ * pipeline resources are cleaned up before exiting with the command's
+ * exit status.
  *
  * @param cmd The command structure containing the builtin command details.
  * @param data Pointer to the process data structure for resource management.
@@ -26,6 +27,8 @@ void	handle_builtin_command(t_command *cmd, t_process_data *data)
 {
 	int	status;
 
+	run_prelude(cmd, data);
+	apply_env_prefix(cmd->env_prefix, data);
 	status = run_builtin(cmd->args, data);
 	cleanup_child_pipeline_resources(data);
 	exit(status);
@@ -48,7 +51,7 @@ void	handle_path_resolution_error(char *cmd_name, char **envp,
 	int	has_slash;
 
 	has_slash = (ft_strchr(cmd_name, '/') != NULL);
-	free_split(envp);
+	free(envp);
 	cleanup_child_pipeline_resources(data);
 	if (has_slash)
 		ft_error_and_exit(cmd_name, "No such file or directory", 127);
@@ -69,7 +72,7 @@ void	handle_path_resolution_error(char *cmd_name, char **envp,
 void	handle_stat_error_child(char *cmd_name, char **envp,
 						t_process_data *data, int error_code)
 {
-	free_split(envp);
+	free(envp);
 	cleanup_child_pipeline_resources(data);
 	if (error_code == ENOTDIR)
 		ft_error_and_exit(cmd_name, "Not a directory", 126);
@@ -92,7 +95,7 @@ void	handle_stat_error_child(char *cmd_name, char **envp,
 void	handle_access_error_child(char *cmd_name, char **envp,
 						t_process_data *data, int error_code)
 {
-	free_split(envp);
+	free(envp);
 	cleanup_child_pipeline_resources(data);
 	if (error_code == EACCES)
 		ft_error_and_exit(cmd_name, "Permission denied", 126);
@@ -115,7 +118,7 @@ void	handle_access_error_child(char *cmd_name, char **envp,
 void	handle_execve_error_child(char *cmd_name, char **envp,
 						t_process_data *data, int error_code)
 {
-	free_split(envp);
+	free(envp);
 	cleanup_child_pipeline_resources(data);
 	if (error_code == ENOEXEC)
 		ft_error_and_exit(cmd_name, "Exec format error", 126);
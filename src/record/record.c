@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   record.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Opens the session log and writes its header and the starting
+ * environment.
+ *
+ * The environment may hold tokens and keys, so a new log is readable by
+ * its owner only, like the history file.
+ *
+ * @param path The file named by MINISHELL_RECORD.
+ * @param env_list The starting environment.
+ * @return The recorder, or NULL if the log cannot be opened.
+ */
+static t_recorder	*open_recorder(const char *path, t_env_var *env_list)
+{
+	t_recorder	*rec;
+
+	rec = ft_calloc(1, sizeof(t_recorder));
+	if (rec != NULL)
+		rec->buf = malloc(256);
+	if (rec == NULL || rec->buf == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	rec->cap = 256;
+	rec->fd = move_to_high_fd(open(path, O_WRONLY | O_CREAT | O_TRUNC
+				| O_CLOEXEC, 0600));
+	if (rec->fd == -1)
+	{
+		ft_error_with_arg(RECORD_ENV, (char *)path, strerror(errno));
+		free(rec->buf);
+		free(rec);
+		return (NULL);
+	}
+	rec->origin_us = timing_clock_us();
+	ft_memcpy(rec->buf, RECORD_MAGIC, RECORD_MAGIC_LEN);
+	rec->len = RECORD_MAGIC_LEN;
+	record_env_diff(rec, env_list);
+	record_flush(rec);
+	return (rec);
+}
+
+/**
+ * @brief Starts recording the session if MINISHELL_RECORD names a file.
+ *
+ * The variable is removed from the environment, so neither the log nor a
+ * shell started from this one sees it (a nested shell would truncate the
+ * log).
+ *
+ * @param pd The process data receiving the recorder.
+ */
+void	record_init(t_process_data *pd)
+{
+	t_env_var	*var;
+	char		*path;
+
+	var = find_env_var(RECORD_ENV, pd->env_list);
+	if (var == NULL || var->value == NULL || var->value[0] == '\0')
+		return ;
+	path = ft_strdup(var->value);
+	if (path == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	unset_shell_var(RECORD_ENV, pd);
+	pd->recorder = open_recorder(path, pd->env_list);
+	free(path);
+}
+
+/**
+ * @brief Notes the start of an accepted command line.
+ *
+ * @param pd The process data holding the recorder.
+ */
+void	record_begin(t_process_data *pd)
+{
+	if (pd->recorder != NULL)
+		pd->recorder->start_us = timing_clock_us();
+}
+
+/**
+ * @brief Logs a finished command line with its timing and exit status,
+ * and the environment changes it made.
+ *
+ * @param pd The process data holding the recorder.
+ * @param line The command line, as typed.
+ */
+void	record_end(t_process_data *pd, const char *line)
+{
+	t_recorder	*rec;
+	long long	now;
+
+	rec = pd->recorder;
+	if (rec == NULL || rec->fd < 0)
+		return ;
+	now = timing_clock_us();
+	record_put_byte(rec, RECORD_CMD);
+	record_put_varint(rec, rec->start_us - rec->origin_us);
+	record_put_varint(rec, now - rec->start_us);
+	record_put_varint(rec, (unsigned char)pd->last_exit_status);
+	record_put_string(rec, line);
+	record_env_diff(rec, pd->env_list);
+	record_flush(rec);
+}
+
+/**
+ * @brief Closes the session log and frees the recorder.
+ *
+ * Every line is written as soon as it finishes, so nothing is pending;
+ * a forked child can call this without duplicating entries.
+ *
+ * @param pd The process data holding the recorder.
+ */
+void	free_record(t_process_data *pd)
+{
+	t_recorder	*rec;
+
+	rec = pd->recorder;
+	if (rec == NULL)
+		return ;
+	if (rec->fd >= 0)
+		close(rec->fd);
+	free(rec->buf);
+	free_env(rec->env);
+	free(rec);
+	pd->recorder = NULL;
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   record_encode.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Makes room for `n` more bytes in the pending entries.
+ *
+ * @param rec The recorder.
+ * @param n The number of bytes about to be added.
+ */
+static void	record_reserve(t_recorder *rec, size_t n)
+{
+	char	*grown;
+
+	if (rec->len + n <= rec->cap)
+		return ;
+	while (rec->len + n > rec->cap)
+		rec->cap *= 2;
+	grown = malloc(rec->cap);
+	if (grown == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	ft_memcpy(grown, rec->buf, rec->len);
+	free(rec->buf);
+	rec->buf = grown;
+}
+
+/**
+ * @brief Appends one byte to the pending entries.
+ */
+void	record_put_byte(t_recorder *rec, unsigned char byte)
+{
+	record_reserve(rec, 1);
+	rec->buf[rec->len++] = byte;
+}
+
+/**
+ * @brief Appends a number as an LEB128 varint: seven bits per byte, low
+ * bits first, the top bit set on every byte but the last.
+ */
+void	record_put_varint(t_recorder *rec, unsigned long long value)
+{
+	while (value >= 0x80)
+	{
+		record_put_byte(rec, (unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	record_put_byte(rec, (unsigned char)value);
+}
+
+/**
+ * @brief Appends a string as its varint length and its bytes; NULL is
+ * written as the empty string.
+ */
+void	record_put_string(t_recorder *rec, const char *str)
+{
+	size_t	len;
+
+	len = 0;
+	if (str != NULL)
+		len = ft_strlen(str);
+	record_put_varint(rec, len);
+	if (len == 0)
+		return ;
+	record_reserve(rec, len);
+	ft_memcpy(rec->buf + rec->len, str, len);
+	rec->len += len;
+}
+
+/**
+ * @brief Writes the pending entries to the log.
+ *
+ * A failed write turns recording off rather than interrupting the
+ * session.
+ *
+ * @param rec The recorder.
+ */
+void	record_flush(t_recorder *rec)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < rec->len && rec->fd >= 0)
+	{
+		n = write(rec->fd, rec->buf + done, rec->len - done);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+		{
+			ft_error_with_arg(RECORD_ENV, "write", strerror(errno));
+			close(rec->fd);
+			rec->fd = -1;
+		}
+		else
+			done += (size_t)n;
+	}
+	rec->len = 0;
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   record_env.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 16:48:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 16:48:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Compares two variable values, either of which may be NULL (a
+ * variable exported without a value).
+ */
+static int	same_value(const char *a, const char *b)
+{
+	if (a == NULL || b == NULL)
+		return (a == b);
+	return (ft_strncmp(a, b, ft_strlen(a) + 1) == 0);
+}
+
+/**
+ * @brief Appends a RECORD_SET entry for every variable that is new or has
+ * changed since the last snapshot.
+ *
+ * @param rec The recorder.
+ * @param env_list The environment now.
+ * @return The number of entries appended.
+ */
+static int	diff_sets(t_recorder *rec, t_env_var *env_list)
+{
+	t_env_var	*old;
+	int			count;
+
+	count = 0;
+	while (env_list != NULL)
+	{
+		old = find_env_var(env_list->key, rec->env);
+		if (old == NULL || !same_value(old->value, env_list->value))
+		{
+			record_put_byte(rec, RECORD_SET);
+			record_put_string(rec, env_list->key);
+			record_put_string(rec, env_list->value);
+			count++;
+		}
+		env_list = env_list->next;
+	}
+	return (count);
+}
+
+/**
+ * @brief Appends a RECORD_UNSET entry for every variable of the last
+ * snapshot that is gone.
+ *
+ * @param rec The recorder.
+ * @param env_list The environment now.
+ * @return The number of entries appended.
+ */
+static int	diff_unsets(t_recorder *rec, t_env_var *env_list)
+{
+	t_env_var	*old;
+	int			count;
+
+	count = 0;
+	old = rec->env;
+	while (old != NULL)
+	{
+		if (find_env_var(old->key, env_list) == NULL)
+		{
+			record_put_byte(rec, RECORD_UNSET);
+			record_put_string(rec, old->key);
+			count++;
+		}
+		old = old->next;
+	}
+	return (count);
+}
+
+/**
+ * @brief Appends the changes to the environment since the last call, and
+ * takes a new snapshot if there were any.
+ *
+ * Diffing walks both lists once per variable, which is cheap next to the
+ * command line it follows and costs nothing when recording is off.
+ *
+ * @param rec The recorder.
+ * @param env_list The environment now.
+ */
+void	record_env_diff(t_recorder *rec, t_env_var *env_list)
+{
+	int	changed;
+
+	changed = diff_sets(rec, env_list);
+	changed += diff_unsets(rec, env_list);
+	if (changed == 0)
+		return ;
+	free_env(rec->env);
+	rec->env = duplicate_env_list(env_list);
+	if (rec->env == NULL && env_list != NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+}
@@ -6,36 +6,27 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/04 10:15:34 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/04 09:44:07 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Event hook for readline to handle signals during heredoc input.
+ * @brief Adds one line to the body of a heredoc, expanding its
+ *        variables unless the delimiter was quoted.
  *
- * This function is called periodically by readline while waiting
- * for user input. It checks if a signal has been received
- * (e.g., SIGINT) and returns 1 to interrupt the input process if so.
- * Otherwise, it returns 0 to continue waiting.
- *
- * @return 1 if a signal was received, 0 otherwise.
+ * @param line The line read; freed by this function.
+ * @param ctx The heredoc being collected.
+ * @return 1, to go on reading.
  */
-static int	write_heredoc_line(char *line, int fd, int expand_content,
-									t_expand_data *data)
+static int	write_heredoc_line(char *line, t_heredoc_context *ctx)
 {
-	char	*expanded_line;
-
-	if (expand_content)
-	{
-		expanded_line = expand_heredoc_line(line, data);
-		ft_putstr_fd(expanded_line, fd);
-		free(expanded_line);
-	}
+	if (ctx->expand_content)
+		expand_heredoc_line(line, ctx);
 	else
-		ft_putstr_fd(line, fd);
-	ft_putstr_fd("\n", fd);
+		heredoc_append(ctx, line, ft_strlen(line));
+	heredoc_append(ctx, "\n", 1);
 	free(line);
 	return (1);
 }
@@ -45,58 +36,57 @@ static int	write_heredoc_line(char *line, int fd, int expand_content,
  *        and processing the delimiter.
  *
  * This function removes quotes from the delimiter if present, generates a unique
- * temporary filename for the heredoc, and opens the file for writing. It handles
- * errors appropriately and returns 1 on success or 0 on failure.
+ * temporary filename for the heredoc, and opens the file for writing. The
+ * body starts out empty; it is read from the terminal with readline() only
+ * if standard input is one.
  *
  * @param delimiter The original delimiter string (may contain quotes).
- * @param actual_delimiter Pointer to store the processed delimiter
- *                         without quotes.
- * @param tmp_filename Pointer to store the generated temporary filename.
- * @param fd Pointer to store the file descriptor of the opened temporary file.
+ * @param ctx The heredoc context to fill in.
  * @return 1 on success, 0 on failure.
  */
-static int	setup_heredoc(const char *delimiter, char **actual_delimiter,
-								char **tmp_filename, int *fd)
+static int	setup_heredoc(const char *delimiter, t_heredoc_context *ctx)
 {
-	*actual_delimiter = remove_quotes_and_join((char *)delimiter);
-	if (*actual_delimiter == NULL)
+	ctx->body = NULL;
+	ctx->len = 0;
+	ctx->cap = 0;
+	ctx->interactive = isatty(STDIN_FILENO);
+	ctx->actual_delimiter = remove_quotes_and_join((char *)delimiter);
+	if (ctx->actual_delimiter == NULL)
 		return (0);
-	*tmp_filename = generate_unique_heredoc_file(fd);
-	if (*tmp_filename == NULL)
+	ctx->tmp_filename = generate_unique_heredoc_file(&ctx->fd);
+	if (ctx->tmp_filename == NULL)
 	{
-		free(*actual_delimiter);
+		free(ctx->actual_delimiter);
 		ft_error_and_exit("heredoc", strerror(errno), EXIT_FAILURE);
 		return (0);
 	}
+	rl_event_hook = signal_event_hook;
 	return (1);
 }
 
 /**
  * @brief Processes a single line of heredoc input.
  *
- * This function reads a line from the user, checks for signals, compares
- * it to the delimiter, and writes it to the heredoc file if appropriate.
+ * This function reads a line (see read_heredoc_line()), checks for
+ * signals, compares it to the delimiter, and adds it to the body of the
+ * heredoc if appropriate.
  *
  * @param line Pointer to store the read line.
- * @param fd The file descriptor of the heredoc file.
- * @param expand_content Flag indicating if to expand variables in the line.
- * @param data Pointer to the expansion data structure.
- * @param actual_delimiter The processed delimiter string.
- * @param tmp_filename The temporary filename for cleanup on interrupt.
+ * @param ctx The heredoc being collected.
  * @return 1 to continue, 0 on interrupt or error, or 1 if delimiter is reached.
  */
 static int	process_heredoc_input(char **line, t_heredoc_context *ctx)
 {
-	*line = readline("> ");
+	*line = read_heredoc_line(ctx);
 	if (g_signal_received == SIGINT)
 	{
-		cleanup_heredoc(*line, ctx->fd, ctx->tmp_filename,
-			ctx->actual_delimiter);
+		cleanup_heredoc(*line, ctx);
 		return (0);
 	}
 	if (*line == NULL)
 	{
-		handle_eof_warning(ctx->actual_delimiter);
+		if (ctx->replay == NULL)
+			handle_eof_warning(ctx->actual_delimiter);
 		return (1);
 	}
 	if (ft_strncmp(*line, ctx->actual_delimiter,
@@ -106,47 +96,42 @@ static int	process_heredoc_input(char **line, t_heredoc_context *ctx)
 		*line = NULL;
 		return (1);
 	}
-	return (write_heredoc_line(*line, ctx->fd, ctx->expand_content, ctx->data));
+	return (write_heredoc_line(*line, ctx));
 }
 
 /**
  * @brief Handles heredoc (<<) input by reading from stdin.
  *
- * Reads input from the user line by line until the specified delimiter
- * is entered. The input is written to a unique temporary file.
+ * Reads input line by line until the specified delimiter is entered,
+ * gathering the body in memory, then writes it to a unique temporary
+ * file at once. A command parsed as part of a script replays the body
+ * read with it instead (see sp_take_heredocs()).
  *
  * @param delimiter The string that signals the end of input.
- * @param env_list The linked list of environment variables for expansion.
- * @param last_exit_status The last exit status for $? expansion.
+ * @param pd The process data, used for variable expansion.
  * @return The path to the temporary file, or NULL on failure.
  */
-char	*handle_heredoc(const char *delimiter, t_env_var *env_list,
-	int last_exit_status)
+char	*handle_heredoc(const char *delimiter, t_process_data *pd)
 {
 	char				*line;
 	t_heredoc_context	ctx;
 	t_expand_data		expand_data;
 
-	expand_data.env_list = env_list;
-	expand_data.last_exit_status = last_exit_status;
+	fill_expand_data(&expand_data, pd);
 	ctx.expand_content = !(ft_strchr(delimiter, '\'')
 			|| ft_strchr(delimiter, '"'));
 	ctx.data = &expand_data;
-	if (!setup_heredoc(delimiter, &ctx.actual_delimiter,
-			&ctx.tmp_filename, &ctx.fd))
+	ctx.replay = NULL;
+	if (pd->heredocs != NULL && *pd->heredocs != NULL)
+		ctx.replay = *pd->heredocs++;
+	if (!setup_heredoc(delimiter, &ctx))
 		return (NULL);
-	rl_event_hook = signal_event_hook;
-	while (1)
+	while (process_heredoc_input(&line, &ctx))
 	{
-		if (!process_heredoc_input(&line, &ctx))
-			return (NULL);
 		if (line == NULL)
-			break ;
+			return (finish_heredoc(&ctx));
 	}
-	close(ctx.fd);
-	free(ctx.actual_delimiter);
-	rl_event_hook = NULL;
-	return (ctx.tmp_filename);
+	return (NULL);
 }
 
 /**
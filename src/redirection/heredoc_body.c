@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_body.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 16:45:27 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:44 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Appends bytes to the body of a heredoc, growing it as needed.
+ *
+ * The buffer doubles when full, so collecting a body costs time linear
+ * in its size.
+ *
+ * @param ctx The heredoc being collected.
+ * @param s The bytes to append.
+ * @param n The number of bytes.
+ */
+void	heredoc_append(t_heredoc_context *ctx, const char *s, size_t n)
+{
+	char	*grown;
+
+	if (ctx->len + n >= ctx->cap)
+	{
+		if (ctx->cap == 0)
+			ctx->cap = 256;
+		while (ctx->len + n >= ctx->cap)
+			ctx->cap *= 2;
+		grown = malloc(ctx->cap);
+		if (grown == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		if (ctx->body != NULL)
+			ft_memcpy(grown, ctx->body, ctx->len);
+		free(ctx->body);
+		ctx->body = grown;
+	}
+	ft_memcpy(ctx->body + ctx->len, s, n);
+	ctx->len += n;
+}
+
+/**
+ * @brief Tells whether the `$` at `s[0]` starts a variable in a heredoc.
+ */
+static int	starts_heredoc_var(const char *s)
+{
+	return (s[0] == '$'
+		&& (ft_isalnum(s[1]) || s[1] == '_' || s[1] == '?' || s[1] == '{'));
+}
+
+/**
+ * @brief Expands the variables of one heredoc line into its body.
+ *
+ * Text between variables is copied in one piece, and each value is
+ * appended once, so the line is expanded in linear time.
+ *
+ * @param line The line, without its newline.
+ * @param ctx The heredoc being collected.
+ */
+void	expand_heredoc_line(char *line, t_heredoc_context *ctx)
+{
+	char	*value;
+	size_t	start;
+	size_t	i;
+
+	i = 0;
+	while (line[i] != '\0')
+	{
+		start = i;
+		while (line[i] != '\0' && !starts_heredoc_var(line + i))
+			i++;
+		heredoc_append(ctx, line + start, i - start);
+		if (line[i] == '\0')
+			break ;
+		value = ft_strdup("");
+		if (value == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		i = handle_variable_expansion(line, i, &value, ctx->data);
+		if (value == NULL)
+			ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+		heredoc_append(ctx, value, ft_strlen(value));
+		free(value);
+	}
+}
+
+/**
+ * @brief Takes the next line of a body read with the script.
+ *
+ * @param ctx The heredoc being replayed.
+ * @return The line without its newline, or NULL at the end of the body.
+ */
+static char	*replay_heredoc_line(t_heredoc_context *ctx)
+{
+	const char	*nl;
+	char		*line;
+
+	if (*ctx->replay == '\0')
+		return (NULL);
+	nl = ft_strchr(ctx->replay, '\n');
+	if (nl == NULL)
+		nl = ctx->replay + ft_strlen(ctx->replay);
+	line = malloc(nl - ctx->replay + 1);
+	if (line == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	ft_memcpy(line, ctx->replay, nl - ctx->replay);
+	line[nl - ctx->replay] = '\0';
+	ctx->replay = nl + (*nl == '\n');
+	return (line);
+}
+
+/**
+ * @brief Reads the next line of a heredoc body.
+ *
+ * A body read with the script is replayed. Otherwise, at a terminal the
+ * line is read with readline(), and elsewhere it comes from the same
+ * buffered reader as the script itself, so the body is the lines that
+ * follow the command, and nothing is read ahead and lost.
+ *
+ * @param ctx The heredoc being collected.
+ * @return The line without its newline, or NULL at end of input.
+ */
+char	*read_heredoc_line(t_heredoc_context *ctx)
+{
+	char	*line;
+	char	*nl;
+
+	if (ctx->replay != NULL)
+		return (replay_heredoc_line(ctx));
+	if (ctx->interactive)
+		return (readline("> "));
+	line = get_next_line(STDIN_FILENO);
+	if (line == NULL)
+		return (NULL);
+	nl = ft_strchr(line, '\n');
+	if (nl != NULL)
+		*nl = '\0';
+	return (line);
+}
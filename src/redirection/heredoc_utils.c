@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/03 12:16:13 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/04 09:50:47 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 16:45:27 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,23 +57,21 @@ char	*generate_unique_heredoc_file(int *out_fd)
 /**
  * @brief Cleans up resources used during heredoc processing.
  *
- * This function frees the provided line, closes the file descriptor,
- * unlinks (deletes) the temporary heredoc file, and frees the associated
- * filename and delimiter strings.
+ * This function frees the provided line and the body gathered so far,
+ * closes the file descriptor, unlinks (deletes) the temporary heredoc
+ * file, and frees the associated filename and delimiter strings.
  *
  * @param line The line buffer to free.
- * @param fd The file descriptor to close.
- * @param tmp_filename The temporary filename to unlink and free.
- * @param actual_delimiter The actual delimiter string to free.
+ * @param ctx The heredoc being collected.
  */
-void	cleanup_heredoc(char *line, int fd, char *tmp_filename,
-								char *actual_delimiter)
+void	cleanup_heredoc(char *line, t_heredoc_context *ctx)
 {
 	free(line);
-	close(fd);
-	unlink(tmp_filename);
-	free(tmp_filename);
-	free(actual_delimiter);
+	free(ctx->body);
+	close(ctx->fd);
+	unlink(ctx->tmp_filename);
+	free(ctx->tmp_filename);
+	free(ctx->actual_delimiter);
 	rl_event_hook = NULL;
 }
 
@@ -94,67 +92,30 @@ void	handle_eof_warning(const char *actual_delimiter)
 }
 
 /**
- * @brief Writes a line to the heredoc file, expanding variables if needed.
+ * @brief Ends a heredoc whose body has been read in full.
  *
- * This function expands the line if `expand_content` is true, then writes
- * the (possibly expanded) line followed by a newline to the provided file
- * descriptor.
+ * The body is written to the temporary file with as few write() calls
+ * as possible, and the context is released.
  *
- * @param line The line to write.
- * @param fd The file descriptor of the heredoc file.
- * @param expand_content Whether to expand variables in the line.
- * @param data The expansion data containing environment variables
- *             and last exit status.
- * @return 1 on success, 0 on failure.
+ * @param ctx The heredoc being collected.
+ * @return The path to the temporary file, or NULL if it could not be
+ *         written.
  */
-char	*process_variable(char *line, size_t *i, char *result,
-								t_expand_data *data)
+char	*finish_heredoc(t_heredoc_context *ctx)
 {
-	char	next_char;
+	char	*tmp_filename;
 
-	next_char = line[*i + 1];
-	if (ft_isalnum(next_char) || next_char == '_' || next_char == '?')
-		*i = handle_variable_expansion(line, *i, &result, data);
-	else
+	if (ctx->len > 0 && write_all(ctx->fd, ctx->body, ctx->len) == -1)
 	{
-		result = append_char(result, line[*i]);
-		(*i)++;
-	}
-	return (result);
-}
-
-/**
- * @brief Processes a single line of heredoc input.
- *
- * This function checks for signal interrupts, EOF, and the delimiter.
- * If the line is valid, it writes it to the heredoc file, expanding
- * variables if necessary.
- *
- * @param line A pointer to the line buffer. This may be set to NULL
- * if the delimiter is reached or EOF occurs.
- * @param ctx The heredoc context containing file descriptor, expansion
- * settings, and other relevant data.
- * @return 1 if processing should continue, 0 on error or if the line
- * was NULL (indicating end of input).
- */
-char	*expand_heredoc_line(char *line, t_expand_data *data)
-{
-	char	*result;
-	size_t	i;
-
-	result = ft_strdup("");
-	if (result == NULL)
+		ft_error("heredoc", strerror(errno));
+		cleanup_heredoc(NULL, ctx);
 		return (NULL);
-	i = 0;
-	while (line[i] != '\0')
-	{
-		if (line[i] == '$')
-			result = process_variable(line, &i, result, data);
-		else
-		{
-			result = append_char(result, line[i]);
-			i++;
-		}
 	}
-	return (result);
+	tmp_filename = ctx->tmp_filename;
+	ctx->tmp_filename = NULL;
+	free(ctx->body);
+	close(ctx->fd);
+	free(ctx->actual_delimiter);
+	rl_event_hook = NULL;
+	return (tmp_filename);
 }
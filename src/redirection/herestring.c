@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herestring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 18:03:52 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/21 18:03:52 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <sys/mman.h>
+
+/**
+ * @brief Delivers a herestring through a pipe, if it fits in one.
+ *
+ * The whole text is written before the command runs, so it must fit in
+ * the pipe buffer: a write that blocked would block the shell itself.
+ *
+ * @param text The word of the herestring.
+ * @param len Its length.
+ * @return The read end of the pipe, -1 on error, or -2 if the text does
+ *         not fit.
+ */
+static int	herestring_pipe(const char *text, size_t len)
+{
+	int	fds[2];
+	int	cap;
+
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+	cap = fcntl(fds[1], F_GETPIPE_SZ);
+	if (cap < 0 || len + 1 > (size_t)cap)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return (-2);
+	}
+	if (write_all(fds[1], text, len) == -1
+		|| write_all(fds[1], "\n", 1) == -1)
+	{
+		close(fds[0]);
+		fds[0] = -1;
+	}
+	close(fds[1]);
+	return (fds[0]);
+}
+
+/**
+ * @brief Delivers a herestring too large for a pipe through an anonymous
+ * in-memory file, rewound to its start.
+ *
+ * @param text The word of the herestring.
+ * @param len Its length.
+ * @return The descriptor, or -1 on error.
+ */
+static int	herestring_memfd(const char *text, size_t len)
+{
+	int	fd;
+
+	fd = memfd_create("herestring", MFD_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	if (write_all(fd, text, len) == -1 || write_all(fd, "\n", 1) == -1
+		|| lseek(fd, 0, SEEK_SET) == -1)
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Handles a herestring, `<<< word`: the command reads the
+ * expanded word, followed by a newline.
+ *
+ * Unlike a heredoc, no temporary file is created. The text is held by a
+ * pipe, or by a memfd when it is larger than the pipe buffer, and the
+ * descriptor joins the command's redirection list like an opened file.
+ *
+ * @param args The token list.
+ * @param i The index of the redirection token.
+ * @param exec_data A pointer to the t_execute_data struct.
+ * @return 0 on success, -1 on error.
+ */
+int	handle_herestring_redirection(char **args, int i,
+										t_execute_data *exec_data)
+{
+	t_fd_op	*op;
+	size_t	len;
+	int		src;
+	int		fd;
+
+	redirect_kind(args[i], &fd);
+	len = ft_strlen(args[i + 1]);
+	src = herestring_pipe(args[i + 1], len);
+	if (src == -2)
+		src = herestring_memfd(args[i + 1], len);
+	if (src == -1)
+	{
+		ft_error("herestring", strerror(errno));
+		return (-1);
+	}
+	op = add_fd_op(&exec_data->fd_ops, FD_OPEN, fd, "<<<");
+	op->src = src;
+	return (0);
+}
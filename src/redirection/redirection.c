@@ -6,28 +6,24 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 08:25:34 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/03 15:53:46 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/21 14:20:13 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Opens and redirects input from a file.
+ * @brief Applies the redirections of a command in its child.
  *
- * This function opens the specified input file for reading and
- * redirects the standard input (stdin) to read from this file.
- * If the file cannot be opened, it prints an error message and
- * exits the process.
+ * The steps are applied in order, so `>out 2>&1` and `2>&1 >out` differ
+ * as they should. A failed step ends the child with status 1.
  *
- * @param input_file The name of the input file to open.
+ * @param ops The redirection list; its targets are consumed.
  */
-void	redirect_io(char *input_file, char *output_file, int output_mode)
+void	redirect_io(t_fd_op *ops)
 {
-	if (input_file)
-		open_and_redirect_input(input_file);
-	if (output_file)
-		open_and_redirect_output(output_file, output_mode);
+	if (apply_fd_ops(ops, 0) != 0)
+		exit(EXIT_FAILURE);
 }
 
 /**
@@ -102,13 +98,30 @@ static int	process_all_redirections_loop(char **args,
 	return (argc);
 }
 
+/**
+ * @brief Releases what the redirections parsed so far have set up, after
+ *        one of them failed.
+ *
+ * @param exec_data The t_execute_data struct being populated.
+ */
+static void	discard_redirections(t_execute_data *exec_data)
+{
+	free_fd_ops(&exec_data->fd_ops);
+	if (exec_data->heredoc_file)
+	{
+		unlink(exec_data->heredoc_file);
+		free(exec_data->heredoc_file);
+		exec_data->heredoc_file = NULL;
+	}
+}
+
 /**
  * @brief Parses args for multiple redirections and
  *        returns a clean command array.
  *
- * This function handles all I/O redirection parsing,
- * populating the `t_execute_data` struct with the final
- * input/output files and mode.
+ * This function handles all I/O redirection parsing, populating the
+ * `t_execute_data` struct with the ordered list of redirections. Every
+ * target is opened once, here (see open_redirect_target()).
  *
  * @param args The original token array.
  * @param process_data A struct containing process-specific data.
@@ -121,24 +134,15 @@ char	**handle_redirection(char **args, t_process_data *process_data,
 {
 	int	argc;
 
-	exec_data->input_file = NULL;
-	exec_data->output_file = NULL;
-	exec_data->output_mode = 0;
+	trace_mark(process_data->trace, TRACE_REDIRECT);
+	exec_data->fd_ops = NULL;
 	exec_data->heredoc_file = NULL;
 	argc = process_all_redirections_loop(args, process_data, exec_data);
 	if (argc == -1)
 	{
-		if (exec_data->heredoc_file)
-		{
-			unlink(exec_data->heredoc_file);
-			free(exec_data->heredoc_file);
-			exec_data->heredoc_file = NULL;
-		}
-		free(exec_data->input_file);
-		free(exec_data->output_file);
-		exec_data->input_file = NULL;
-		exec_data->output_file = NULL;
+		discard_redirections(exec_data);
 		return (NULL);
 	}
+	relocate_plan_fds(exec_data->fd_ops);
 	return (build_clean_args(args, argc));
 }
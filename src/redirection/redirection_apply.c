@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirection_apply.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 14:20:13 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 19:26:13 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Performs one step of a redirection list.
+ *
+ * The target of an FD_OPEN step is consumed: its descriptor is closed
+ * once it has been moved where it belongs. A target left unopened by
+ * handle_redirection() is opened now, by name; see
+ * ready_redirect_target().
+ *
+ * @param op The step.
+ * @return 0 on success, -1 after reporting the error.
+ */
+static int	apply_fd_op(t_fd_op *op)
+{
+	int	src;
+	int	ret;
+
+	if (op->type == FD_CLOSE)
+		return (close(op->fd), 0);
+	src = op->src;
+	if (op->type == FD_OPEN)
+		src = ready_redirect_target(op);
+	if (src < 0)
+		return (ft_error(op->name, strerror(errno)), -1);
+	if (src == op->fd)
+		ret = fcntl(src, F_SETFD, 0);
+	else
+		ret = dup2(src, op->fd);
+	if (ret == -1)
+		ft_error(op->name, strerror(errno));
+	if (op->type == FD_OPEN && src != op->fd)
+		close(src);
+	if (op->type == FD_OPEN)
+		op->src = -1;
+	if (ret == -1)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Applies a command's redirections, in order.
+ *
+ * With `save`, each descriptor is first copied out of the way (above
+ * REDIR_FD_BASE, close-on-exec) so that restore_fd_ops() can put it back
+ * once a builtin is done. Without it the changes are for good, as in a
+ * child or for `exec`.
+ *
+ * @param ops The redirection list.
+ * @param save Whether to save the descriptors being changed.
+ * @return 0 on success, -1 after reporting the step that failed.
+ */
+int	apply_fd_ops(t_fd_op *ops, int save)
+{
+	while (ops != NULL)
+	{
+		if (save)
+			ops->saved = fcntl(ops->fd, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+		if (apply_fd_op(ops) != 0)
+			return (-1);
+		ops = ops->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Undoes apply_fd_ops() with `save`, last step first.
+ *
+ * A descriptor that was closed before is closed again.
+ *
+ * @param ops The redirection list.
+ */
+void	restore_fd_ops(t_fd_op *ops)
+{
+	if (ops == NULL)
+		return ;
+	restore_fd_ops(ops->next);
+	if (ops->saved == FD_UNSAVED)
+		return ;
+	if (ops->saved >= 0)
+	{
+		if (dup2(ops->saved, ops->fd) == -1)
+			ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
+		close(ops->saved);
+	}
+	else
+		close(ops->fd);
+	ops->saved = FD_UNSAVED;
+}
+
+/**
+ * @brief Tells whether a step of a redirection list names descriptor
+ * `fd`, as the one it redirects or the one it copies.
+ */
+static int	fd_named(t_fd_op *ops, int fd)
+{
+	while (ops != NULL)
+	{
+		if (ops->fd == fd || (ops->type == FD_DUP && ops->src == fd))
+			return (1);
+		ops = ops->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Moves the targets of a redirection list out of the way of the
+ * descriptors it names.
+ *
+ * Targets are opened at the lowest free numbers, so in `4>a 3>b` the
+ * file `a` may sit on descriptor 3 and be replaced by `b` before it is
+ * moved to 4. Such a target is moved to REDIR_FD_BASE or above first.
+ * With only 0, 1 and 2 named, as usual, nothing is moved.
+ *
+ * @param ops The redirection list.
+ */
+void	relocate_plan_fds(t_fd_op *ops)
+{
+	t_fd_op	*op;
+	int		fd;
+
+	op = ops;
+	while (op != NULL)
+	{
+		if (op->type == FD_OPEN && op->src >= 0 && fd_named(ops, op->src))
+		{
+			fd = fcntl(op->src, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+			if (fd >= 0)
+			{
+				close(op->src);
+				op->src = fd;
+			}
+		}
+		op = op->next;
+	}
+}
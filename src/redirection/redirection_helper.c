@@ -6,77 +6,100 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/03 15:36:56 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 12:19:19 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/25 19:26:13 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Handles an output append redirection.
+ * @brief Handles a redirection to or from a file: `<`, `>`, `>>`, `<>`.
+ *
+ * The file is opened now, for the command's redirection list. Within a
+ * pipeline an input file that cannot be opened is not an error yet: it
+ * is opened again by the stage's child, which reports the error itself
+ * while the other stages run.
  *
  * @param args The token list.
  * @param i The index of the redirection token.
+ * @param process_data A pointer to the global process data.
  * @param exec_data A pointer to the t_execute_data struct.
  * @return 0 on success, -1 on a file creation/access error.
  */
-static int	handle_output_append(char **args, int i, t_execute_data *exec_data)
+static int	handle_file_redirection(char **args, int i,
+						t_process_data *process_data, t_execute_data *exec_data)
 {
-	if (process_output_file(args[i + 1], 1) != 0)
-		return (-1);
-	free(exec_data->output_file);
-	exec_data->output_file = ft_strdup(args[i + 1]);
-	exec_data->output_mode = 2;
-	return (0);
+	t_redir_kind	kind;
+	t_fd_op			*op;
+	int				fd;
+
+	kind = redirect_kind(args[i], &fd);
+	op = add_fd_op(&exec_data->fd_ops, FD_OPEN, fd, args[i + 1]);
+	op->flags = redirect_open_flags(kind);
+	if (open_redirect_target(op) == 0)
+		return (0);
+	if (kind == REDIR_IN && process_data->in_pipeline != 0)
+		return (0);
+	ft_error(args[i + 1], strerror(errno));
+	return (-1);
 }
 
 /**
- * @brief Handles an input redirection.
+ * @brief Handles `>&word` where `word` is not a number: both standard
+ * output and standard error go to the file `word`.
  *
- * @param args The token list.
- * @param i The index of the redirection token.
- * @param process_data A pointer to the global process data.
+ * @param word The file.
  * @param exec_data A pointer to the t_execute_data struct.
- * @return 0 on success, -1 on a file access error.
+ * @return 0 on success, -1 on a file creation/access error.
  */
-static int	handle_input_redirection(char **args, int i,
-						t_process_data *process_data, t_execute_data *exec_data)
+static int	handle_output_and_error(char *word, t_execute_data *exec_data)
 {
-	free(exec_data->input_file);
-	exec_data->input_file = ft_strdup(args[i + 1]);
-	if (process_data->in_pipeline == 0)
+	t_fd_op	*op;
+
+	op = add_fd_op(&exec_data->fd_ops, FD_OPEN, STDOUT_FILENO, word);
+	op->flags = redirect_open_flags(REDIR_OUT);
+	if (open_redirect_target(op) != 0)
 	{
-		if (access(exec_data->input_file, F_OK) != 0)
-		{
-			ft_error(args[i + 1], "No such file or directory");
-			return (-1);
-		}
-		if (access(exec_data->input_file, R_OK) != 0)
-		{
-			ft_error(args[i + 1], "Permission denied");
-			return (-1);
-		}
+		ft_error(word, strerror(errno));
+		return (-1);
 	}
+	op = add_fd_op(&exec_data->fd_ops, FD_DUP, STDERR_FILENO, "1");
+	op->src = STDOUT_FILENO;
 	return (0);
 }
 
 /**
- * @brief Handles an output truncation redirection.
+ * @brief Handles a descriptor duplication: `N<&M`, `N>&M`, or `N>&-` to
+ * close descriptor N.
  *
  * @param args The token list.
  * @param i The index of the redirection token.
  * @param exec_data A pointer to the t_execute_data struct.
- * @return 0 on success, -1 on a file creation/access error.
+ * @return 0 on success, -1 if the word after the operator is not usable.
  */
-static int	handle_output_truncation(char **args, int i,
+static int	handle_dup_redirection(char **args, int i,
 										t_execute_data *exec_data)
 {
-	if (process_output_file(args[i + 1], 0) != 0)
-		return (-1);
-	free(exec_data->output_file);
-	exec_data->output_file = ft_strdup(args[i + 1]);
-	exec_data->output_mode = 1;
-	return (0);
+	t_redir_kind	kind;
+	t_fd_op			*op;
+	int				fd;
+
+	kind = redirect_kind(args[i], &fd);
+	if (ft_strncmp(args[i + 1], "-", 2) == 0)
+	{
+		add_fd_op(&exec_data->fd_ops, FD_CLOSE, fd, args[i + 1]);
+		return (0);
+	}
+	if (is_fd_number(args[i + 1]))
+	{
+		op = add_fd_op(&exec_data->fd_ops, FD_DUP, fd, args[i + 1]);
+		op->src = ft_atoi(args[i + 1]);
+		return (0);
+	}
+	if (kind == REDIR_DUP_OUT && args[i][0] == '>')
+		return (handle_output_and_error(args[i + 1], exec_data));
+	ft_error(args[i + 1], "ambiguous redirect");
+	return (-1);
 }
 
 /**
@@ -91,18 +114,22 @@ static int	handle_output_truncation(char **args, int i,
 static int	handle_heredoc_redirection(char **args, int i,
 				t_process_data *process_data, t_execute_data *exec_data)
 {
+	t_fd_op	*op;
+	int		fd;
+
+	redirect_kind(args[i], &fd);
 	if (exec_data->heredoc_file)
 	{
 		unlink(exec_data->heredoc_file);
 		free(exec_data->heredoc_file);
 		exec_data->heredoc_file = NULL;
 	}
-	exec_data->heredoc_file = handle_heredoc(args[i + 1],
-			process_data->env_list, process_data->last_exit_status);
+	exec_data->heredoc_file = handle_heredoc(args[i + 1], process_data);
 	if (exec_data->heredoc_file == NULL)
 		return (-1);
-	free(exec_data->input_file);
-	exec_data->input_file = ft_strdup(exec_data->heredoc_file);
+	op = add_fd_op(&exec_data->fd_ops, FD_OPEN, fd, exec_data->heredoc_file);
+	op->flags = redirect_open_flags(REDIR_HEREDOC);
+	open_redirect_target(op);
 	return (0);
 }
 
@@ -122,8 +149,9 @@ static int	handle_heredoc_redirection(char **args, int i,
 int	process_redirection_token(char **args, int i, t_process_data *process_data,
 								t_execute_data *exec_data)
 {
-	char	*msg;
-	char	*full_msg;
+	char			*msg;
+	char			*full_msg;
+	t_redir_kind	kind;
 
 	if (args[i + 1] == NULL)
 	{
@@ -138,13 +166,12 @@ int	process_redirection_token(char **args, int i, t_process_data *process_data,
 		free(msg);
 		return (free(full_msg), -1);
 	}
-	if (ft_strncmp(args[i], "<<", 3) == 0)
+	kind = redirect_kind(args[i], NULL);
+	if (kind == REDIR_HEREDOC)
 		return (handle_heredoc_redirection(args, i, process_data, exec_data));
-	else if (ft_strncmp(args[i], "<", 2) == 0)
-		return (handle_input_redirection(args, i, process_data, exec_data));
-	else if (ft_strncmp(args[i], ">", 2) == 0)
-		return (handle_output_truncation(args, i, exec_data));
-	else if (ft_strncmp(args[i], ">>", 3) == 0)
-		return (handle_output_append(args, i, exec_data));
-	return (0);
+	if (kind == REDIR_HERESTRING)
+		return (handle_herestring_redirection(args, i, exec_data));
+	if (kind == REDIR_DUP_IN || kind == REDIR_DUP_OUT)
+		return (handle_dup_redirection(args, i, exec_data));
+	return (handle_file_redirection(args, i, process_data, exec_data));
 }
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirection_open.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 19:26:13 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 19:26:13 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <poll.h>
+
+/**
+ * @brief Opens a redirection target for the command's redirection list.
+ *
+ * Each target is opened exactly once, here in the parent, and with
+ * O_CLOEXEC: the child dup2()s the descriptor where it belongs, and no
+ * program it runs inherits the original. The open is non-blocking, so a
+ * FIFO never blocks the shell, and the file is looked up only once:
+ * - a FIFO with no reader yet (ENXIO) is left to be opened by name when
+ *   the redirection is applied;
+ * - a FIFO opened for reading is kept, with O_NONBLOCK added to `flags`,
+ *   and waited on when applied; see ready_redirect_target();
+ * - anything else but a regular file, which ignores the flag, is made
+ *   blocking again.
+ *
+ * @param op The FD_OPEN step, with `name` and `flags` set; `src`
+ *           receives the descriptor, or -1 if the target is left to be
+ *           opened later.
+ * @return 0 on success, -1 if the target cannot be opened (errno is set).
+ */
+int	open_redirect_target(t_fd_op *op)
+{
+	struct stat	st;
+
+	op->src = open(op->name, op->flags | O_NONBLOCK, 0644);
+	if (op->src == -1 && (errno == ENXIO || errno == EWOULDBLOCK))
+		return (0);
+	if (op->src == -1)
+		return (-1);
+	if (fstat(op->src, &st) == -1)
+		st.st_mode = 0;
+	if (S_ISREG(st.st_mode))
+		return (0);
+	if (S_ISFIFO(st.st_mode) && (op->flags & O_ACCMODE) == O_RDONLY)
+		op->flags |= O_NONBLOCK;
+	else
+		fcntl(op->src, F_SETFL, op->flags);
+	return (0);
+}
+
+/**
+ * @brief Gives the descriptor an FD_OPEN step moves into place.
+ *
+ * A target open_redirect_target() left unopened is opened now, by name.
+ * A FIFO it kept for reading is first waited on until a writer has come,
+ * as a blocking open() would have: until then poll() does not report it,
+ * so reading it does not stop at an end of file that never was. Ctrl-C
+ * in the shell gives up the wait.
+ *
+ * @param op The FD_OPEN step.
+ * @return The descriptor, or -1 on error with errno set.
+ */
+int	ready_redirect_target(t_fd_op *op)
+{
+	struct pollfd	pfd;
+
+	if (op->src < 0)
+		return (open(op->name, op->flags, 0644));
+	if (!(op->flags & O_NONBLOCK))
+		return (op->src);
+	pfd.fd = op->src;
+	pfd.events = POLLIN;
+	while (poll(&pfd, 1, -1) == -1)
+	{
+		if (errno != EINTR || g_signal_received == SIGINT)
+			return (-1);
+	}
+	if (fcntl(op->src, F_SETFL, op->flags & ~O_NONBLOCK) == -1)
+		return (-1);
+	return (op->src);
+}
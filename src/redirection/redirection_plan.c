@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirection_plan.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 10:02:41 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/25 19:26:13 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Appends a step to a redirection list.
+ *
+ * @param ops The list.
+ * @param type The kind of step.
+ * @param fd The descriptor the step redirects.
+ * @param name The word written after the operator; copied.
+ * @return The new step, with no descriptor opened yet.
+ */
+t_fd_op	*add_fd_op(t_fd_op **ops, t_fd_op_type type, int fd, char *name)
+{
+	t_fd_op	*op;
+
+	op = malloc(sizeof(t_fd_op));
+	if (op == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	ft_bzero(op, sizeof(t_fd_op));
+	op->type = type;
+	op->fd = fd;
+	op->src = -1;
+	op->saved = FD_UNSAVED;
+	op->name = ft_strdup(name);
+	if (op->name == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	while (*ops != NULL)
+		ops = &(*ops)->next;
+	*ops = op;
+	return (op);
+}
+
+/**
+ * @brief Closes the targets a redirection list holds open.
+ *
+ * Called by the parent once the child the list belongs to is forked, and
+ * when the list is freed.
+ *
+ * @param ops The list.
+ */
+void	close_redirect_plan(t_fd_op *ops)
+{
+	while (ops != NULL)
+	{
+		if (ops->type == FD_OPEN && ops->src >= 0)
+			close(ops->src);
+		if (ops->type == FD_OPEN)
+			ops->src = -1;
+		ops = ops->next;
+	}
+}
+
+/**
+ * @brief Closes and frees a redirection list.
+ *
+ * @param ops The list; set to NULL.
+ */
+void	free_fd_ops(t_fd_op **ops)
+{
+	t_fd_op	*next;
+
+	close_redirect_plan(*ops);
+	while (*ops != NULL)
+	{
+		next = (*ops)->next;
+		free((*ops)->name);
+		free(*ops);
+		*ops = next;
+	}
+}
+
+/**
+ * @brief Tells whether a redirection list redirects descriptor `fd`.
+ *
+ * @param ops The list.
+ * @param fd The descriptor.
+ * @return 1 if a step of the list changes `fd`, 0 otherwise.
+ */
+int	fd_ops_redirect(t_fd_op *ops, int fd)
+{
+	while (ops != NULL)
+	{
+		if (ops->fd == fd)
+			return (1);
+		ops = ops->next;
+	}
+	return (0);
+}
@@ -6,121 +6,114 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 11:10:49 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/03 15:55:00 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /**
- * @brief Processes an output file for redirection.
+ * @brief Splits a redirection operator into its kind and descriptor.
  *
- * This function attempts to open the specified output file with the
- * appropriate flags based on whether appending is requested. If the
- * file cannot be opened or created, it prints an error message.
+ * The operators are `<`, `>`, `>>`, `<<`, `<>`, `<&`, `>&` and `<<<`, each
+ * optionally preceded by the number of the descriptor it redirects, as in
+ * `2>&`. Without a number, the operators starting with `<` redirect
+ * standard input and the others standard output.
  *
- * @param output_file The name of the output file to process.
- * @param is_append A flag indicating whether to append (1)
- *                  or truncate (0) the file.
- * @return 0 on success, -1 on failure.
+ * @param token The token to check.
+ * @param fd Receives the descriptor redirected (may be NULL).
+ * @return The kind of redirection, or REDIR_NONE if `token` is not a
+ *         redirection operator.
  */
-int	process_output_file(char *output_file, int is_append)
+t_redir_kind	redirect_kind(const char *token, int *fd)
 {
-	int	fd_out;
+	static const char	*ops[] = {"<", ">", ">>", "<<", "<>", "<&", ">&",
+		"<<<"};
+	int					n;
+	int					k;
 
-	if (is_append)
-		fd_out = open(output_file, O_WRONLY | O_CREAT | O_APPEND, 0644);
-	else
-		fd_out = open(output_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
-	if (fd_out < 0)
-	{
-		ft_error(output_file, strerror(errno));
-		return (-1);
-	}
-	close(fd_out);
-	return (0);
+	if (token == NULL)
+		return (REDIR_NONE);
+	n = 0;
+	while (ft_isdigit(token[n]))
+		n++;
+	k = 0;
+	while (k < 8 && ft_strncmp(token + n, ops[k], 4) != 0)
+		k++;
+	if (k == 8)
+		return (REDIR_NONE);
+	if (fd != NULL && n == 0)
+		*fd = (token[0] == '>');
+	else if (fd != NULL && n > 9)
+		*fd = -1;
+	else if (fd != NULL)
+		*fd = ft_atoi(token);
+	return ((t_redir_kind)(k + 1));
 }
 
 /**
- * @brief Opens an input file and redirects standard input to it.
- *
- * This function opens the specified input file for reading and
- * redirects the standard input (stdin) to read from this file.
- * If the file cannot be opened, it prints an error message and
- * exits the process.
+ * @brief Checks if a token is a redirection operator.
  *
- * @param input_file The name of the input file to open.
+ * @param token The string to check.
+ * @return 1 if the string is a redirection operator, 0 otherwise.
  */
-void	open_and_redirect_input(char *input_file)
+int	is_redirection(const char *token)
 {
-	int	fd_in;
-
-	fd_in = open(input_file, O_RDONLY);
-	if (fd_in == -1)
-	{
-		ft_error_and_exit(input_file, strerror(errno), EXIT_FAILURE);
-	}
-	if (dup2(fd_in, STDIN_FILENO) == -1)
-	{
-		ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
-	}
-	close(fd_in);
+	return (redirect_kind(token, NULL) != REDIR_NONE);
 }
 
 /**
- * @brief Opens an output file and redirects standard output to it.
- *
- * This function opens the specified output file for writing, either
- * in append mode or truncation mode based on the `output_mode` parameter.
- * It then redirects the standard output (stdout) to write to this file.
- * If the file cannot be opened, it prints an error message and exits
- * the process.
+ * @brief Checks if the word after `<&` or `>&` names a descriptor.
  *
- * @param output_file The name of the output file to open.
- * @param output_mode The mode for opening the file:
- *                    1 for truncation, 2 for append.
+ * @param word The word to check.
+ * @return 1 if it is a number of at most 9 digits, 0 otherwise.
  */
-void	open_and_redirect_output(char *output_file, int output_mode)
+int	is_fd_number(const char *word)
 {
-	int	fd_out;
-	int	flags;
+	int	n;
 
-	if (output_mode == 2)
-		flags = O_WRONLY | O_CREAT | O_APPEND;
-	else
-		flags = O_WRONLY | O_CREAT | O_TRUNC;
-	fd_out = open(output_file, flags, 0644);
-	if (fd_out == -1)
-	{
-		ft_error_and_exit(output_file, strerror(errno), EXIT_FAILURE);
-	}
-	if (dup2(fd_out, STDOUT_FILENO) == -1)
-	{
-		ft_error_and_exit("dup2", strerror(errno), EXIT_FAILURE);
-	}
-	close(fd_out);
+	n = 0;
+	while (ft_isdigit(word[n]))
+		n++;
+	return (n > 0 && n <= 9 && word[n] == '\0');
 }
 
 /**
- * @brief Checks if a token is a redirection operator.
+ * @brief Returns the open() flags for the target of a redirection.
  *
- * This function checks if the given string matches any of the
- * standard redirection operators: ">", "<", ">>", or "<<".
+ * @param kind REDIR_IN, REDIR_HEREDOC, REDIR_OUT, REDIR_APPEND or
+ *             REDIR_RDWR.
+ * @return The flags, with O_CLOEXEC.
+ */
+int	redirect_open_flags(t_redir_kind kind)
+{
+	if (kind == REDIR_OUT)
+		return (O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC);
+	if (kind == REDIR_APPEND)
+		return (O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC);
+	if (kind == REDIR_RDWR)
+		return (O_RDWR | O_CREAT | O_CLOEXEC);
+	return (O_RDONLY | O_CLOEXEC);
+}
+
+/**
+ * @brief Moves a descriptor the shell keeps open for itself (the history
+ * file, the trace, the session log) to REDIR_FD_BASE or above, where the
+ * descriptors a script names (`exec 3>file`) do not reach, as bash does.
  *
- * @param token The string to check.
- * @return 1 if the string is a redirection operator, 0 otherwise.
+ * @param fd The descriptor, or -1.
+ * @return The descriptor it now has, close-on-exec; `fd` itself if it is
+ *         -1 or cannot be moved.
  */
-int	is_redirection(const char *token)
+int	move_to_high_fd(int fd)
 {
-	if (!token)
-		return (0);
-	if (ft_strncmp(token, "<", 2) == 0)
-		return (1);
-	if (ft_strncmp(token, ">", 2) == 0)
-		return (1);
-	if (ft_strncmp(token, ">>", 3) == 0)
-		return (1);
-	if (ft_strncmp(token, "<<", 3) == 0)
-		return (1);
-	return (0);
+	int	high;
+
+	if (fd < 0 || fd >= REDIR_FD_BASE)
+		return (fd);
+	high = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+	if (high == -1)
+		return (fd);
+	close(fd);
+	return (high);
 }
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/21 12:41:05 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/04 10:02:07 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -72,21 +72,22 @@ void	reset_child_signal_handlers(void)
 /**
  * @brief Waits for a specific child process to finish.
  *
- * This function wraps waitpid to wait for the given pid. It handles
+ * This function wraps wait4 to wait for the given pid. It handles
  * interruptions by signals (EINTR) by retrying the wait.
  *
  * @param pid The process ID of the child to wait for.
  * @param status Pointer to an integer where the exit status will be stored.
+ * @param ru Receives the resource usage of the child.
  * @return The PID of the terminated child, or -1 on error.
 */
-static int	wait_for_child(pid_t pid, int *status)
+static int	wait_for_child(pid_t pid, int *status, struct rusage *ru)
 {
 	pid_t	wpid;
 
-	wpid = waitpid(pid, status, 0);
+	wpid = wait4(pid, status, 0, ru);
 	while (wpid == -1 && errno == EINTR)
 	{
-		wpid = waitpid(pid, status, 0);
+		wpid = wait4(pid, status, 0, ru);
 	}
 	return (wpid);
 }
@@ -101,7 +102,7 @@ static int	wait_for_child(pid_t pid, int *status)
  * @param status The status value returned by waitpid.
  * @return The exit code of the child process.
 */
-static int	get_exit_status(int status)
+int	get_exit_status(int status)
 {
 	if (WIFEXITED(status))
 		return (WEXITSTATUS(status));
@@ -118,14 +119,15 @@ static int	get_exit_status(int status)
  * exit status of the child process.
  *
  * @param pid The process ID of the child to wait for.
+ * @param ru Receives the resource usage of the child, for `time`.
  * @return The exit status of the child process.
  */
-int	wait_for_child_and_handle_status(pid_t pid)
+int	wait_for_child_and_handle_status(pid_t pid, struct rusage *ru)
 {
 	int		status;
 	pid_t	wpid;
 
-	wpid = wait_for_child(pid, &status);
+	wpid = wait_for_child(pid, &status, ru);
 	if (wpid != -1 && WIFSIGNALED(status))
 		print_signal_message(status);
 	else if (wpid == -1)
@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/24 11:51:29 by tiyang            #+#    #+#             */
-/*   Updated: 2025/09/04 10:02:51 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/26 15:32:08 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -28,6 +28,18 @@ void	handle_parent_sigint(int signum)
 	rl_redisplay();
 }
 
+/**
+ * @brief Signal handler for SIGINT while a pipeline stage runs inside the
+ * shell: it only sets the global flag, so the stage's blocking call is
+ * interrupted and the stage can end with the status of SIGINT.
+ * @param signum The signal number (unused).
+ */
+void	handle_stage_sigint(int signum)
+{
+	(void)signum;
+	g_signal_received = SIGINT;
+}
+
 /**
  * @brief Prints a message based on how a child process was
  *        terminated by a signal.
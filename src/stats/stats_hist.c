@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_hist.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the histogram bucket of a latency.
+ *
+ * @param us The latency in microseconds.
+ * @return The bucket index, below STATS_HIST_SIZE.
+ */
+static int	hist_index(unsigned long long us)
+{
+	int	msb;
+	int	index;
+
+	if (us < STATS_SUB)
+		return ((int)us);
+	msb = STATS_SUB_BITS;
+	while ((us >> (msb + 1)) != 0)
+		msb++;
+	index = STATS_SUB + (msb - STATS_SUB_BITS) * STATS_SUB
+		+ (int)((us >> (msb - STATS_SUB_BITS)) - STATS_SUB);
+	if (index >= STATS_HIST_SIZE)
+		return (STATS_HIST_SIZE - 1);
+	return (index);
+}
+
+/**
+ * @brief Returns the value a histogram bucket stands for: the middle of
+ * the range of latencies it counts.
+ *
+ * @param index The bucket index.
+ * @return The latency in microseconds.
+ */
+static unsigned long long	hist_value(int index)
+{
+	int					shift;
+	unsigned long long	low;
+
+	if (index < STATS_SUB)
+		return ((unsigned long long)index);
+	shift = (index - STATS_SUB) / STATS_SUB;
+	low = (unsigned long long)(STATS_SUB + (index - STATS_SUB) % STATS_SUB)
+		<< shift;
+	return (low + ((1ULL << shift) >> 1));
+}
+
+/**
+ * @brief Counts a latency in the histogram of an entry.
+ *
+ * @param entry The entry of the command.
+ * @param us The latency in microseconds.
+ */
+void	stats_hist_add(t_cmd_stats *entry, unsigned long long us)
+{
+	entry->hist[hist_index(us)]++;
+}
+
+/**
+ * @brief Returns a percentile of the latencies of an entry.
+ *
+ * @param entry The entry of the command.
+ * @param permille The percentile in thousandths, e.g. 990 for p99.
+ * @return The latency in microseconds, never above the largest one seen.
+ */
+unsigned long long	stats_percentile(t_cmd_stats *entry, int permille)
+{
+	unsigned long long	target;
+	unsigned long long	seen;
+	int					i;
+
+	if (entry->calls == 0)
+		return (0);
+	target = (entry->calls * (unsigned long long)permille + 999) / 1000;
+	if (target == 0)
+		target = 1;
+	seen = 0;
+	i = 0;
+	while (i < STATS_HIST_SIZE - 1)
+	{
+		seen += entry->hist[i];
+		if (seen >= target)
+			break ;
+		i++;
+	}
+	if (hist_value(i) > entry->max_us)
+		return (entry->max_us);
+	return (hist_value(i));
+}
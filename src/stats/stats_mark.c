@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_mark.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Notes the time and fork count at the start of a command.
+ *
+ * @param pd The process data holding the statistics.
+ * @param mark Receives the state to pass to stats_end().
+ */
+void	stats_begin(t_process_data *pd, t_stats_mark *mark)
+{
+	mark->start_us = timing_clock_us();
+	mark->forks = 0;
+	if (pd->stats != NULL)
+		mark->forks = pd->stats->forks;
+}
+
+/**
+ * @brief Counts forks, so the command running them is charged for them.
+ *
+ * @param stats The statistics, or NULL when they are not kept.
+ * @param count The number of processes about to be forked.
+ */
+void	stats_fork(t_stats *stats, int count)
+{
+	if (stats != NULL)
+		stats->forks += count;
+}
+
+/**
+ * @brief Records a finished command in the statistics table.
+ *
+ * @param pd The process data holding the statistics.
+ * @param mark The state taken by stats_begin().
+ * @param name The command name.
+ * @param status The exit status of the command.
+ */
+void	stats_end(t_process_data *pd, t_stats_mark *mark, const char *name,
+		int status)
+{
+	if (pd->stats != NULL && name != NULL)
+		stats_record(pd->stats, name, mark, status);
+}
+
+/**
+ * @brief Records a finished pipeline under the names of its stages, e.g.
+ * `ls | wc`. Compound stages are shown as `{...}`.
+ *
+ * @param pd The process data holding the statistics and the stages.
+ * @param mark The state taken by stats_begin().
+ * @param status The exit status of the pipeline.
+ */
+void	stats_end_pipeline(t_process_data *pd, t_stats_mark *mark,
+		int status)
+{
+	char	name[STATS_NAME_MAX];
+	char	**args;
+	int		i;
+
+	if (pd->stats == NULL)
+		return ;
+	name[0] = '\0';
+	i = 0;
+	while (i < pd->cmd_count)
+	{
+		if (i > 0)
+			ft_strlcat(name, " | ", STATS_NAME_MAX);
+		args = pd->cmds[i]->args;
+		if (args != NULL && args[0] != NULL)
+			ft_strlcat(name, args[0], STATS_NAME_MAX);
+		else
+			ft_strlcat(name, "{...}", STATS_NAME_MAX);
+		i++;
+	}
+	stats_record(pd->stats, name, mark, status);
+}
+
+/**
+ * @brief Frees the statistics table.
+ *
+ * In the shell that read MINISHELL_STATS (not in its forked children),
+ * the table is first written to that file in Prometheus text format.
+ *
+ * @param pd The process data holding the statistics.
+ */
+void	free_stats(t_process_data *pd)
+{
+	int	fd;
+
+	if (pd->stats == NULL)
+		return ;
+	if (pd->stats->dump_path != NULL && pd->stats->owner == getpid())
+	{
+		fd = open(pd->stats->dump_path, O_WRONLY | O_CREAT | O_TRUNC
+				| O_CLOEXEC, 0644);
+		if (fd == -1)
+			ft_error_with_arg(STATS_ENV, pd->stats->dump_path,
+				strerror(errno));
+		else
+		{
+			write_stats_prometheus(pd->stats, fd);
+			close(fd);
+		}
+	}
+	stats_reset(pd->stats);
+	free(pd->stats->dump_path);
+	free(pd->stats);
+	pd->stats = NULL;
+}
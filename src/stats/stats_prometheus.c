@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_prometheus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Copies a command name into a Prometheus label value, escaping
+ * backslashes, double quotes and newlines.
+ *
+ * @param name The command name.
+ * @param out Receives the escaped value; twice STATS_NAME_MAX bytes.
+ */
+static void	escape_label(const char *name, char *out)
+{
+	while (*name != '\0')
+	{
+		if (*name == '\\' || *name == '"' || *name == '\n')
+			*out++ = '\\';
+		if (*name == '\n')
+			*out++ = 'n';
+		else
+			*out++ = *name;
+		name++;
+	}
+	*out = '\0';
+}
+
+/**
+ * @brief Writes the summary samples of one command: p50, p90, p99, sum and
+ * count of its latencies, in seconds.
+ *
+ * @param fd The descriptor to write to.
+ * @param label The escaped command name.
+ * @param e The entry of the command.
+ */
+static void	write_summary(int fd, const char *label, t_cmd_stats *e)
+{
+	static const int	permille[] = {500, 900, 990};
+	char				line[STATS_LINE_MAX * 2];
+	int					i;
+
+	i = 0;
+	while (i < 3)
+	{
+		snprintf(line, sizeof(line), "minishell_command_duration_seconds"
+			"{command=\"%s\",quantile=\"0.%d\"} %.6f\n", label,
+			permille[i] / 10, stats_percentile(e, permille[i]) / 1e6);
+		ft_putstr_fd(line, fd);
+		i++;
+	}
+	snprintf(line, sizeof(line), "minishell_command_duration_seconds_sum"
+		"{command=\"%s\"} %.6f\nminishell_command_duration_seconds_count"
+		"{command=\"%s\"} %lu\n", label, e->total_us / 1e6, label, e->calls);
+	ft_putstr_fd(line, fd);
+}
+
+/**
+ * @brief Writes the samples of one metric family for one command.
+ *
+ * @param fd The descriptor to write to.
+ * @param family 0 for calls, 1 for forks, 2 for failures, 3 for latency.
+ * @param e The entry of the command.
+ */
+static void	write_sample(int fd, int family, t_cmd_stats *e)
+{
+	static const char	*names[] = {"calls", "forks", "failures"};
+	char				label[STATS_NAME_MAX * 2];
+	char				line[STATS_LINE_MAX * 2];
+	unsigned long		value;
+
+	escape_label(e->name, label);
+	if (family == 3)
+	{
+		write_summary(fd, label, e);
+		return ;
+	}
+	value = e->calls;
+	if (family == 1)
+		value = e->forks;
+	else if (family == 2)
+		value = e->failures;
+	snprintf(line, sizeof(line), "minishell_command_%s_total"
+		"{command=\"%s\"} %lu\n", names[family], label, value);
+	ft_putstr_fd(line, fd);
+}
+
+/**
+ * @brief Writes the HELP and TYPE lines of a metric family.
+ *
+ * @param fd The descriptor to write to.
+ * @param family 0 for calls, 1 for forks, 2 for failures, 3 for latency.
+ */
+static void	write_family_header(int fd, int family)
+{
+	static const char	*headers[] = {
+		"# HELP minishell_command_calls_total Commands run.\n"
+		"# TYPE minishell_command_calls_total counter\n",
+		"# HELP minishell_command_forks_total Processes forked to run"
+		" commands.\n# TYPE minishell_command_forks_total counter\n",
+		"# HELP minishell_command_failures_total Commands that exited"
+		" non-zero.\n# TYPE minishell_command_failures_total counter\n",
+		"# HELP minishell_command_duration_seconds Command latency.\n"
+		"# TYPE minishell_command_duration_seconds summary\n"};
+
+	ft_putstr_fd((char *)headers[family], fd);
+}
+
+/**
+ * @brief Writes the statistics table in Prometheus text format.
+ *
+ * Used for the MINISHELL_STATS dump on exit and for `stats -p`.
+ *
+ * @param stats The statistics table.
+ * @param fd The descriptor to write to.
+ */
+void	write_stats_prometheus(t_stats *stats, int fd)
+{
+	t_cmd_stats	*entry;
+	int			family;
+	int			i;
+
+	family = 0;
+	while (family < 4)
+	{
+		write_family_header(fd, family);
+		i = 0;
+		while (i < STATS_BUCKETS)
+		{
+			entry = stats->table[i];
+			while (entry != NULL)
+			{
+				write_sample(fd, family, entry);
+				entry = entry->next;
+			}
+			i++;
+		}
+		family++;
+	}
+}
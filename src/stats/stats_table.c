@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_table.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Creates the statistics table of the shell.
+ *
+ * The table is always kept; MINISHELL_STATS only adds the dump on exit.
+ *
+ * @param pd The process data receiving the table.
+ */
+void	stats_init(t_process_data *pd)
+{
+	t_env_var	*var;
+
+	pd->stats = ft_calloc(1, sizeof(t_stats));
+	if (pd->stats == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	pd->stats->owner = getpid();
+	var = find_env_var(STATS_ENV, pd->env_list);
+	if (var == NULL || var->value == NULL || var->value[0] == '\0')
+		return ;
+	pd->stats->dump_path = ft_strdup(var->value);
+	if (pd->stats->dump_path == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+}
+
+/**
+ * @brief Hashes a command name (djb2, as for the function table).
+ *
+ * @param name The command name.
+ * @return The bucket index, below STATS_BUCKETS.
+ */
+static unsigned int	stats_hash(const char *name)
+{
+	unsigned int	hash;
+	size_t			i;
+
+	hash = 5381;
+	i = 0;
+	while (name[i] != '\0' && i < STATS_NAME_MAX - 1)
+	{
+		hash = hash * 33 + (unsigned char)name[i];
+		i++;
+	}
+	return (hash % STATS_BUCKETS);
+}
+
+/**
+ * @brief Finds the entry of a command name, adding it if it is new.
+ *
+ * Names are truncated to STATS_NAME_MAX - 1 bytes.
+ *
+ * @param stats The statistics table.
+ * @param name The command name.
+ * @return The entry.
+ */
+static t_cmd_stats	*find_stats_entry(t_stats *stats, const char *name)
+{
+	t_cmd_stats		*entry;
+	unsigned int	bucket;
+
+	bucket = stats_hash(name);
+	entry = stats->table[bucket];
+	while (entry != NULL
+		&& ft_strncmp(entry->name, name, STATS_NAME_MAX - 1) != 0)
+		entry = entry->next;
+	if (entry != NULL)
+		return (entry);
+	entry = ft_calloc(1, sizeof(t_cmd_stats));
+	if (entry == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	ft_strlcpy(entry->name, name, STATS_NAME_MAX);
+	entry->next = stats->table[bucket];
+	stats->table[bucket] = entry;
+	stats->count++;
+	return (entry);
+}
+
+/**
+ * @brief Adds one run of a command to its entry.
+ *
+ * @param stats The statistics table.
+ * @param name The command name.
+ * @param mark The state taken by stats_begin() when the command started.
+ * @param status The exit status of the command.
+ */
+void	stats_record(t_stats *stats, const char *name, t_stats_mark *mark,
+		int status)
+{
+	t_cmd_stats			*entry;
+	unsigned long long	us;
+	long long			elapsed;
+
+	elapsed = timing_clock_us() - mark->start_us;
+	us = 0;
+	if (elapsed > 0)
+		us = elapsed;
+	entry = find_stats_entry(stats, name);
+	entry->calls++;
+	entry->forks += stats->forks - mark->forks;
+	if (status != 0)
+		entry->failures++;
+	entry->total_us += us;
+	if (us > entry->max_us)
+		entry->max_us = us;
+	stats_hist_add(entry, us);
+}
+
+/**
+ * @brief Empties the statistics table (`stats -r`).
+ *
+ * @param stats The statistics table.
+ */
+void	stats_reset(t_stats *stats)
+{
+	t_cmd_stats	*next;
+	int			i;
+
+	i = 0;
+	while (i < STATS_BUCKETS)
+	{
+		while (stats->table[i] != NULL)
+		{
+			next = stats->table[i]->next;
+			free(stats->table[i]);
+			stats->table[i] = next;
+		}
+		i++;
+	}
+	stats->count = 0;
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:03:48 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Starts measuring a node run under the `time` keyword.
+ *
+ * @param node The timed node (node->timed holds the report mode).
+ * @param pd The process data; pd->timing is pointed at the measurement.
+ * @return The measurement, to hand to finish_timing().
+ */
+t_timing	*start_timing(t_ast_node *node, t_process_data *pd)
+{
+	t_timing	*timing;
+
+	timing = ft_calloc(1, sizeof(t_timing));
+	if (timing == NULL)
+		ft_error_and_exit("malloc", strerror(errno), EXIT_FAILURE);
+	timing->mode = node->timed;
+	timing->is_pipeline = (node->type == NODE_PIPELINE);
+	timing->prev = pd->timing;
+	pd->timing = timing;
+	getrusage(RUSAGE_SELF, &timing->self_start);
+	timing->start_us = timing_clock_us();
+	return (timing);
+}
+
+/**
+ * @brief Accounts for a child reaped with wait4() during a `time`.
+ *
+ * @param timing The innermost running measurement.
+ * @param args The command the child ran (NULL for a compound command).
+ * @param status The exit status of the child.
+ * @param ru The resource usage wait4() returned for it.
+ */
+void	record_child_usage(t_timing *timing, char **args, int status,
+		struct rusage *ru)
+{
+	t_usage			usage;
+	t_stage_usage	*stage;
+
+	usage_from_rusage(&usage, ru);
+	add_usage(&timing->children, &usage);
+	if (timing->stage_count >= TIME_STAGES_MAX)
+		return ;
+	stage = &timing->stages[timing->stage_count++];
+	if (args != NULL && args[0] != NULL)
+		ft_strlcpy(stage->name, args[0], TIME_NAME_MAX);
+	else
+		ft_strlcpy(stage->name, "(compound)", TIME_NAME_MAX);
+	stage->status = status;
+	stage->usage = usage;
+}
+
+/**
+ * @brief Stops a measurement, reports it and pops it off pd->timing.
+ *
+ * The total is the children's usage plus the shell's own. Max RSS is the
+ * peak among the children, or the shell's peak when no child was run.
+ *
+ * @param timing The measurement returned by start_timing().
+ * @param pd The process data.
+ */
+void	finish_timing(t_timing *timing, t_process_data *pd)
+{
+	t_usage	self;
+	long	children_rss;
+
+	timing->real_us = timing_clock_us() - timing->start_us;
+	usage_since(&self, &timing->self_start);
+	children_rss = timing->children.max_rss;
+	timing->total = timing->children;
+	add_usage(&timing->total, &self);
+	if (children_rss > 0)
+		timing->total.max_rss = children_rss;
+	pd->timing = timing->prev;
+	if (timing->prev != NULL)
+		add_usage(&timing->prev->children, &timing->children);
+	report_timing(timing, pd);
+	free(timing);
+}
+
+/**
+ * @brief Frees the measurements still running, e.g. on `exit` inside a
+ * `time`d command.
+ *
+ * @param pd The process data.
+ */
+void	free_timing(t_process_data *pd)
+{
+	t_timing	*prev;
+
+	while (pd->timing != NULL)
+	{
+		prev = pd->timing->prev;
+		free(pd->timing);
+		pd->timing = prev;
+	}
+}
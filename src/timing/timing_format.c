@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_format.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:03:48 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Appends text to a `time` report, dropping what does not fit.
+ *
+ * @param out The report being built.
+ * @param str The text to append.
+ * @param len The length of `str`.
+ */
+void	time_append(t_time_out *out, const char *str, size_t len)
+{
+	if (len > TIME_OUT_MAX - out->len)
+		len = TIME_OUT_MAX - out->len;
+	ft_memcpy(out->data + out->len, str, len);
+	out->len += len;
+}
+
+/**
+ * @brief Appends a value given in millionths with `precision` decimals.
+ *
+ * Digits past the precision are truncated, not rounded, as bash does.
+ *
+ * @param out The report being built.
+ * @param value The value in millionths (microseconds for a time).
+ * @param precision The number of decimals, 0 to 3.
+ */
+static void	append_fixed(t_time_out *out, long long value, int precision)
+{
+	char		buf[48];
+	long long	frac;
+	int			scale;
+	int			len;
+
+	frac = value % 1000000;
+	scale = 6;
+	while (scale-- > precision)
+		frac /= 10;
+	if (precision == 0)
+		len = snprintf(buf, sizeof(buf), "%lld", value / 1000000);
+	else
+		len = snprintf(buf, sizeof(buf), "%lld.%0*lld", value / 1000000,
+				precision, frac);
+	time_append(out, buf, len);
+}
+
+/**
+ * @brief Appends a time, in seconds or in the long `MmS.FFFs` form.
+ *
+ * @param out The report being built.
+ * @param us The time in microseconds.
+ * @param precision The number of decimals, 0 to 3.
+ * @param is_long Whether the `l` modifier was given.
+ */
+static void	append_time(t_time_out *out, long long us, int precision,
+		int is_long)
+{
+	char	buf[32];
+	int		len;
+
+	if (us < 0)
+		us = 0;
+	if (!is_long)
+	{
+		append_fixed(out, us, precision);
+		return ;
+	}
+	len = snprintf(buf, sizeof(buf), "%lldm", us / 60000000);
+	time_append(out, buf, len);
+	append_fixed(out, us % 60000000, precision);
+	time_append(out, "s", 1);
+}
+
+/**
+ * @brief Expands one `%` directive of TIMEFORMAT.
+ *
+ * Supports bash's `%[p][l]R`, `%[p][l]U`, `%[p][l]S`, `%P` and `%%`,
+ * plus `%M` (max RSS in kB), `%C` (context switches) and `%F` (page
+ * faults). Anything else is copied as is.
+ *
+ * @param out The report being built.
+ * @param fmt The text after the `%`.
+ * @param t The measurement.
+ * @return The number of characters of `fmt` consumed.
+ */
+static int	format_directive(t_time_out *out, const char *fmt, t_timing *t)
+{
+	char	buf[32];
+	int		i;
+	int		precision;
+	int		is_long;
+
+	i = 0;
+	precision = 3;
+	if (ft_isdigit(fmt[i]) && fmt[i] - '0' < precision)
+		precision = fmt[i] - '0';
+	i += (ft_isdigit(fmt[i]) != 0);
+	is_long = (fmt[i] == 'l');
+	i += is_long;
+	if (fmt[i] != '\0' && ft_strchr("RUS", fmt[i]))
+		append_time(out, timing_field(t, fmt[i]), precision, is_long);
+	else if (fmt[i] == 'P')
+		append_fixed(out, timing_field(t, 'P'), 2);
+	else if (fmt[i] != '\0' && ft_strchr("MCF", fmt[i]))
+		time_append(out, buf, snprintf(buf, sizeof(buf), "%lld",
+				timing_field(t, fmt[i])));
+	else if (fmt[i] == '%')
+		time_append(out, "%", 1);
+	else
+		return (time_append(out, fmt - 1, i + 1), i);
+	return (i + 1);
+}
+
+/**
+ * @brief Formats a measurement the way bash formats TIMEFORMAT, followed
+ * by a newline.
+ *
+ * @param out The report being built.
+ * @param fmt The format string.
+ * @param t The measurement.
+ */
+void	format_timing(t_time_out *out, const char *fmt, t_timing *t)
+{
+	size_t	len;
+
+	while (*fmt != '\0')
+	{
+		len = 0;
+		while (fmt[len] != '\0' && fmt[len] != '%')
+			len++;
+		time_append(out, fmt, len);
+		fmt += len;
+		if (*fmt == '%')
+			fmt += 1 + format_directive(out, fmt + 1, t);
+	}
+	time_append(out, "\n", 1);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:03:48 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/22 09:14:36 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the value of a TIMEFORMAT field of a measurement.
+ *
+ * @param t The measurement.
+ * @param c The field: R, U or S (microseconds), P (CPU percentage in
+ *          millionths), M (kB), C or F (counts).
+ * @return The value of the field.
+ */
+long long	timing_field(t_timing *t, char c)
+{
+	if (c == 'R')
+		return (t->real_us);
+	if (c == 'U')
+		return (t->total.user_us);
+	if (c == 'S')
+		return (t->total.sys_us);
+	if (c == 'P' && t->real_us > 0)
+		return ((t->total.user_us + t->total.sys_us) * 100000000LL
+			/ t->real_us);
+	if (c == 'M')
+		return (t->total.max_rss);
+	if (c == 'C')
+		return (t->total.ctx_switches);
+	if (c == 'F')
+		return (t->total.page_faults);
+	return (0);
+}
+
+/**
+ * @brief Appends the line of one pipeline stage to the default report.
+ *
+ * @param out The report being built.
+ * @param i The index of the stage.
+ * @param stage The usage of the stage.
+ */
+static void	append_stage(t_time_out *out, int i, t_stage_usage *stage)
+{
+	char	buf[256];
+	int		len;
+
+	len = snprintf(buf, sizeof(buf), "[%d]\t%-12s user %lld.%03llds  "
+			"sys %lld.%03llds  rss %ldkB  ctxsw %ld  faults %ld  "
+			"status %d\n", i + 1, stage->name,
+			stage->usage.user_us / 1000000, stage->usage.user_us / 1000 % 1000,
+			stage->usage.sys_us / 1000000, stage->usage.sys_us / 1000 % 1000,
+			stage->usage.max_rss, stage->usage.ctx_switches,
+			stage->usage.page_faults, stage->status);
+	if (len > 0)
+		time_append(out, buf, ft_strlen(buf));
+}
+
+/**
+ * @brief Prints the report of a `time`d pipeline on standard error.
+ *
+ * `time -p` uses the POSIX format. Otherwise TIMEFORMAT is used if it is
+ * set (an empty value prints nothing), else a bash-like default extended
+ * with max RSS, context switches and page faults and, for a pipeline,
+ * followed by one line per stage.
+ *
+ * @param timing The finished measurement.
+ * @param pd The process data holding TIMEFORMAT.
+ */
+void	report_timing(t_timing *timing, t_process_data *pd)
+{
+	t_time_out	out;
+	t_env_var	*var;
+	int			i;
+
+	out.len = 0;
+	var = find_shell_var("TIMEFORMAT", pd);
+	if (timing->mode == TIME_POSIX)
+		format_timing(&out, TIME_FORMAT_POSIX, timing);
+	else if (var != NULL && var->value != NULL)
+	{
+		if (var->value[0] == '\0')
+			return ;
+		format_timing(&out, var->value, timing);
+	}
+	else
+	{
+		format_timing(&out, TIME_FORMAT_DEFAULT, timing);
+		i = 0;
+		while (timing->is_pipeline && i < timing->stage_count)
+		{
+			append_stage(&out, i, &timing->stages[i]);
+			i++;
+		}
+	}
+	write(STDERR_FILENO, out.data, out.len);
+}
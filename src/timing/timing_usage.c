@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_usage.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:03:48 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/17 11:03:48 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <time.h>
+
+/**
+ * @brief Returns a monotonic clock reading, for the real time of `time`.
+ *
+ * @return The time in microseconds since an arbitrary starting point.
+ */
+long long	timing_clock_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief Converts a struct rusage filled by wait4() or getrusage().
+ *
+ * @param usage Receives the usage.
+ * @param ru The usage to convert.
+ */
+void	usage_from_rusage(t_usage *usage, struct rusage *ru)
+{
+	usage->user_us = (long long)ru->ru_utime.tv_sec * 1000000LL
+		+ ru->ru_utime.tv_usec;
+	usage->sys_us = (long long)ru->ru_stime.tv_sec * 1000000LL
+		+ ru->ru_stime.tv_usec;
+	usage->max_rss = ru->ru_maxrss;
+	usage->ctx_switches = ru->ru_nvcsw + ru->ru_nivcsw;
+	usage->page_faults = ru->ru_minflt + ru->ru_majflt;
+}
+
+/**
+ * @brief Adds `src` to `dst`. Max RSS is a peak, so the larger one wins.
+ *
+ * @param dst The usage to add to.
+ * @param src The usage to add.
+ */
+void	add_usage(t_usage *dst, t_usage *src)
+{
+	dst->user_us += src->user_us;
+	dst->sys_us += src->sys_us;
+	dst->ctx_switches += src->ctx_switches;
+	dst->page_faults += src->page_faults;
+	if (src->max_rss > dst->max_rss)
+		dst->max_rss = src->max_rss;
+}
+
+/**
+ * @brief Measures what the shell process itself used since `start`.
+ *
+ * getrusage() only knows the peak RSS of the whole process, so max_rss
+ * is that peak rather than a difference.
+ *
+ * @param usage Receives the usage.
+ * @param start The getrusage(RUSAGE_SELF) reading taken at the start.
+ */
+void	usage_since(t_usage *usage, struct rusage *start)
+{
+	struct rusage	now;
+	t_usage			before;
+
+	getrusage(RUSAGE_SELF, &now);
+	usage_from_rusage(usage, &now);
+	usage_from_rusage(&before, start);
+	usage->user_us -= before.user_us;
+	usage->sys_us -= before.sys_us;
+	usage->ctx_switches -= before.ctx_switches;
+	usage->page_faults -= before.page_faults;
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 09:26:40 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/26 17:46:03 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <time.h>
+
+/**
+ * @brief Turns tracing on if MINISHELL_TRACE names a file.
+ *
+ * The file is truncated and the JSON array of events opened. Without the
+ * variable pd->trace stays NULL, and every phase costs a single branch.
+ *
+ * @param pd The process data, with the environment already loaded.
+ */
+void	trace_init(t_process_data *pd)
+{
+	t_env_var	*var;
+	t_trace		*trace;
+
+	var = find_env_var(TRACE_ENV, pd->env_list);
+	if (var == NULL || var->value == NULL || var->value[0] == '\0')
+		return ;
+	trace = malloc(sizeof(t_trace));
+	if (trace != NULL)
+		trace->fd = move_to_high_fd(open(var->value, O_WRONLY | O_CREAT
+					| O_TRUNC | O_APPEND | O_CLOEXEC, 0644));
+	if (trace == NULL || trace->fd == -1 || write(trace->fd, "[\n", 2) != 2)
+	{
+		ft_error_with_arg(TRACE_ENV, var->value, strerror(errno));
+		if (trace != NULL && trace->fd != -1)
+			close(trace->fd);
+		free(trace);
+		return ;
+	}
+	trace->pid = getpid();
+	trace->is_root = 1;
+	trace->count = 0;
+	pd->trace = trace;
+}
+
+/**
+ * @brief Starts a phase, ending the one before.
+ *
+ * A mark for the phase already running is dropped, so nested calls (an
+ * expansion inside a redirection, say) do not split it. The phase is
+ * also handed to the instrumentation counters, which is why this takes
+ * a NULL tracer; outside `make instrument` that call is compiled out, so
+ * a mark with tracing off costs only the NULL check.
+ *
+ * @param trace The tracer, or NULL when tracing is off.
+ * @param phase The phase starting now.
+ */
+void	trace_mark(t_trace *trace, t_trace_phase phase)
+{
+	struct timespec	ts;
+
+	if (INSTRUMENT)
+		instr_phase(phase);
+	if (trace == NULL)
+		return ;
+	if (trace->count > 0 && trace->marks[trace->count - 1].phase == phase)
+		return ;
+	if (trace->count == TRACE_EVENTS)
+		trace_flush(trace);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	trace->marks[trace->count].phase = phase;
+	trace->marks[trace->count].ns = (long long)ts.tv_sec * 1000000000LL
+		+ ts.tv_nsec;
+	trace->count++;
+}
+
+/**
+ * @brief Takes over the tracer in a freshly forked child.
+ *
+ * The marks inherited from the parent are the parent's to write out, so
+ * the child drops them and starts its own TRACE_EXEC phase. Like
+ * trace_mark(), it takes a NULL tracer.
+ *
+ * @param trace The tracer copied from the parent, or NULL.
+ */
+void	trace_child(t_trace *trace)
+{
+	if (trace == NULL)
+		return ;
+	trace->pid = getpid();
+	trace->is_root = 0;
+	trace->count = 0;
+	trace_mark(trace, TRACE_EXEC);
+}
+
+/**
+ * @brief Writes out the pending marks and turns tracing off.
+ *
+ * The shell that opened the file also closes the JSON array, with an
+ * instant event for its own exit.
+ *
+ * @param pd The process data holding the tracer.
+ */
+void	free_trace(t_process_data *pd)
+{
+	t_trace	*trace;
+	char	line[TRACE_LINE_MAX];
+	int		len;
+
+	trace = pd->trace;
+	if (trace == NULL)
+		return ;
+	trace_mark(trace, TRACE_IDLE);
+	trace_flush(trace);
+	if (trace->is_root)
+	{
+		len = snprintf(line, sizeof(line), "{\"name\":\"exit\",\"ph\":\"i\","
+				"\"s\":\"p\",\"pid\":%d,\"tid\":%d,\"ts\":%lld}\n]\n",
+				trace->pid, trace->pid, trace->marks[0].ns / 1000);
+		if (write(trace->fd, line, len) != len)
+			ft_error(TRACE_ENV, strerror(errno));
+	}
+	close(trace->fd);
+	free(trace);
+	pd->trace = NULL;
+}
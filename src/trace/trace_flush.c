@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_flush.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 09:26:40 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:37 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/**
+ * @brief Returns the name of a phase, as used in trace events and by
+ * `shellstat`.
+ */
+const char	*trace_phase_name(t_trace_phase phase)
+{
+	static const char	*names[] = {"idle", "precheck", "parse", "expand",
+		"redirect", "path", "builtin", "fork", "exec", "wait"};
+
+	return (names[phase]);
+}
+
+/**
+ * @brief Formats the phase started by mark `i` as a Chrome "complete"
+ * event; it lasts until mark `i + 1`.
+ *
+ * @param trace The tracer.
+ * @param i The index of the mark.
+ * @param out Where to write the event, TRACE_LINE_MAX bytes.
+ * @return The length of the event text.
+ */
+static size_t	format_event(t_trace *trace, int i, char *out)
+{
+	long long	ts;
+	long long	dur;
+	int			len;
+
+	ts = trace->marks[i].ns;
+	dur = trace->marks[i + 1].ns - ts;
+	len = snprintf(out, TRACE_LINE_MAX, "{\"name\":\"%s\","
+			"\"cat\":\"minishell\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+			"\"ts\":%lld.%03lld,"
+			"\"dur\":%lld.%03lld},\n", trace_phase_name(trace->marks[i].phase),
+			trace->pid, trace->pid, ts / 1000, ts % 1000, dur / 1000,
+			dur % 1000);
+	if (len < 0)
+		return (0);
+	if (len >= TRACE_LINE_MAX)
+		return (TRACE_LINE_MAX - 1);
+	return ((size_t)len);
+}
+
+/**
+ * @brief Writes out every finished phase with a single write().
+ *
+ * The last mark starts a phase that is still running, so it is kept as
+ * the first mark of the emptied buffer.
+ *
+ * @param trace The tracer.
+ */
+void	trace_flush(t_trace *trace)
+{
+	size_t	len;
+	int		i;
+
+	len = 0;
+	i = 0;
+	while (i + 1 < trace->count)
+	{
+		if (trace->marks[i].phase != TRACE_IDLE)
+			len += format_event(trace, i, trace->out + len);
+		i++;
+	}
+	if (len > 0 && write(trace->fd, trace->out, len) != (ssize_t)len)
+		ft_error(TRACE_ENV, strerror(errno));
+	if (trace->count > 0)
+	{
+		trace->marks[0] = trace->marks[trace->count - 1];
+		trace->count = 1;
+	}
+}
+
+/**
+ * @brief Ends the TRACE_EXEC phase of a child about to call execve().
+ *
+ * The marks live in memory that execve() replaces, so they are written
+ * out first; the descriptor itself is closed by the exec.
+ *
+ * @param trace The tracer of the child, or NULL.
+ */
+void	trace_exec(t_trace *trace)
+{
+	if (trace == NULL)
+		return ;
+	trace_mark(trace, TRACE_IDLE);
+	trace_flush(trace);
+}
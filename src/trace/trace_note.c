@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_note.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 20:13:05 by makhudon          #+#    #+#             */
+/*   Updated: 2025/09/20 20:13:05 by makhudon         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include <time.h>
+
+/**
+ * @brief Copies `src` into `dst` as the body of a JSON string, cut short
+ * (between characters) if it does not fit.
+ *
+ * @param src The text to escape.
+ * @param dst The buffer to fill.
+ * @param size The size of the buffer.
+ */
+static void	json_escape(const char *src, char *dst, size_t size)
+{
+	size_t	len;
+
+	len = 0;
+	while (*src != '\0' && len + 7 < size)
+	{
+		if (*src == '"' || *src == '\\')
+			dst[len++] = '\\';
+		if ((unsigned char)*src < 0x20)
+			len += snprintf(dst + len, 7, "\\u%04x", (unsigned char)*src);
+		else
+			dst[len++] = *src;
+		src++;
+	}
+	dst[len] = '\0';
+}
+
+/**
+ * @brief Writes an instant event to the trace, for something that happened
+ * at one point in time rather than a phase (a pipeline rewrite, say).
+ *
+ * The event is written straight away, without going through the buffered
+ * marks; trace viewers order events by timestamp. Takes a NULL tracer.
+ *
+ * @param trace The tracer, or NULL when tracing is off.
+ * @param name The name of the event.
+ * @param detail Free text shown with the event.
+ */
+void	trace_note(t_trace *trace, const char *name, const char *detail)
+{
+	struct timespec	ts;
+	char			line[TRACE_LINE_MAX + TRACE_NOTE_MAX];
+	char			text[TRACE_NOTE_MAX];
+	int				len;
+
+	if (trace == NULL)
+		return ;
+	json_escape(detail, text, sizeof(text));
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	len = snprintf(line, sizeof(line), "{\"name\":\"%s\",\"cat\":\"minishell\","
+			"\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%lld,"
+			"\"args\":{\"detail\":\"%s\"}},\n", name, trace->pid, trace->pid,
+			(long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000, text);
+	if (len < 0 || len >= (int) sizeof(line))
+		return ;
+	if (write(trace->fd, line, len) != len)
+		ft_error(TRACE_ENV, strerror(errno));
+}
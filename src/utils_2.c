@@ -6,7 +6,7 @@
 /*   By: makhudon <makhudon@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/04 10:15:36 by makhudon          #+#    #+#             */
-/*   Updated: 2025/09/09 12:48:06 by makhudon         ###   ########.fr       */
+/*   Updated: 2025/09/24 11:05:12 by makhudon         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -62,6 +62,37 @@ static void	add_first_or_append(t_env_var **head, const char *key,
 		add_env_var(ft_strdup(key), NULL, *head);
 }
 
+/**
+ * @brief Frees the per-shell state kept beside the environment: the
+ * shell-local and array variables, the cached execve() environment, the
+ * function table, the `source` cache, the `read` buffer, the `printf`
+ * format cache, the tracer, the `time` measurements, the command
+ * statistics, the session recorder, the persistent history and the
+ * command-name completion.
+ *
+ * Every path that ends a shell process (exit, shutdown, a forked child
+ * giving up) goes through here, so new state only needs adding once.
+ *
+ * @param process_data The process data holding the state.
+ */
+void	free_shell_state(t_process_data *process_data)
+{
+	free_functions(process_data);
+	free_source_cache(process_data);
+	free_read_buffer(process_data);
+	free_printf_cache(process_data);
+	free_trace(process_data);
+	free_timing(process_data);
+	free_stats(process_data);
+	free_record(process_data);
+	free_history(process_data);
+	free_completion(process_data);
+	free_env(process_data->shell_vars);
+	process_data->shell_vars = NULL;
+	free_arrays(process_data);
+	invalidate_envp(process_data);
+}
+
 /**
  * @brief Cleans up resources before exiting the shell.
  * Frees environment list and clears readline history.
@@ -77,6 +108,8 @@ void	shutdown_shell(t_process_data *process_data)
 		free_env(process_data->env_list);
 		process_data->env_list = NULL;
 	}
+	if (process_data)
+		free_shell_state(process_data);
 }
 
 /**
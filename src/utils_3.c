@@ -6,7 +6,7 @@
 /*   By: tiyang <tiyang@student.42.fr>                +#+                     */
 /*                                                   +#+                      */
 /*   Created: 2025/09/09 12:47:35 by makhudon      #+#    #+#                 */
-/*   Updated: 2025/09/09 13:48:39 by tiyang        ########   odam.nl         */
+/*   Updated: 2025/09/22 11:37:08 by tiyang        ########   odam.nl         */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -67,8 +67,7 @@ static void	free_execute_files_and_paths(t_execute_data *data)
 		free(data->heredoc_file);
 		data->heredoc_file = NULL;
 	}
-	free_ptr((void **)&data->input_file);
-	free_ptr((void **)&data->output_file);
+	free_fd_ops(&data->fd_ops);
 	if (data->path_dirs)
 	{
 		free_split(data->path_dirs);
@@ -79,8 +78,8 @@ static void	free_execute_files_and_paths(t_execute_data *data)
 
 /**
  * @brief Frees the argument arrays from the execute data structure.
- * * This function is responsible for cleaning up the `original_args` and
- * `clean_args` arrays.
+ * * This function is responsible for cleaning up the `original_args`,
+ * `clean_args` and `env_prefix` arrays.
  *
  * @param data A pointer to the execute data structure.
  */
@@ -96,6 +95,11 @@ static void	free_execute_arguments(t_execute_data *data)
 		free_split(data->clean_args);
 		data->clean_args = NULL;
 	}
+	if (data->env_prefix)
+	{
+		free_split(data->env_prefix);
+		data->env_prefix = NULL;
+	}
 }
 
 /**
@@ -0,0 +1,12 @@
+echo hello > f
+echo other > g
+cat f >> f
+echo $?
+cat - < f >> f
+echo $?
+cat g f >> g
+echo $?
+cat f g
+cat f > f
+echo $?
+cat f g | cat
@@ -0,0 +1,6 @@
+touch plain
+exec ./plain | cat
+echo "in a pipeline: $?"
+f() { exec no_such_command_here; }
+f
+echo not reached
@@ -0,0 +1,13 @@
+greet() {
+	cat <<E
+hello $1
+E
+	echo "after body $1"
+}
+greet one
+greet two
+show() { cat; }
+show <<E
+piped into a function
+E
+echo end
@@ -0,0 +1,15 @@
+for i in 1 2 3; do cat <<E; done
+body $i
+E
+echo after the loop
+printf 'x\ny\n' | while read w; do
+	cat <<E
+while $w
+E
+done
+for i in a b; do cat <<A | tr a-z A-Z; cat <<'B'; done
+upper $i
+A
+quoted $i
+B
+echo end
@@ -0,0 +1,17 @@
+cat > lib.sh <<'END'
+greet() {
+	cat <<E
+hello $1
+E
+}
+cat <<E
+from the file
+E
+cat <<E
+unterminated at the end of the file
+END
+source lib.sh <<E
+not for the sourced file
+E
+greet caller
+echo "the caller keeps its input"
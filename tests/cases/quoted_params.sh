@@ -0,0 +1,12 @@
+f() { echo "n=$#"; for a in "$@"; do echo "[$a]"; done; }
+g() { f "$@"; }
+g "x y" z
+g a "" b
+g
+h() { f "pre$@post"; f "${@}"; f "$*"; f $@; }
+h "1 2" 3
+h
+for a in "$@"; do echo "top [$a]"; done
+echo "top: [$@] [$*]"
+k() { f "$@" "$1"; }
+k one two
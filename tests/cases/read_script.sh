@@ -0,0 +1,12 @@
+echo hello > f
+read z < f
+echo "z=$z"
+read q
+line two
+echo "q=$q"
+read -n 3 r
+abc
+echo "r=$r"
+read a b
+ one two three
+echo "$a|$b"
@@ -0,0 +1,12 @@
+mkfifo p
+sh -c 'echo early > p &'
+cat < p
+sh -c '(sleep 0.2; echo late > p) &'
+cat < p
+sh -c '(sleep 0.2; echo builtin > p) &'
+read x < p
+echo "read: $x"
+sh -c '(sleep 0.2; cat < p > got) &'
+echo to the reader > p
+sleep 0.2
+cat got
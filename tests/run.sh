@@ -0,0 +1,33 @@
+#!/bin/sh
+# Runs every tests/cases/<name>.sh through the shell on standard input,
+# from a scratch directory, and compares what it prints on standard
+# output and standard error, followed by its exit status, with
+# tests/cases/<name>.out.
+#
+# usage: tests/run.sh [path/to/minishell] [name...]
+# Exits with 1 if any case fails.
+
+SHELL_BIN=$(cd "$(dirname "${1:-./minishell}")" && pwd)/$(basename "${1:-./minishell}")
+[ $# -gt 0 ] && shift
+CASES=$(cd "$(dirname "$0")/cases" && pwd)
+TMP=${TMPDIR:-/tmp}/minishell_tests.$$
+failed=0
+
+if [ $# -eq 0 ]; then
+	set -- $(cd "$CASES" && ls *.sh | sed 's/\.sh$//')
+fi
+for name in "$@"; do
+	rm -rf "$TMP"
+	mkdir -p "$TMP"
+	{ (cd "$TMP" && timeout 10 "$SHELL_BIN" < "$CASES/$name.sh" 2>&1);
+		echo "status $?"; } > "$TMP.out"
+	if cmp -s "$TMP.out" "$CASES/$name.out"; then
+		echo "ok    $name"
+	else
+		echo "FAIL  $name"
+		diff "$CASES/$name.out" "$TMP.out" | head -20 | sed 's/^/      /'
+		failed=1
+	fi
+done
+rm -rf "$TMP" "$TMP.out"
+exit $failed